@@ -21,6 +21,14 @@
 #   tools/bench_run.sh 32 ./bin/urbit-jet-32 results/$(date +%F)/bench-timing.csv
 #   BENCH_SMOKE=1 tools/bench_run.sh 32 ./bin/urbit-jet-32 results/smoke/bench-timing.csv
 #
+# BENCH_SUITE=arrays runs the Lagoon/Saloon scaling grids (+bench-lagoon,
+# +bench-saloon) instead, writing the scaling schema
+#   word_size,impl,suite,kind,bloq,arm,n,reps,set,elapsed_us,status
+# to OUT.  Both run twice on the same binary: jetted (lagoon.hoon/saloon.hoon as
+# shipped) and interp (every ~%/~/ line stripped from both, so no Lagoon or
+# Saloon jet registers; the scalar /lib/math jets stay).  SCALE_SCOPE=<kind>
+# restricts to one kind; bench_summarize.py turns OUT into the scaling table.
+#
 set -uo pipefail
 
 WS="${1:?word size 32|64}"
@@ -137,6 +145,85 @@ run_grid() {
   echo "  parsed $(( $(wc -l < "$OUT") - before )) rows"
 }
 
+# --- array scaling suite (BENCH_SUITE=arrays) --------------------------------
+# n sweeps 10 .. *_MAXN; square arms (transpose/sum-axis/mmul/eig*) stop at
+# *_SQMAX elements.  Interpreted Lagoon is ~1e3-1e4x slower, so it sweeps less.
+S_SETS=3
+S_JET_MAXN=1000000; S_JET_SQMAX=250000
+S_INT_MAXN=10000;   S_INT_SQMAX=2500
+if [ "${BENCH_SMOKE:-0}" = "1" ]; then
+  S_SETS=2; S_JET_MAXN=1000; S_JET_SQMAX=100; S_INT_MAXN=100; S_INT_SQMAX=100
+fi
+LIBS="$ROOT/../libmath/desk/lib"
+
+sync_arrays() {   # $1 = jetted|interp
+  clean_prompt
+  if ! ls "$PIER/base/gen" >/dev/null 2>&1; then
+    send_cmd '|mount %base'; sleep 6
+    local w=0
+    until ls "$PIER/base/gen" >/dev/null 2>&1; do sleep 3; w=$((w+3)); [ $w -gt 60 ] && break; done
+  fi
+  mkdir -p "$PIER"/base/sur
+  /bin/cp -f "$LIBS"/math.hoon "$LIBS"/unum.hoon "$LIBS"/twoc.hoon \
+             "$LIBS"/fixed.hoon "$LIBS"/complex.hoon \
+             "$DESK"/lib/bench-core.hoon "$DESK"/lib/array-cells.hoon "$PIER"/base/lib/
+  /bin/cp -f "$ROOT"/../lagoon/desk/sur/lagoon.hoon "$PIER"/base/sur/
+  if [ "$1" = "interp" ]; then
+    sed -E '/^ *~[%\/]  %/d' "$ROOT"/../lagoon/desk/lib/lagoon.hoon > "$PIER"/base/lib/lagoon.hoon
+    sed -E '/^ *~[%\/]  %/d' "$ROOT"/../saloon/desk/lib/saloon.hoon > "$PIER"/base/lib/saloon.hoon
+  else
+    /bin/cp -f "$ROOT"/../lagoon/desk/lib/lagoon.hoon "$ROOT"/../saloon/desk/lib/saloon.hoon "$PIER"/base/lib/
+  fi
+  /bin/cp -f "$DESK"/gen/bench-lagoon.hoon "$DESK"/gen/bench-saloon.hoon "$PIER"/base/gen/
+  clean_prompt
+  send_cmd '|commit %base'
+  local w=0
+  until tmux capture-pane -t "$SESSION" -p -S -25 | grep -qE 'bench-saloon|lagoon/hoon'; do
+    sleep 2; w=$((w+2)); [ $w -gt 60 ] && break; done
+  sleep 2
+}
+
+# run one suite's whole grid -> append parsed rows to $OUT
+run_scale() {
+  local tag="$1" suite="$2" maxn="$3" sqmax="$4" scope="${SCALE_SCOPE:-all}"
+  echo "[scale] impl=$tag suite=$suite sets=$S_SETS maxn=$maxn sqmax=$sqmax scope=$scope"
+  clean_prompt
+  local g0 f0
+  g0=$(tmux capture-pane -t "$SESSION" -p -S -200000 | grep -c "scale-done %$suite")
+  f0=$(tmux capture-pane -t "$SESSION" -p -S -200000 | grep -c 'generator-build-fail')
+  send_cmd "+bench-$suite $(dots "$S_SETS") $(dots "$maxn") $(dots "$sqmax") %${scope}"
+  local w=0
+  until [ "$(tmux capture-pane -t "$SESSION" -p -S -200000 | grep -c "scale-done %$suite")" -gt "$g0" ]; do
+    if [ "$(tmux capture-pane -t "$SESSION" -p -S -200000 | grep -c 'generator-build-fail')" -gt "$f0" ]; then
+      echo "  [scale BUILD FAILED — see session $SESSION]"; return 1
+    fi
+    sleep 10; w=$((w+10))
+    [ $((w % 60)) -eq 0 ] && echo "  ${w}s, cells so far: $(tmux capture-pane -t "$SESSION" -p -S -200000 | grep -c '%scell')"
+    [ $w -gt "$GRID_TIMEOUT" ] && { echo "  [scale TIMEOUT]"; break; }
+  done
+  tmux capture-pane -t "$SESSION" -p -S -200000 > "${RAW}-${tag}-${suite}.txt"
+  local before; before=$(wc -l < "$OUT")
+  python3 "$ROOT/tools/parse_scale.py" "$tag" "$WS" "$suite" "${RAW}-${tag}-${suite}.txt" >> "$OUT"
+  echo "  parsed $(( $(wc -l < "$OUT") - before )) rows"
+}
+
+if [ "${BENCH_SUITE:-math}" = "arrays" ]; then
+  echo "word_size,impl,suite,kind,bloq,arm,n,reps,set,elapsed_us,status" > "$OUT"
+  boot_ship
+  if [ "${SKIP_JETTED:-0}" != "1" ]; then
+    echo "[mode: jetted — lagoon/saloon hints intact]"
+    sync_arrays jetted
+    run_scale jetted lagoon "$S_JET_MAXN" "$S_JET_SQMAX"
+    run_scale jetted saloon "$S_JET_MAXN" "$S_JET_SQMAX"
+  fi
+  echo "[mode: interp — lagoon/saloon hints stripped]"
+  sync_arrays interp
+  run_scale interp lagoon "$S_INT_MAXN" "$S_INT_SQMAX"
+  run_scale interp saloon "$S_INT_MAXN" "$S_INT_SQMAX"
+  echo "[done] -> $OUT  ($(($(wc -l < "$OUT")-1)) rows)"
+  exit 0
+fi
+
 # --- math.hoon variants ------------------------------------------------------
 HINTED="$DESK/lib/math.hoon"
 NOJET="/tmp/math-nojet-${WS}.hoon"
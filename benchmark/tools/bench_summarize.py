@@ -10,8 +10,23 @@ Set 0 is dropped as warm-up.  Failed cells (status != ok) are ignored.
 
 Usage:
     tools/bench_summarize.py results/<date>/bench-timing.csv > results/<date>/bench-summary.tsv
+
+Array scaling mode.  Given scaling CSVs instead -- bench_run.sh with
+BENCH_SUITE=arrays (word_size,impl,suite,kind,bloq,arm,n,reps,set,elapsed_us,
+status) and/or lagoon/vere64/test/la_bench.sh (word_size,kind,bloq,op,n,reps,
+total_ns,..., read as impl `native`, suite lagoon, one set) -- it prints the
+scaling table: per (word_size,impl,suite,kind,bloq,arm,n) the base-subtracted
+per-call and per-element ns, plus `slope`, the least-squares log-log exponent
+of per-call time in n over that series (~1 for element-wise and reductions,
+~1.5 for mmul in elements; a jump between runs is a regression).  --plots DIR
+also writes one log-log figure per (suite, kind) into DIR.
+
+    tools/bench_summarize.py results/<date>/bench-scale.csv [la-bench.csv] \
+        [--plots results/<date>/figures] > results/<date>/bench-scale.tsv
 """
 import csv
+import math
+import os
 import sys
 import statistics
 from collections import defaultdict
@@ -57,7 +72,133 @@ def main(path):
                       f"{mean:.1f}", f"{sd:.1f}", f"{base:.1f}"])
 
 
+def scale_rows(path):
+    """Yield (ws, impl, suite, kind, bloq, arm, n, set, ns_per_call)."""
+    for r in csv.DictReader(open(path)):
+        if r["status"] != "ok":
+            continue
+        reps = int(r["reps"])
+        if "total_ns" in r:      # la_bench.c, native kernels
+            yield (r["word_size"], "native", "lagoon", r["kind"], int(r["bloq"]),
+                   r["op"], int(r["n"]), 1, float(r["total_ns"]) / reps)
+        else:
+            yield (r["word_size"], r["impl"], r["suite"], r["kind"], int(r["bloq"]),
+                   r["arm"], int(r["n"]), int(r["set"]),
+                   float(r["elapsed_us"]) * 1000.0 / reps)
+
+
+def slope(pts):
+    """Least-squares exponent b of t = a * n^b over [(n, t)], t > 0."""
+    pts = [(math.log(n), math.log(t)) for n, t in pts if n > 0 and t > 0]
+    if len(pts) < 2:
+        return None
+    mx = statistics.mean(x for x, _ in pts)
+    my = statistics.mean(y for _, y in pts)
+    sxx = sum((x - mx) ** 2 for x, _ in pts)
+    return sum((x - mx) * (y - my) for x, y in pts) / sxx if sxx else None
+
+
+def scale(paths, plots):
+    # cells[(ws,impl,suite,kind,bloq,arm,n)][set] = ns per call
+    cells = defaultdict(dict)
+    for path in paths:
+        for ws, impl, suite, kind, bloq, arm, n, st, ns in scale_rows(path):
+            cells[(ws, impl, suite, kind, bloq, arm, n)][st] = ns
+
+    def percall(key):   # set 0 dropped as warm-up when there are others
+        sets = cells.get(key, {})
+        return [v for st, v in sets.items() if st != 0 or len(sets) == 1]
+
+    base = {}
+    for key in cells:
+        if key[5] == "base" and percall(key):
+            base[key[:5] + (key[6],)] = statistics.mean(percall(key))
+
+    # series[(ws,impl,suite,kind,bloq,arm)] = [(n, mean, sd, base)]
+    series = defaultdict(list)
+    for key in sorted(cells):
+        ws, impl, suite, kind, bloq, arm, n = key
+        if arm == "base" or not percall(key):
+            continue
+        b = base.get(key[:5] + (n,), 0.0)
+        vals = [v - b for v in percall(key)]
+        sd = statistics.pstdev(vals) if len(vals) > 1 else 0.0
+        series[key[:6]].append((n, statistics.mean(vals), sd, b, len(vals)))
+
+    out = csv.writer(sys.stdout, delimiter="\t")
+    out.writerow(["word_size", "impl", "suite", "kind", "bloq", "arm", "n", "sets",
+                  "mean_ns", "stddev_ns", "ns_per_elem", "base_ns", "slope"])
+    for sk in sorted(series):
+        pts = sorted(series[sk])
+        b = slope([(n, m) for n, m, _, _, _ in pts])
+        for n, m, sd, base_ns, k in pts:
+            out.writerow(list(sk) + [n, k, f"{m:.1f}", f"{sd:.1f}", f"{m / n:.2f}",
+                                     f"{base_ns:.1f}", "" if b is None else f"{b:.2f}"])
+    if plots:
+        scale_plots(series, plots)
+
+
+def scale_plots(series, outdir):
+    """Small multiples, one figure per (suite, kind): a panel per arm, per-call
+    ns against n on log-log axes, one line per (impl, bloq)."""
+    import matplotlib
+    matplotlib.use("Agg")
+    import matplotlib.pyplot as plt
+    plt.rcParams.update({
+        "font.family": "serif", "font.size": 8, "axes.titlesize": 9,
+        "axes.spines.top": False, "axes.spines.right": False,
+        "axes.linewidth": 0.6, "figure.dpi": 160,
+    })
+    dash = {"jetted": "-", "native": ":", "interp": "--"}
+    os.makedirs(outdir, exist_ok=True)
+    groups = defaultdict(lambda: defaultdict(list))
+    for (ws, impl, suite, kind, bloq, arm), pts in series.items():
+        groups[(suite, kind)][arm].append((ws, impl, bloq, sorted(pts)))
+    for (suite, kind), arms in sorted(groups.items()):
+        names = sorted(arms)
+        cols = min(4, len(names))
+        rows = (len(names) + cols - 1) // cols
+        fig, axs = plt.subplots(rows, cols, figsize=(2.2 * cols, 1.9 * rows),
+                                squeeze=False)
+        for ax, arm in zip(axs.flat, names):
+            for ws, impl, bloq, pts in sorted(arms[arm]):
+                ns = [n for n, m, *_ in pts if m > 0]
+                ts = [m for n, m, *_ in pts if m > 0]
+                if ns:
+                    ax.plot(ns, ts, dash.get(impl, "-"), marker="o", ms=2.5, lw=0.8,
+                            label=f"{impl} {ws}-bit bloq {bloq}")
+            ax.set_xscale("log"); ax.set_yscale("log")
+            ax.set_title(arm, loc="left")
+        for ax in list(axs.flat)[len(names):]:
+            ax.set_visible(False)
+        seen = {}
+        for ax in axs.flat:
+            for h, l in zip(*ax.get_legend_handles_labels()):
+                seen.setdefault(l, h)
+        fig.legend(seen.values(), seen.keys(), loc="lower right", frameon=False,
+                   fontsize=6)
+        fig.suptitle(f"{suite} %{kind}: per-call ns vs n (log-log)", x=0.02,
+                     ha="left", fontsize=10)
+        fig.tight_layout()
+        for ext in ("png", "pdf"):
+            fig.savefig(f"{outdir}/scale-{suite}-{kind}.{ext}", bbox_inches="tight")
+        plt.close(fig)
+
+
 if __name__ == "__main__":
-    if len(sys.argv) != 2:
+    args = sys.argv[1:]
+    plots = None
+    if "--plots" in args:
+        i = args.index("--plots")
+        plots = args[i + 1] if i + 1 < len(args) else sys.exit(__doc__)
+        del args[i:i + 2]
+    if not args:
+        sys.exit(__doc__)
+    with open(args[0]) as f:
+        head = f.readline()
+    if "suite" in head.split(",") or "total_ns" in head.split(","):
+        scale(args, plots)
+    elif len(args) == 1 and plots is None:
+        main(args[0])
+    else:
         sys.exit(__doc__)
-    main(sys.argv[1])
@@ -0,0 +1,22 @@
+import sys, re
+# Like parse_raw.py, for the array scaling grids (+bench-lagoon / +bench-saloon):
+# pairs each `[%scell suite kind bloq arm n r set]` marker with the next `took`.
+# A `[%fail ..]` after a marker becomes a status=fail row.
+tag, ws, suite, path = sys.argv[1], sys.argv[2], sys.argv[3], sys.argv[4]
+lines = open(path).readlines()
+done = [i for i,l in enumerate(lines) if re.search(r"scale-done\s+%" + suite, l)]
+if   len(done) >= 2: start, end = done[-2]+1, done[-1]
+elif len(done) == 1: start, end = 0, done[-1]
+else:                start, end = 0, len(lines)
+cur=None; rows=0
+for line in lines[start:end]:
+    mc = re.search(r"%scell\s+%([a-z0-9-]+)\s+%([a-z0-9-]+)\s+(\d+)\s+%([a-z0-9-]+)\s+([\d.]+)\s+([\d.]+)\s+([\d.]+)", line)
+    if mc:
+        s,k,b,a,n,r,st = mc.groups(); cur=[k,b,a,n.replace('.',''),r.replace('.',''),st.replace('.','')]; continue
+    if cur is None: continue
+    mt = re.search(r"took\s+\S+/([\d.]+)", line)
+    if mt or "%fail" in line:
+        us, status = (mt.group(1).replace('.',''), "ok") if mt else ("0", "fail")
+        k,b,a,n,r,st = cur
+        print(f"{ws},{tag},{suite},{k},{b},{a},{n},{r},{st},{us},{status}"); rows+=1; cur=None
+sys.stderr.write(f"  {tag}/{suite}: {rows} rows\n")
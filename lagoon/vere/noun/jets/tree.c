@@ -2136,13 +2136,22 @@ static u3j_harm _139_non__lagoon_muls_a[] = {{".2", u3wi_la_muls}, {}};
 static u3j_harm _139_non__lagoon_divs_a[] = {{".2", u3wi_la_divs}, {}};
 static u3j_harm _139_non__lagoon_mods_a[] = {{".2", u3wi_la_mods}, {}};
 static u3j_harm _139_non__lagoon_dot_a[]  = {{".2", u3wi_la_dot}, {}};
+static u3j_harm _139_non__lagoon_dotc_a[] = {{".2", u3wi_la_dotc}, {}};
 static u3j_harm _139_non__lagoon_trans_a[] ={{".2", u3wi_la_transpose}, {}};
+static u3j_harm _139_non__lagoon_permute_a[]={{".2", u3wi_la_permute}, {}};
 static u3j_harm _139_non__lagoon_cumsum_a[]={{".2", u3wi_la_cumsum}, {}};
 static u3j_harm _139_non__lagoon_argmin_a[]={{".2", u3wi_la_argmin}, {}};
 static u3j_harm _139_non__lagoon_argmax_a[]={{".2", u3wi_la_argmax}, {}};
 static u3j_harm _139_non__lagoon_ravel_a[]={{".2", u3wi_la_ravel}, {}};
 static u3j_harm _139_non__lagoon_min_a[]  = {{".2", u3wi_la_min}, {}};
 static u3j_harm _139_non__lagoon_max_a[]  = {{".2", u3wi_la_max}, {}};
+static u3j_harm _139_non__lagoon_prod_a[] = {{".2", u3wi_la_prod}, {}};
+static u3j_harm _139_non__lagoon_sum_axis_a[] = {{".2", u3wi_la_sum_axis}, {}};
+static u3j_harm _139_non__lagoon_prod_axis_a[] = {{".2", u3wi_la_prod_axis}, {}};
+static u3j_harm _139_non__lagoon_max_axis_a[] = {{".2", u3wi_la_max_axis}, {}};
+static u3j_harm _139_non__lagoon_min_axis_a[] = {{".2", u3wi_la_min_axis}, {}};
+static u3j_harm _139_non__lagoon_argmax_axis_a[] = {{".2", u3wi_la_argmax_axis}, {}};
+static u3j_harm _139_non__lagoon_argmin_axis_a[] = {{".2", u3wi_la_argmin_axis}, {}};
 static u3j_harm _139_non__lagoon_linspace_a[]={{".2", u3wi_la_linspace}, {}};
 static u3j_harm _139_non__lagoon_range_a[]= {{".2", u3wi_la_range}, {}};
 static u3j_harm _139_non__lagoon_abs_a[]  = {{".2", u3wi_la_abs}, {}};
@@ -2153,6 +2162,11 @@ static u3j_harm _139_non__lagoon_lte_a[]  = {{".2", u3wi_la_lte}, {}};
 static u3j_harm _139_non__lagoon_diag_a[] = {{".2", u3wi_la_diag}, {}};
 static u3j_harm _139_non__lagoon_trace_a[]= {{".2", u3wi_la_trace}, {}};
 static u3j_harm _139_non__lagoon_mmul_a[] = {{".2", u3wi_la_mmul}, {}};
+static u3j_harm _139_non__lagoon_mmul_unum_a[] = {{".2", u3wi_la_mmul_unum}, {}};
+static u3j_harm _139_non__lagoon_mmul_fixp_a[] = {{".2", u3wi_la_mmul_fixp}, {}};
+static u3j_harm _139_non__lagoon_el_wise_op_a[] = {{".2", u3wi_la_el_wise_op}, {}};
+static u3j_harm _139_non__lagoon_bin_op_a[] = {{".2", u3wi_la_bin_op}, {}};
+static u3j_harm _139_non__lagoon_ter_op_a[] = {{".2", u3wi_la_ter_op}, {}};
 static u3j_core _139_non__la_core_d[] =
   { { "add-rays", 7, _139_non__lagoon_add_a,  0, no_hashes },
     { "sub-rays", 7, _139_non__lagoon_sub_a,  0, no_hashes },
@@ -2165,13 +2179,22 @@ static u3j_core _139_non__la_core_d[] =
     { "div-scal", 7, _139_non__lagoon_divs_a, 0, no_hashes },
     { "mod-scal", 7, _139_non__lagoon_mods_a, 0, no_hashes },
     { "dot",      7, _139_non__lagoon_dot_a,  0, no_hashes },
+    { "dotc",     7, _139_non__lagoon_dotc_a, 0, no_hashes },
     { "transpose",7, _139_non__lagoon_trans_a, 0, no_hashes },
+    { "permute",  7, _139_non__lagoon_permute_a, 0, no_hashes },
     { "cumsum",   7, _139_non__lagoon_cumsum_a, 0, no_hashes },
     { "argmin",   7, _139_non__lagoon_argmin_a, 0, no_hashes },
     { "argmax",   7, _139_non__lagoon_argmax_a, 0, no_hashes },
     { "ravel",    7, _139_non__lagoon_ravel_a, 0, no_hashes },
     { "min",      7, _139_non__lagoon_min_a, 0, no_hashes },
     { "max",      7, _139_non__lagoon_max_a, 0, no_hashes },
+    { "prod",     7, _139_non__lagoon_prod_a, 0, no_hashes },
+    { "sum-axis", 7, _139_non__lagoon_sum_axis_a, 0, no_hashes },
+    { "prod-axis", 7, _139_non__lagoon_prod_axis_a, 0, no_hashes },
+    { "max-axis", 7, _139_non__lagoon_max_axis_a, 0, no_hashes },
+    { "min-axis", 7, _139_non__lagoon_min_axis_a, 0, no_hashes },
+    { "argmax-axis", 7, _139_non__lagoon_argmax_axis_a, 0, no_hashes },
+    { "argmin-axis", 7, _139_non__lagoon_argmin_axis_a, 0, no_hashes },
     { "linspace", 7, _139_non__lagoon_linspace_a, 0, no_hashes },
     { "range",    7, _139_non__lagoon_range_a, 0, no_hashes },
     { "abs",      7, _139_non__lagoon_abs_a, 0, no_hashes },
@@ -2182,6 +2205,11 @@ static u3j_core _139_non__la_core_d[] =
     { "diag",     7, _139_non__lagoon_diag_a, 0, no_hashes },
     { "trace",    7, _139_non__lagoon_trace_a,0, no_hashes },
     { "mmul",     7, _139_non__lagoon_mmul_a, 0, no_hashes },
+    { "mmul-unum", 7, _139_non__lagoon_mmul_unum_a, 0, no_hashes },
+    { "mmul-fixp", 7, _139_non__lagoon_mmul_fixp_a, 0, no_hashes },
+    { "el-wise-op", 7, _139_non__lagoon_el_wise_op_a, 0, no_hashes },
+    { "bin-op",   7, _139_non__lagoon_bin_op_a, 0, no_hashes },
+    { "ter-op",   7, _139_non__lagoon_ter_op_a, 0, no_hashes },
     {}
   };
 
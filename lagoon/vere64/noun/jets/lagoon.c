@@ -1,16 +1,229 @@
 /// @file
 
+#ifndef LAGOON_JET_HARNESS
 #include "jets/q.h"
 #include "jets/w.h"
 
 #include "c3/motes.h"
 
 #include "noun.h"
-#include "softfloat.h"
+#include "jets/i/jstat.h"  // per-jet statistics (U3_JET_STATS)
+#else
+#include "noun_shim.h"  // test/: the noun API the u3qi kernels use, off-ship
+#endif
 #include "softblas.h"
+#include "softfloat.h"
 
+#include <fenv.h>  // for fegetround() (native %i754 lanes)
+#include <float.h>  // for FLT_EVAL_METHOD
 #include <math.h>  // for pow()
+#include <pthread.h>  // for parallel mmul
 #include <stdio.h>
+#include <stdlib.h>  // for getenv(), strtoull()
+#include <string.h>  // for memcpy (mmul panel packing)
+#include <unistd.h>  // for sysconf()
+
+/* marshalling: the jet's u3r_bytes, u3i_bytes and u3i_slab_mint calls go
+** through _la_rbytes, _la_ibytes and _la_mint, which under per-jet
+** statistics (jets/i/jstat.h) run them on the jstat clock, so each jet's
+** time splits into marshalling and compute.
+*/
+#ifndef LAGOON_JET_HARNESS
+#define _la_rbytes(a_d, b_d, c_y, d)  U3QI_JST_MAR_V(u3r_bytes(a_d, b_d, c_y, d))
+#define _la_ibytes(a_d, b_y)          U3QI_JST_MAR(u3_atom, u3i_bytes(a_d, b_y))
+#define _la_mint(sab_u)               U3QI_JST_MAR(u3_atom, u3i_slab_mint(sab_u))
+#else
+#define _la_rbytes  u3r_bytes
+#define _la_ibytes  u3i_bytes
+#define _la_mint    u3i_slab_mint
+#endif
+
+/* native %i754 lanes
+**
+** IEEE 754 add, sub, mul and div are correctly rounded, so under
+** round-to-nearest-even a host that evaluates float and double at their
+** own precision (FLT_EVAL_METHOD 0: SSE2, AArch64, not x87) produces the
+** same bits as SoftFloat for every lane whose result is not NaN.  Each lane
+** is a single op, so there is no multiply-add for the compiler to contract;
+** builds with -ffast-math, and hosts running with flush-to-zero, are not
+** supported.  NaN bits are specialization-defined (which payload wins, the
+** sign of the default NaN), so a lane whose result is NaN is redone by
+** [lan_f], the jet's own SoftFloat call for that lane.
+**
+** Lanes go through fixed-size local buffers: the op loops stay plain enough
+** to vectorize, and [r] may alias [x] or [y] (the jets update an operand
+** slab in place).  [ysd] is 1 for a ray operand and 0 to broadcast y[0].
+** f16 lanes ride the same loops in binary32 (see _la_nat_h).  Define
+** LAGOON_NO_NATIVE to compile the path out.
+*/
+#if !defined(LAGOON_NO_NATIVE) && !defined(__FAST_MATH__) && \
+    defined(FLT_EVAL_METHOD) && (0 == FLT_EVAL_METHOD)
+#  define _LA_NATIVE
+#endif
+
+  typedef enum {
+    _la_nat_add,
+    _la_nat_sub,
+    _la_nat_mul,
+    _la_nat_div,
+  } _la_nat;
+
+#define _LA_NAT_LANES 256
+
+//  c[i] := a[i] op b[i] for i < m, one plain loop per op
+#define _LA_NAT_OPS(op, m, a, b, c)                                           \
+  switch ( op ) {                                                             \
+    case _la_nat_add: for ( c3_d i = 0; i < m; i++ ) c[i] = a[i] + b[i];      \
+                      break;                                                  \
+    case _la_nat_sub: for ( c3_d i = 0; i < m; i++ ) c[i] = a[i] - b[i];      \
+                      break;                                                  \
+    case _la_nat_mul: for ( c3_d i = 0; i < m; i++ ) c[i] = a[i] * b[i];      \
+                      break;                                                  \
+    case _la_nat_div: for ( c3_d i = 0; i < m; i++ ) c[i] = a[i] / b[i];      \
+                      break;                                                  \
+  }
+
+#define _LA_NAT(SUF, TY, NT)                                                  \
+  static void                                                                 \
+  _la_nat_##SUF(_la_nat op, c3_d len, const c3_y* x_y, const c3_y* y_y,       \
+                c3_d ysd, c3_y* r_y,                                          \
+                void (*lan_f)(const TY*, const TY*, TY*))                     \
+  {                                                                           \
+    NT a[_LA_NAT_LANES], b[_LA_NAT_LANES], c[_LA_NAT_LANES];                  \
+                                                                              \
+    if ( 0 == ysd ) {                                                         \
+      NT s;                                                                   \
+      memcpy(&s, y_y, sizeof(NT));                                            \
+      for ( c3_d i = 0; i < _LA_NAT_LANES; i++ ) b[i] = s;                    \
+    }                                                                         \
+                                                                              \
+    for ( c3_d o = 0; o < len; o += _LA_NAT_LANES ) {                         \
+      c3_d m = ( (len - o) < _LA_NAT_LANES ) ? (len - o) : _LA_NAT_LANES;     \
+      c3_y nan_y = 0;                                                         \
+                                                                              \
+      memcpy(a, x_y + o*sizeof(NT), m*sizeof(NT));                            \
+      if ( ysd ) memcpy(b, y_y + o*sizeof(NT), m*sizeof(NT));                 \
+                                                                              \
+      _LA_NAT_OPS(op, m, a, b, c);                                            \
+                                                                              \
+      for ( c3_d i = 0; i < m; i++ ) nan_y |= ( c[i] != c[i] );               \
+                                                                              \
+      if ( nan_y ) {                                                          \
+        for ( c3_d i = 0; i < m; i++ ) {                                      \
+          if ( c[i] == c[i] ) continue;                                       \
+          TY p, q, s;                                                         \
+          memcpy(&p, &a[i], sizeof(NT));                                      \
+          memcpy(&q, &b[i], sizeof(NT));                                      \
+          lan_f(&p, &q, &s);                                                  \
+          memcpy(&c[i], &s, sizeof(NT));                                      \
+        }                                                                     \
+      }                                                                       \
+                                                                              \
+      memcpy(r_y + o*sizeof(NT), c, m*sizeof(NT));                            \
+    }                                                                         \
+  }
+
+  _LA_NAT(s, float32_t, float)
+  _LA_NAT(d, float64_t, double)
+
+/* f16 lanes are computed in binary32.  Its 24-bit significand is at least
+** 2*11+2 bits, so add, sub, mul and div done in f32 and rounded once to f16
+** are double-rounding-safe: under round-to-nearest-even they give exactly
+** SoftFloat's f16 bits.  Widening is exact; narrowing is an integer RNE, so
+** no F16C is needed and the loops still vectorize.  f32 never underflows on
+** f16 operands, so flush-to-zero does not matter here.
+*/
+  static inline float
+  _la_h2s(uint16_t h)
+  {
+    uint32_t s_w = (uint32_t)(h & 0x8000) << 16;
+    uint32_t e_w = (h >> 10) & 0x1f;
+    uint32_t m_w = h & 0x3ff;
+    uint32_t u_w;
+    float    f;
+
+    if ( 0x1f == e_w ) {
+      u_w = s_w | 0x7f800000 | (m_w << 13);
+    }
+    else if ( 0 != e_w ) {
+      u_w = s_w | ((e_w + 112) << 23) | (m_w << 13);
+    }
+    else {
+      //  subnormal: m * 2^-24, exact
+      f = (float)m_w * 0x1p-24f;
+      memcpy(&u_w, &f, sizeof(f));
+      u_w |= s_w;
+    }
+    memcpy(&f, &u_w, sizeof(f));
+    return f;
+  }
+
+  //  f (not NaN) rounded to nearest-even f16
+  static inline uint16_t
+  _la_s2h(float f)
+  {
+    uint32_t u_w, a_w;
+    memcpy(&u_w, &f, sizeof(f));
+    uint16_t s_s = (u_w >> 16) & 0x8000;
+    a_w = u_w & 0x7fffffff;
+
+    if ( a_w >= 0x477ff000 ) {        //  >= 65520 rounds to inf
+      return s_s | 0x7c00;
+    }
+    if ( a_w >= 0x38800000 ) {        //  normal f16
+      return s_s | ((a_w + 0xfff + ((a_w >> 13) & 1) - 0x38000000) >> 13);
+    }
+    //  subnormal f16: |f| + 0.5 lands on the 2^-24 grid, rounded by the FPU
+    memcpy(&f, &a_w, sizeof(f));
+    f += 0.5f;
+    memcpy(&a_w, &f, sizeof(f));
+    return s_s | (uint16_t)(a_w - 0x3f000000);
+  }
+
+  static void
+  _la_nat_h(_la_nat op, c3_d len, const c3_y* x_y, const c3_y* y_y,
+            c3_d ysd, c3_y* r_y,
+            void (*lan_f)(const float16_t*, const float16_t*, float16_t*))
+  {
+    uint16_t p[_LA_NAT_LANES], q[_LA_NAT_LANES], t[_LA_NAT_LANES];
+    float    a[_LA_NAT_LANES], b[_LA_NAT_LANES], c[_LA_NAT_LANES];
+
+    if ( 0 == ysd ) {
+      memcpy(&q[0], y_y, sizeof(uint16_t));
+      for ( c3_d i = 0; i < _LA_NAT_LANES; i++ ) {
+        q[i] = q[0];
+        b[i] = _la_h2s(q[0]);
+      }
+    }
+
+    for ( c3_d o = 0; o < len; o += _LA_NAT_LANES ) {
+      c3_d m = ( (len - o) < _LA_NAT_LANES ) ? (len - o) : _LA_NAT_LANES;
+
+      memcpy(p, x_y + o*sizeof(uint16_t), m*sizeof(uint16_t));
+      for ( c3_d i = 0; i < m; i++ ) a[i] = _la_h2s(p[i]);
+      if ( ysd ) {
+        memcpy(q, y_y + o*sizeof(uint16_t), m*sizeof(uint16_t));
+        for ( c3_d i = 0; i < m; i++ ) b[i] = _la_h2s(q[i]);
+      }
+
+      _LA_NAT_OPS(op, m, a, b, c);
+
+      for ( c3_d i = 0; i < m; i++ ) {
+        if ( c[i] == c[i] ) {
+          t[i] = _la_s2h(c[i]);
+        }
+        else {
+          float16_t u, v, w;
+          memcpy(&u, &p[i], sizeof(uint16_t));
+          memcpy(&v, &q[ysd ? i : 0], sizeof(uint16_t));
+          lan_f(&u, &v, &w);
+          memcpy(&t[i], &w, sizeof(uint16_t));
+        }
+      }
+
+      memcpy(r_y + o*sizeof(uint16_t), t, m*sizeof(uint16_t));
+    }
+  }
 
 #define f16_ceil(a) f16_roundToInt( a, softfloat_round_max, false )
 #define f32_ceil(a) f32_roundToInt( a, softfloat_round_max, false )
@@ -37,54 +250,59 @@
     c3_d c[2];
   };
 
-  //  SoftBLAS is now stateless: rounding is passed per call. This holds
-  //  the active mode (replaces the old softblas_roundingMode global).
-  static c3_y _la_rnd = 'n';
+  //  Rounding is an explicit argument, never process state: each u3qi
+  //  entry takes a SoftBLAS mode char and hands it to every SoftBLAS call.
+  //  SoftFloat only has the global softfloat_roundingMode, so an entry
+  //  that calls SoftFloat directly pushes its mode on the way in and pops
+  //  the caller's on the way out.  Nothing leaks between jets or threads.
+
+  //  Map a rounding-mode atom to its SoftBLAS char.  Accepts %n %u %d %z
+  //  (see +$rounding-mode); %a (nearest, ties away) is handled too, but
+  //  the hoon @rs/@rd/@rq/@rh doors never produce it.  Any other value
+  //  bails.
+  static inline c3_y
+  _la_rnd_of(c3_y a)
+  {
+    switch ( a ) {
+      default:    u3m_bail(c3__fail); return 'n';
+      case c3__n: return 'n';
+      case c3__z: return 'z';
+      case c3__u: return 'u';
+      case c3__d: return 'd';
+      case c3__a: return 'a';
+    }
+  }
 
-  //  Set the SoftFloat/SoftBLAS rounding mode from a rounding-mode atom.
-  //  Accepts %n %u %d %z (see +$rounding-mode); %a (nearest, ties away)
-  //  is handled too, but the hoon @rs/@rd/@rq/@rh doors never produce it.
-  //  Any other value bails.
-  static inline void
-  _set_rounding_la(c3_y a)
+  //  SoftFloat mode for a SoftBLAS char.
+  static inline c3_y
+  _la_sf_mode(c3_y rnd)
   {
-    // We could use SoftBLAS set_rounding() to set the SoftFloat
-    // mode as well, but it's more explicit to do it here since
-    // we may use SoftFloat in any given Lagoon jet and we want
-    // you, dear developer, to see it set here.
-    switch ( a )
-    {
-    default:
-      u3m_bail(c3__fail);
-      break;
-    // %n - near
-    case c3__n:
-      softfloat_roundingMode = softfloat_round_near_even;
-      _la_rnd = 'n';
-      break;
-    // %z - zero
-    case c3__z:
-      softfloat_roundingMode = softfloat_round_minMag;
-      _la_rnd = 'z';
-      break;
-    // %u - up
-    case c3__u:
-      softfloat_roundingMode = softfloat_round_max;
-      _la_rnd = 'u';
-      break;
-    // %d - down
-    case c3__d:
-      softfloat_roundingMode = softfloat_round_min;
-      _la_rnd = 'd';
-      break;
-    // %a - away
-    case c3__a:
-      softfloat_roundingMode = softfloat_round_near_maxMag;
-      _la_rnd = 'a';
-      break;
+    switch ( rnd ) {
+      default:  return softfloat_round_near_even;
+      case 'z': return softfloat_round_minMag;
+      case 'u': return softfloat_round_max;
+      case 'd': return softfloat_round_min;
+      case 'a': return softfloat_round_near_maxMag;
     }
   }
 
+  //  Enter [rnd], returning the caller's SoftFloat mode.
+  static inline c3_y
+  _la_sf_push(c3_y rnd)
+  {
+    c3_y old_y = softfloat_roundingMode;
+    softfloat_roundingMode = _la_sf_mode(rnd);
+    return old_y;
+  }
+
+  //  Restore the caller's SoftFloat mode and pass [pro] through.
+  static inline u3_noun
+  _la_sf_pop(c3_y old_y, u3_noun pro)
+  {
+    softfloat_roundingMode = old_y;
+    return pro;
+  }
+
 /* length of shape = x * y * z * w * ...
 */
   static inline c3_d _get_length(u3_noun shape)
@@ -132,18 +350,131 @@
     return __(sin == dex);
   }
 
+/* read-only view of a ray's lanes
+**
+** Most jets only read their operands, so rather than copy each data atom
+** out with u3r_bytes we point straight into its loom buffer when that is
+** safe: an indirect atom on a little-endian host, at least syz bytes long,
+** with the buffer aligned for the lane width (the loom aligns atom bodies
+** to 8 bytes, so in practice only direct atoms take the copy).  Anything
+** else falls back to a scratch copy.  Never write through the returned
+** pointer; release it with _la_view_put.
+*/
+  typedef struct {
+    c3_y* buf_y;    //  lane bytes, lane 0 first
+    c3_o  own_o;    //  c3y if buf_y is a scratch copy we must free
+  } _la_view;
+
+  static inline c3_y*
+  _la_view_get(_la_view* vew_u, u3_atom dat, c3_d syz, c3_d bloq)
+  {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    if ( c3y == u3a_is_pug(dat) ) {
+      u3a_atom* vat_u = u3a_to_ptr(dat);
+      c3_d      aln   = ( bloq <= 3 ) ? 1 :
+                        ( bloq >= 6 ) ? 8 : ((c3_d)1 << (bloq - 3));
+
+      if ( ((c3_d)vat_u->len_w * sizeof(c3_w) >= syz) &&
+           (0 == ((uintptr_t)vat_u->buf_w & (aln - 1))) )
+      {
+        vew_u->buf_y = (c3_y*)vat_u->buf_w;
+        vew_u->own_o = c3n;
+        return vew_u->buf_y;
+      }
+    }
+#endif
+    vew_u->buf_y = (c3_y*)u3a_malloc(syz*sizeof(c3_y));
+    vew_u->own_o = c3y;
+    _la_rbytes(0, syz, vew_u->buf_y, dat);
+    return vew_u->buf_y;
+  }
+
+  static inline void
+  _la_view_put(_la_view* vew_u)
+  {
+    if ( c3y == vew_u->own_o ) {
+      u3a_free(vew_u->buf_y);
+    }
+  }
+
+/* result data built in place
+**
+** Results are written straight into a u3i_slab holding syz bytes of lanes
+** plus the 0x1 pin, then minted, so a result is allocated once and never
+** copied.  _la_slab_from seeds the lanes from an operand, for the jets that
+** update one operand in place (?axpy, ?scal, elementwise loops).
+*/
+  static inline c3_y*
+  _la_slab_bare(u3i_slab* sab_u, c3_d syz)
+  {
+    u3i_slab_bare(sab_u, 3, syz+1);
+    sab_u->buf_w[sab_u->len_w - 1] = 0;
+    sab_u->buf_y[syz] = 0x1;
+    return sab_u->buf_y;
+  }
+
+  static inline c3_y*
+  _la_slab_from(u3i_slab* sab_u, u3_atom dat, c3_d syz)
+  {
+    c3_y* buf_y = _la_slab_bare(sab_u, syz);
+    _la_rbytes(0, syz, buf_y, dat);
+    return buf_y;
+  }
+
+/* native %i754 lanes: SoftFloat redo of one lane, exactly as each jet's
+** own loop computes it (r = op(x, y)).  Only called for NaN results.
+*/
+#define _LA_NAT_LANE(SUF, TY, AXPY, SCAL, MUL, DIV, ONE, NEG)                 \
+  static void                                                                 \
+  _la_nat_##SUF##_add(const TY* x, const TY* y, TY* r)                        \
+  { *r = *y; AXPY(1, (TY){ONE}, (TY*)x, 1, r, 1, 'n'); }                       \
+  static void                                                                 \
+  _la_nat_##SUF##_sub(const TY* x, const TY* y, TY* r)                        \
+  { *r = *x; AXPY(1, (TY){NEG}, (TY*)y, 1, r, 1, 'n'); }                       \
+  static void                                                                 \
+  _la_nat_##SUF##_mul(const TY* x, const TY* y, TY* r)                        \
+  { *r = MUL(*x, *y); }                                                       \
+  static void                                                                 \
+  _la_nat_##SUF##_div(const TY* x, const TY* y, TY* r)                        \
+  { *r = DIV(*x, *y); }                                                       \
+  static void                                                                 \
+  _la_nat_##SUF##_scal(const TY* x, const TY* y, TY* r)                       \
+  { *r = *x; SCAL(1, *y, r, 1, 'n'); }
+
+  _LA_NAT_LANE(h, float16_t, haxpy, hscal, f16_mul, f16_div,
+               SB_REAL16_ONE, SB_REAL16_NEGONE)
+  _LA_NAT_LANE(s, float32_t, saxpy, sscal, f32_mul, f32_div,
+               SB_REAL32_ONE, SB_REAL32_NEGONE)
+  _LA_NAT_LANE(d, float64_t, daxpy, dscal, f64_mul, f64_div,
+               SB_REAL64_ONE, SB_REAL64_NEGONE)
+
+  //  c3y if the native lanes may stand in for SoftFloat: %n, and the host
+  //  FPU still rounding to nearest.
+  static inline c3_o
+  _la_nat_ok(c3_y rnd)
+  {
+#ifdef _LA_NATIVE
+    return __( ('n' == rnd) && (FE_TONEAREST == fegetround()) );
+#else
+    return c3n;
+#endif
+  }
+
 /* add - axpy = 1*x+y
 */
   u3_noun
   u3qi_la_add_i754(u3_noun x_data,
                    u3_noun y_data,
                    u3_noun shape,
-                   u3_noun bloq
+                   u3_noun bloq,
+                   c3_y    rnd
                    )
   {
+    c3_y sof_y = _la_sf_push(rnd);
+
     //  Fence on valid bloq size.
     if (bloq < 4 || bloq > 7) {
-      return u3_none;
+      return _la_sf_pop(sof_y, u3_none);
     }
 
     //  Unpack the data as a byte array.  We assume total length < 2**64.
@@ -153,41 +484,54 @@
     // syz_x is length in bytes
     c3_d syz_x = len_x * pow(2, bloq-3);
 
-    // x_bytes is the data array (w/o leading 0x1)
-    c3_y* x_bytes = (c3_y*)u3a_malloc(syz_x*sizeof(c3_y));
-    u3r_bytes(0, syz_x, x_bytes, x_data);
+    // x_bytes is the data array (w/o leading 0x1; read in place)
+    _la_view x_view;
+    c3_y* x_bytes = _la_view_get(&x_view, x_data, syz_x, bloq);
 
     // y_bytes is the data array (w/ leading 0x1, skipped by ?axpy)
-    c3_y* y_bytes = (c3_y*)u3a_malloc((syz_x+1)*sizeof(c3_y));
-    u3r_bytes(0, syz_x+1, y_bytes, y_data);
+    u3i_slab y_sab;
+    c3_y* y_bytes = _la_slab_from(&y_sab, y_data, syz_x);
     
+    c3_o nat_o = _la_nat_ok(rnd);
+
     //  Switch on the block size.
     switch (u3x_atom(bloq)) {
       case 4:
-        haxpy(len_x, (float16_t){SB_REAL16_ONE}, (float16_t*)x_bytes, 1, (float16_t*)y_bytes, 1, _la_rnd);
+        if ( c3y == nat_o ) {
+          _la_nat_h(_la_nat_add, len_x, x_bytes, y_bytes, 1, y_bytes, _la_nat_h_add);
+          break;
+        }
+        haxpy(len_x, (float16_t){SB_REAL16_ONE}, (float16_t*)x_bytes, 1, (float16_t*)y_bytes, 1, rnd);
         break;
 
       case 5:
-        saxpy(len_x, (float32_t){SB_REAL32_ONE}, (float32_t*)x_bytes, 1, (float32_t*)y_bytes, 1, _la_rnd);
+        if ( c3y == nat_o ) {
+          _la_nat_s(_la_nat_add, len_x, x_bytes, y_bytes, 1, y_bytes, _la_nat_s_add);
+          break;
+        }
+        saxpy(len_x, (float32_t){SB_REAL32_ONE}, (float32_t*)x_bytes, 1, (float32_t*)y_bytes, 1, rnd);
         break;
 
       case 6:
-        daxpy(len_x, (float64_t){SB_REAL64_ONE}, (float64_t*)x_bytes, 1, (float64_t*)y_bytes, 1, _la_rnd);
+        if ( c3y == nat_o ) {
+          _la_nat_d(_la_nat_add, len_x, x_bytes, y_bytes, 1, y_bytes, _la_nat_d_add);
+          break;
+        }
+        daxpy(len_x, (float64_t){SB_REAL64_ONE}, (float64_t*)x_bytes, 1, (float64_t*)y_bytes, 1, rnd);
         break;
 
       case 7:
-        qaxpy(len_x, (float128_t){SB_REAL128L_ONE,SB_REAL128U_ONE}, (float128_t*)x_bytes, 1, (float128_t*)y_bytes, 1, _la_rnd);
+        qaxpy(len_x, (float128_t){SB_REAL128L_ONE,SB_REAL128U_ONE}, (float128_t*)x_bytes, 1, (float128_t*)y_bytes, 1, rnd);
         break;
     }
 
     // r_data is the result noun of [data]
-    u3_noun r_data = u3i_bytes((syz_x+1)*sizeof(c3_y), y_bytes);
+    u3_noun r_data = _la_mint(&y_sab);
 
     //  Clean up and return.
-    u3a_free(x_bytes);
-    u3a_free(y_bytes);
+    _la_view_put(&x_view);
 
-    return r_data;
+    return _la_sf_pop(sof_y, r_data);
   }
 
 /* sub - axpy = -1*y+x
@@ -196,12 +540,15 @@
   u3qi_la_sub_i754(u3_noun x_data,
                    u3_noun y_data,
                    u3_noun shape,
-                   u3_noun bloq
+                   u3_noun bloq,
+                   c3_y    rnd
                    )
   {
+    c3_y sof_y = _la_sf_push(rnd);
+
     //  Fence on valid bloq size.
     if (bloq < 4 || bloq > 7) {
-      return u3_none;
+      return _la_sf_pop(sof_y, u3_none);
     }
 
     //  Unpack the data as a byte array.  We assume total length < 2**64.
@@ -212,40 +559,53 @@
     c3_d syz_x = len_x * pow(2, bloq-3);
 
     // x_bytes is the data array (w/ leading 0x1, skipped by ?axpy; holds result)
-    c3_y* x_bytes = (c3_y*)u3a_malloc((syz_x+1)*sizeof(c3_y));
-    u3r_bytes(0, syz_x+1, x_bytes, x_data);
+    u3i_slab x_sab;
+    c3_y* x_bytes = _la_slab_from(&x_sab, x_data, syz_x);
 
-    // y_bytes is the data array (w/o leading 0x1)
-    c3_y* y_bytes = (c3_y*)u3a_malloc(syz_x*sizeof(c3_y));
-    u3r_bytes(0, syz_x, y_bytes, y_data);
+    // y_bytes is the data array (w/o leading 0x1; read in place)
+    _la_view y_view;
+    c3_y* y_bytes = _la_view_get(&y_view, y_data, syz_x, bloq);
+
+    c3_o nat_o = _la_nat_ok(rnd);
 
     //  Switch on the block size.  Computes x_bytes := -1*y + x = x - y.
     switch (u3x_atom(bloq)) {
       case 4:
-        haxpy(len_x, (float16_t){SB_REAL16_NEGONE}, (float16_t*)y_bytes, 1, (float16_t*)x_bytes, 1, _la_rnd);
+        if ( c3y == nat_o ) {
+          _la_nat_h(_la_nat_sub, len_x, x_bytes, y_bytes, 1, x_bytes, _la_nat_h_sub);
+          break;
+        }
+        haxpy(len_x, (float16_t){SB_REAL16_NEGONE}, (float16_t*)y_bytes, 1, (float16_t*)x_bytes, 1, rnd);
         break;
 
       case 5:
-        saxpy(len_x, (float32_t){SB_REAL32_NEGONE}, (float32_t*)y_bytes, 1, (float32_t*)x_bytes, 1, _la_rnd);
+        if ( c3y == nat_o ) {
+          _la_nat_s(_la_nat_sub, len_x, x_bytes, y_bytes, 1, x_bytes, _la_nat_s_sub);
+          break;
+        }
+        saxpy(len_x, (float32_t){SB_REAL32_NEGONE}, (float32_t*)y_bytes, 1, (float32_t*)x_bytes, 1, rnd);
         break;
 
       case 6:
-        daxpy(len_x, (float64_t){SB_REAL64_NEGONE}, (float64_t*)y_bytes, 1, (float64_t*)x_bytes, 1, _la_rnd);
+        if ( c3y == nat_o ) {
+          _la_nat_d(_la_nat_sub, len_x, x_bytes, y_bytes, 1, x_bytes, _la_nat_d_sub);
+          break;
+        }
+        daxpy(len_x, (float64_t){SB_REAL64_NEGONE}, (float64_t*)y_bytes, 1, (float64_t*)x_bytes, 1, rnd);
         break;
 
       case 7:
-        qaxpy(len_x, (float128_t){SB_REAL128L_NEGONE,SB_REAL128U_NEGONE}, (float128_t*)y_bytes, 1, (float128_t*)x_bytes, 1, _la_rnd);
+        qaxpy(len_x, (float128_t){SB_REAL128L_NEGONE,SB_REAL128U_NEGONE}, (float128_t*)y_bytes, 1, (float128_t*)x_bytes, 1, rnd);
         break;
     }
 
     // r_data is the result noun of [data]
-    u3_noun r_data = u3i_bytes((syz_x+1)*sizeof(c3_y), x_bytes);
+    u3_noun r_data = _la_mint(&x_sab);
 
     //  Clean up and return.
-    u3a_free(x_bytes);
-    u3a_free(y_bytes);
+    _la_view_put(&y_view);
 
-    return r_data;
+    return _la_sf_pop(sof_y, r_data);
   }
 
 
@@ -256,11 +616,14 @@
   u3qi_la_mul_i754(u3_noun x_data,
                    u3_noun y_data,
                    u3_noun shape,
-                   u3_noun bloq)
+                   u3_noun bloq,
+                   c3_y    rnd)
   {
+    c3_y sof_y = _la_sf_push(rnd);
+
     //  Fence on valid bloq size.
     if (bloq < 4 || bloq > 7) {
-      return u3_none;
+      return _la_sf_pop(sof_y, u3_none);
     }
 
     //  Unpack the data as a byte array.  We assume total length < 2**64.
@@ -270,29 +633,43 @@
     // syz_x is length in bytes
     c3_d syz_x = len_x * pow(2, bloq-3);
 
-    // x_bytes is the data array (w/o leading 0x1)
-    c3_y* x_bytes = (c3_y*)u3a_malloc(syz_x*sizeof(c3_y));
-    u3r_bytes(0, syz_x, x_bytes, x_data);
+    // x_bytes is the data array (w/o leading 0x1; read in place)
+    _la_view x_view;
+    c3_y* x_bytes = _la_view_get(&x_view, x_data, syz_x, bloq);
 
     // y_bytes is the data array (w/ leading 0x1, skipped by ?axpy)
-    c3_y* y_bytes = (c3_y*)u3a_malloc((syz_x+1)*sizeof(c3_y));
-    u3r_bytes(0, syz_x+1, y_bytes, y_data);
+    u3i_slab y_sab;
+    c3_y* y_bytes = _la_slab_from(&y_sab, y_data, syz_x);
+
+    c3_o nat_o = _la_nat_ok(rnd);
 
     //  Switch on the block size.
     switch (u3x_atom(bloq)) {
       case 4:
+        if ( c3y == nat_o ) {
+          _la_nat_h(_la_nat_mul, len_x, x_bytes, y_bytes, 1, y_bytes, _la_nat_h_mul);
+          break;
+        }
         for (c3_d i = 0; i < len_x; i++) {
           ((float16_t*)y_bytes)[i] = f16_mul(((float16_t*)x_bytes)[i], ((float16_t*)y_bytes)[i]);
         }
         break;
 
       case 5:
+        if ( c3y == nat_o ) {
+          _la_nat_s(_la_nat_mul, len_x, x_bytes, y_bytes, 1, y_bytes, _la_nat_s_mul);
+          break;
+        }
         for (c3_d i = 0; i < len_x; i++) {
           ((float32_t*)y_bytes)[i] = f32_mul(((float32_t*)x_bytes)[i], ((float32_t*)y_bytes)[i]);
         }
         break;
 
       case 6:
+        if ( c3y == nat_o ) {
+          _la_nat_d(_la_nat_mul, len_x, x_bytes, y_bytes, 1, y_bytes, _la_nat_d_mul);
+          break;
+        }
         for (c3_d i = 0; i < len_x; i++) {
           ((float64_t*)y_bytes)[i] = f64_mul(((float64_t*)x_bytes)[i], ((float64_t*)y_bytes)[i]);
         }
@@ -306,13 +683,12 @@
     }
 
     // r_data is the result noun of [data]
-    u3_noun r_data = u3i_bytes((syz_x+1)*sizeof(c3_y), y_bytes);
+    u3_noun r_data = _la_mint(&y_sab);
 
     //  Clean up and return.
-    u3a_free(x_bytes);
-    u3a_free(y_bytes);
+    _la_view_put(&x_view);
 
-    return r_data;
+    return _la_sf_pop(sof_y, r_data);
   }
 
 /* div - x/y
@@ -322,11 +698,14 @@
   u3qi_la_div_i754(u3_noun x_data,
                    u3_noun y_data,
                    u3_noun shape,
-                   u3_noun bloq)
+                   u3_noun bloq,
+                   c3_y    rnd)
   {
+    c3_y sof_y = _la_sf_push(rnd);
+
     //  Fence on valid bloq size.
     if (bloq < 4 || bloq > 7) {
-      return u3_none;
+      return _la_sf_pop(sof_y, u3_none);
     }
 
     //  Unpack the data as a byte array.  We assume total length < 2**64.
@@ -336,29 +715,43 @@
     // syz_x is length in bytes
     c3_d syz_x = len_x * pow(2, bloq-3);
 
-    // x_bytes is the data array (w/o leading 0x1)
-    c3_y* x_bytes = (c3_y*)u3a_malloc(syz_x*sizeof(c3_y));
-    u3r_bytes(0, syz_x, x_bytes, x_data);
+    // x_bytes is the data array (w/o leading 0x1; read in place)
+    _la_view x_view;
+    c3_y* x_bytes = _la_view_get(&x_view, x_data, syz_x, bloq);
 
     // y_bytes is the data array (w/ leading 0x1, skipped by ?axpy)
-    c3_y* y_bytes = (c3_y*)u3a_malloc((syz_x+1)*sizeof(c3_y));
-    u3r_bytes(0, syz_x+1, y_bytes, y_data);
+    u3i_slab y_sab;
+    c3_y* y_bytes = _la_slab_from(&y_sab, y_data, syz_x);
+
+    c3_o nat_o = _la_nat_ok(rnd);
 
     //  Switch on the block size.
     switch (u3x_atom(bloq)) {
       case 4:
+        if ( c3y == nat_o ) {
+          _la_nat_h(_la_nat_div, len_x, x_bytes, y_bytes, 1, y_bytes, _la_nat_h_div);
+          break;
+        }
         for (c3_d i = 0; i < len_x; i++) {
           ((float16_t*)y_bytes)[i] = f16_div(((float16_t*)x_bytes)[i], ((float16_t*)y_bytes)[i]);
         }
         break;
 
       case 5:
+        if ( c3y == nat_o ) {
+          _la_nat_s(_la_nat_div, len_x, x_bytes, y_bytes, 1, y_bytes, _la_nat_s_div);
+          break;
+        }
         for (c3_d i = 0; i < len_x; i++) {
           ((float32_t*)y_bytes)[i] = f32_div(((float32_t*)x_bytes)[i], ((float32_t*)y_bytes)[i]);
         }
         break;
 
       case 6:
+        if ( c3y == nat_o ) {
+          _la_nat_d(_la_nat_div, len_x, x_bytes, y_bytes, 1, y_bytes, _la_nat_d_div);
+          break;
+        }
         for (c3_d i = 0; i < len_x; i++) {
           ((float64_t*)y_bytes)[i] = f64_div(((float64_t*)x_bytes)[i], ((float64_t*)y_bytes)[i]);
         }
@@ -372,13 +765,12 @@
     }
 
     // r_data is the result noun of [data]
-    u3_noun r_data = u3i_bytes((syz_x+1)*sizeof(c3_y), y_bytes);
+    u3_noun r_data = _la_mint(&y_sab);
 
     //  Clean up and return.
-    u3a_free(x_bytes);
-    u3a_free(y_bytes);
+    _la_view_put(&x_view);
 
-    return r_data;
+    return _la_sf_pop(sof_y, r_data);
   }
 
 /* mod - x % y = x - r*floor(x/r)
@@ -388,11 +780,14 @@
   u3qi_la_mod_i754(u3_noun x_data,
                    u3_noun y_data,
                    u3_noun shape,
-                   u3_noun bloq)
+                   u3_noun bloq,
+                   c3_y    rnd)
   {
+    c3_y sof_y = _la_sf_push(rnd);
+
     //  Fence on valid bloq size.
     if (bloq < 4 || bloq > 7) {
-      return u3_none;
+      return _la_sf_pop(sof_y, u3_none);
     }
 
     //  Unpack the data as a byte array.  We assume total length < 2**64.
@@ -402,13 +797,13 @@
     // syz_x is length in bytes
     c3_d syz_x = len_x * pow(2, bloq-3);
 
-    // x_bytes is the data array (w/o leading 0x1)
-    c3_y* x_bytes = (c3_y*)u3a_malloc(syz_x*sizeof(c3_y));
-    u3r_bytes(0, syz_x, x_bytes, x_data);
+    // x_bytes is the data array (w/o leading 0x1; read in place)
+    _la_view x_view;
+    c3_y* x_bytes = _la_view_get(&x_view, x_data, syz_x, bloq);
 
     // y_bytes is the data array (w/ leading 0x1, skipped by ?axpy)
-    c3_y* y_bytes = (c3_y*)u3a_malloc((syz_x+1)*sizeof(c3_y));
-    u3r_bytes(0, syz_x+1, y_bytes, y_data);
+    u3i_slab y_sab;
+    c3_y* y_bytes = _la_slab_from(&y_sab, y_data, syz_x);
 
     //  Switch on the block size.
     switch (u3x_atom(bloq)) {
@@ -493,13 +888,12 @@
     }
 
     // r_data is the result noun of [data]
-    u3_noun r_data = u3i_bytes((syz_x+1)*sizeof(c3_y), y_bytes);
+    u3_noun r_data = _la_mint(&y_sab);
 
     //  Clean up and return.
-    u3a_free(x_bytes);
-    u3a_free(y_bytes);
+    _la_view_put(&x_view);
 
-    return r_data;
+    return _la_sf_pop(sof_y, r_data);
   }
 
 /* cumsum - x[0] + x[1] + ... x[n]
@@ -507,11 +901,14 @@
   u3_noun
   u3qi_la_cumsum_i754(u3_noun x_data,
                       u3_noun shape,
-                      u3_noun bloq)
+                      u3_noun bloq,
+                      c3_y    rnd)
   {
+    c3_y sof_y = _la_sf_push(rnd);
+
     //  Fence on valid bloq size.
     if (bloq < 4 || bloq > 7) {
-      return u3_none;
+      return _la_sf_pop(sof_y, u3_none);
     }
 
     //  Unpack the data as a byte array.  We assume total length < 2**64.
@@ -521,9 +918,9 @@
     // syz_x is length in bytes
     c3_d syz_x = len_x * pow(2, bloq-3);
 
-    // y_bytes is the data array (w/ leading 0x1, skipped by for range)
-    c3_y* x_bytes = (c3_y*)u3a_malloc((syz_x+1)*sizeof(c3_y));
-    u3r_bytes(0, syz_x+1, x_bytes, x_data);
+    // x_bytes is the data array (w/o leading 0x1; read in place)
+    _la_view x_view;
+    c3_y* x_bytes = _la_view_get(&x_view, x_data, syz_x, bloq);
 
     u3_noun r_data;
 
@@ -536,7 +933,7 @@
           sum16[0] = f16_add(sum16[0], ((float16_t*)x_bytes)[i-1]);
         }
         sum16[1].v = 0x1;
-        r_data = u3i_bytes((2+1)*sizeof(c3_y), (c3_y*)sum16);
+        r_data = _la_ibytes((2+1)*sizeof(c3_y), (c3_y*)sum16);
         break;}
 
       case 5: {
@@ -546,7 +943,7 @@
           sum32[0] = f32_add(sum32[0], ((float32_t*)x_bytes)[i-1]);
         }
         sum32[1].v = 0x1;
-        r_data = u3i_bytes((4+1)*sizeof(c3_y), (c3_y*)sum32);
+        r_data = _la_ibytes((4+1)*sizeof(c3_y), (c3_y*)sum32);
         break;}
 
       case 6: {
@@ -556,7 +953,7 @@
           sum64[0] = f64_add(sum64[0], ((float64_t*)x_bytes)[i-1]);
         }
         sum64[1].v = 0x1;
-        r_data = u3i_bytes((8+1)*sizeof(c3_y), (c3_y*)sum64);
+        r_data = _la_ibytes((8+1)*sizeof(c3_y), (c3_y*)sum64);
         break;}
 
       case 7: {
@@ -566,14 +963,14 @@
           f128M_add(&(sum128[0]), &(((float128_t*)x_bytes)[i-1]), &(sum128[0]));
         }
         sum128[1] = (float128_t){0x1, 0x0};
-        r_data = u3i_bytes((16+1)*sizeof(c3_y), (c3_y*)sum128);
+        r_data = _la_ibytes((16+1)*sizeof(c3_y), (c3_y*)sum128);
         break;}
     }
 
     //  Clean up and return.
-    u3a_free(x_bytes);
+    _la_view_put(&x_view);
 
-    return r_data;
+    return _la_sf_pop(sof_y, r_data);
   }
 
 /* argmin - argmin(x)
@@ -595,9 +992,9 @@
     // syz_x is length in bytes
     c3_d syz_x = len_x * pow(2, bloq-3);
 
-    // x_bytes is the data array (w/o leading 0x1, which doesn't matter here)
-    c3_y* x_bytes = (c3_y*)u3a_malloc(syz_x*sizeof(c3_y));
-    u3r_bytes(0, syz_x, x_bytes, x_data);
+    // x_bytes is the data array (w/o leading 0x1; read in place)
+    _la_view x_view;
+    c3_y* x_bytes = _la_view_get(&x_view, x_data, syz_x, bloq);
 
     c3_d min_idx = 0;
 
@@ -644,6 +1041,8 @@
         break;}
     }
 
+    _la_view_put(&x_view);
+
     u3_noun r_data = u3i_chub(min_idx);
 
     return r_data;
@@ -668,9 +1067,9 @@
     // syz_x is length in bytes
     c3_d syz_x = len_x * pow(2, bloq-3);
 
-    // x_bytes is the data array (w/o leading 0x1, which doesn't matter here)
-    c3_y* x_bytes = (c3_y*)u3a_malloc(syz_x*sizeof(c3_y));
-    u3r_bytes(0, syz_x, x_bytes, x_data);
+    // x_bytes is the data array (w/o leading 0x1; read in place)
+    _la_view x_view;
+    c3_y* x_bytes = _la_view_get(&x_view, x_data, syz_x, bloq);
 
     c3_d max_idx = 0;
 
@@ -717,6 +1116,8 @@
         break;}
     }
 
+    _la_view_put(&x_view);
+
     u3_noun r_data = u3i_chub(max_idx);
 
     return r_data;
@@ -742,9 +1143,9 @@
     // syz_x is length in bytes
     c3_d syz_x = len_x * pow(2, bloq-3);
 
-    // x_bytes is the data array (w/o leading 0x1)
-    c3_y* x_bytes = (c3_y*)u3a_malloc(syz_x*sizeof(c3_y));
-    u3r_bytes(0, syz_x, x_bytes, x_data);
+    // x_bytes is the data array (w/o leading 0x1; read in place)
+    _la_view x_view;
+    c3_y* x_bytes = _la_view_get(&x_view, x_data, syz_x, bloq);
 
     // r_data is the result noun of [data]
     u3_noun r_data = u3_nul;
@@ -781,7 +1182,7 @@
     }
 
     //  Clean up and return.
-    u3a_free(x_bytes);
+    _la_view_put(&x_view);
 
     return r_data;
   }
@@ -805,9 +1206,9 @@
     // syz_x is length in bytes
     c3_d syz_x = len_x * pow(2, bloq-3);
 
-    // x_bytes is the data array (w/ leading 0x1, skipped by for range)
-    c3_y* x_bytes = (c3_y*)u3a_malloc((syz_x+1)*sizeof(c3_y));
-    u3r_bytes(0, syz_x+1, x_bytes, x_data);
+    // x_bytes is the data array (w/o leading 0x1; read in place)
+    _la_view x_view;
+    c3_y* x_bytes = _la_view_get(&x_view, x_data, syz_x, bloq);
 
     u3_noun r_data;
 
@@ -821,7 +1222,7 @@
         float16_t r16[2];
         r16[0] = min_val16;
         r16[1].v = 0x1;
-        r_data = u3i_bytes((2+1)*sizeof(c3_y), (c3_y*)r16);
+        r_data = _la_ibytes((2+1)*sizeof(c3_y), (c3_y*)r16);
         break;}
 
       case 5: {
@@ -832,7 +1233,7 @@
         float32_t r32[2];
         r32[0] = min_val32;
         r32[1].v = 0x1;
-        r_data = u3i_bytes((4+1)*sizeof(c3_y), (c3_y*)r32);
+        r_data = _la_ibytes((4+1)*sizeof(c3_y), (c3_y*)r32);
         break;}
 
       case 6: {
@@ -843,7 +1244,7 @@
         float64_t r64[2];
         r64[0] = min_val64;
         r64[1].v = 0x1;
-        r_data = u3i_bytes((8+1)*sizeof(c3_y), (c3_y*)r64);
+        r_data = _la_ibytes((8+1)*sizeof(c3_y), (c3_y*)r64);
         break;}
 
       case 7: {
@@ -854,12 +1255,12 @@
         float128_t r128[2];
         r128[0] = min_val128;
         r128[1] = (float128_t){0x1, 0x0};
-        r_data = u3i_bytes((16+1)*sizeof(c3_y), (c3_y*)r128);
+        r_data = _la_ibytes((16+1)*sizeof(c3_y), (c3_y*)r128);
         break;}
     }
 
     //  Clean up and return.
-    u3a_free(x_bytes);
+    _la_view_put(&x_view);
 
     return r_data;
   }
@@ -883,9 +1284,9 @@
     // syz_x is length in bytes
     c3_d syz_x = len_x * pow(2, bloq-3);
 
-    // x_bytes is the data array (w/ leading 0x1, skipped by for range)
-    c3_y* x_bytes = (c3_y*)u3a_malloc((syz_x+1)*sizeof(c3_y));
-    u3r_bytes(0, syz_x+1, x_bytes, x_data);
+    // x_bytes is the data array (w/o leading 0x1; read in place)
+    _la_view x_view;
+    c3_y* x_bytes = _la_view_get(&x_view, x_data, syz_x, bloq);
 
     u3_noun r_data;
 
@@ -899,7 +1300,7 @@
         float16_t r16[2];
         r16[0] = max_val16;
         r16[1].v = 0x1;
-        r_data = u3i_bytes((2+1)*sizeof(c3_y), (c3_y*)r16);
+        r_data = _la_ibytes((2+1)*sizeof(c3_y), (c3_y*)r16);
         break;}
 
       case 5: {
@@ -910,7 +1311,7 @@
         float32_t r32[2];
         r32[0] = max_val32;
         r32[1].v = 0x1;
-        r_data = u3i_bytes((4+1)*sizeof(c3_y), (c3_y*)r32);
+        r_data = _la_ibytes((4+1)*sizeof(c3_y), (c3_y*)r32);
         break;}
 
       case 6: {
@@ -921,7 +1322,7 @@
         float64_t r64[2];
         r64[0] = max_val64;
         r64[1].v = 0x1;
-        r_data = u3i_bytes((8+1)*sizeof(c3_y), (c3_y*)r64);
+        r_data = _la_ibytes((8+1)*sizeof(c3_y), (c3_y*)r64);
         break;}
 
       case 7: {
@@ -932,12 +1333,12 @@
         float128_t r128[2];
         r128[0] = max_val128;
         r128[1] = (float128_t){0x1, 0x0};
-        r_data = u3i_bytes((16+1)*sizeof(c3_y), (c3_y*)r128);
+        r_data = _la_ibytes((16+1)*sizeof(c3_y), (c3_y*)r128);
         break;}
     }
 
     //  Clean up and return.
-    u3a_free(x_bytes);
+    _la_view_put(&x_view);
 
     return r_data;
   }
@@ -962,8 +1363,8 @@
     c3_d syz_x = len_x * pow(2, bloq-3);
 
     // x_bytes is the data array (w/ leading 0x1, skipped by for range)
-    c3_y* x_bytes = (c3_y*)u3a_malloc((syz_x+1)*sizeof(c3_y));
-    u3r_bytes(0, syz_x+1, x_bytes, x_data);
+    u3i_slab x_sab;
+    c3_y* x_bytes = _la_slab_from(&x_sab, x_data, syz_x);
 
     //  Switch on the block size.
     switch (u3x_atom(bloq)) {
@@ -993,10 +1394,9 @@
     }
 
     // r_data is the result noun of [data]
-    u3_noun r_data = u3i_bytes((syz_x+1)*sizeof(c3_y), x_bytes);
+    u3_noun r_data = _la_mint(&x_sab);
 
     //  Clean up and return.
-    u3a_free(x_bytes);
 
     return r_data;
   }
@@ -1021,13 +1421,13 @@
     // syz_x is length in bytes
     c3_d syz_x = len_x * pow(2, bloq-3);
 
-    // x_bytes is the data array (w/o leading 0x1)
-    c3_y* x_bytes = (c3_y*)u3a_malloc(syz_x*sizeof(c3_y));
-    u3r_bytes(0, syz_x, x_bytes, x_data);
+    // x_bytes is the data array (w/o leading 0x1; read in place)
+    _la_view x_view;
+    c3_y* x_bytes = _la_view_get(&x_view, x_data, syz_x, bloq);
 
     // y_bytes is the data array (w/ leading 0x1, skipped by ?axpy)
-    c3_y* y_bytes = (c3_y*)u3a_malloc((syz_x+1)*sizeof(c3_y));
-    u3r_bytes(0, syz_x+1, y_bytes, y_data);
+    u3i_slab y_sab;
+    c3_y* y_bytes = _la_slab_from(&y_sab, y_data, syz_x);
 
     //  Switch on the block size.
     switch (u3x_atom(bloq)) {
@@ -1065,11 +1465,10 @@
     }
 
     // r_data is the result noun of [data]
-    u3_noun r_data = u3i_bytes((syz_x+1)*sizeof(c3_y), y_bytes);
+    u3_noun r_data = _la_mint(&y_sab);
 
     //  Clean up and return.
-    u3a_free(x_bytes);
-    u3a_free(y_bytes);
+    _la_view_put(&x_view);
 
     return r_data;
   }
@@ -1094,13 +1493,13 @@
     // syz_x is length in bytes
     c3_d syz_x = len_x * pow(2, bloq-3);
 
-    // x_bytes is the data array (w/o leading 0x1)
-    c3_y* x_bytes = (c3_y*)u3a_malloc(syz_x*sizeof(c3_y));
-    u3r_bytes(0, syz_x, x_bytes, x_data);
+    // x_bytes is the data array (w/o leading 0x1; read in place)
+    _la_view x_view;
+    c3_y* x_bytes = _la_view_get(&x_view, x_data, syz_x, bloq);
 
     // y_bytes is the data array (w/ leading 0x1, skipped by ?axpy)
-    c3_y* y_bytes = (c3_y*)u3a_malloc((syz_x+1)*sizeof(c3_y));
-    u3r_bytes(0, syz_x+1, y_bytes, y_data);
+    u3i_slab y_sab;
+    c3_y* y_bytes = _la_slab_from(&y_sab, y_data, syz_x);
 
     //  Switch on the block size.
     switch (u3x_atom(bloq)) {
@@ -1138,11 +1537,10 @@
     }
 
     // r_data is the result noun of [data]
-    u3_noun r_data = u3i_bytes((syz_x+1)*sizeof(c3_y), y_bytes);
+    u3_noun r_data = _la_mint(&y_sab);
 
     //  Clean up and return.
-    u3a_free(x_bytes);
-    u3a_free(y_bytes);
+    _la_view_put(&x_view);
 
     return r_data;
   }
@@ -1167,13 +1565,13 @@
     // syz_x is length in bytes
     c3_d syz_x = len_x * pow(2, bloq-3);
 
-    // x_bytes is the data array (w/o leading 0x1)
-    c3_y* x_bytes = (c3_y*)u3a_malloc(syz_x*sizeof(c3_y));
-    u3r_bytes(0, syz_x, x_bytes, x_data);
+    // x_bytes is the data array (w/o leading 0x1; read in place)
+    _la_view x_view;
+    c3_y* x_bytes = _la_view_get(&x_view, x_data, syz_x, bloq);
 
     // y_bytes is the data array (w/ leading 0x1, skipped by ?axpy)
-    c3_y* y_bytes = (c3_y*)u3a_malloc((syz_x+1)*sizeof(c3_y));
-    u3r_bytes(0, syz_x+1, y_bytes, y_data);
+    u3i_slab y_sab;
+    c3_y* y_bytes = _la_slab_from(&y_sab, y_data, syz_x);
 
     //  Switch on the block size.
     switch (u3x_atom(bloq)) {
@@ -1211,11 +1609,10 @@
     }
 
     // r_data is the result noun of [data]
-    u3_noun r_data = u3i_bytes((syz_x+1)*sizeof(c3_y), y_bytes);
+    u3_noun r_data = _la_mint(&y_sab);
 
     //  Clean up and return.
-    u3a_free(x_bytes);
-    u3a_free(y_bytes);
+    _la_view_put(&x_view);
 
     return r_data;
   }
@@ -1240,13 +1637,13 @@
     // syz_x is length in bytes
     c3_d syz_x = len_x * pow(2, bloq-3);
 
-    // x_bytes is the data array (w/o leading 0x1)
-    c3_y* x_bytes = (c3_y*)u3a_malloc(syz_x*sizeof(c3_y));
-    u3r_bytes(0, syz_x, x_bytes, x_data);
+    // x_bytes is the data array (w/o leading 0x1; read in place)
+    _la_view x_view;
+    c3_y* x_bytes = _la_view_get(&x_view, x_data, syz_x, bloq);
 
     // y_bytes is the data array (w/ leading 0x1, skipped by ?axpy)
-    c3_y* y_bytes = (c3_y*)u3a_malloc((syz_x+1)*sizeof(c3_y));
-    u3r_bytes(0, syz_x+1, y_bytes, y_data);
+    u3i_slab y_sab;
+    c3_y* y_bytes = _la_slab_from(&y_sab, y_data, syz_x);
 
     //  Switch on the block size.
     switch (u3x_atom(bloq)) {
@@ -1284,11 +1681,10 @@
     }
 
     // r_data is the result noun of [data]
-    u3_noun r_data = u3i_bytes((syz_x+1)*sizeof(c3_y), y_bytes);
+    u3_noun r_data = _la_mint(&y_sab);
 
     //  Clean up and return.
-    u3a_free(x_bytes);
-    u3a_free(y_bytes);
+    _la_view_put(&x_view);
 
     return r_data;
   }
@@ -1299,11 +1695,14 @@
   u3qi_la_adds_i754(u3_noun x_data,
                     u3_noun n,
                     u3_noun shape,
-                    u3_noun bloq)
+                    u3_noun bloq,
+                    c3_y    rnd)
   {
+    c3_y sof_y = _la_sf_push(rnd);
+
     //  Fence on valid bloq size.
     if (bloq < 4 || bloq > 7) {
-      return u3_none;
+      return _la_sf_pop(sof_y, u3_none);
     }
 
     //  Unpack the data as a byte array.  We assume total length < 2**64.
@@ -1313,66 +1712,79 @@
     // syz_x is length in bytes
     c3_d syz_x = len_x * pow(2, bloq-3);
 
-    // x_bytes is the data array (w/o leading 0x1)
-    c3_y* x_bytes = (c3_y*)u3a_malloc(syz_x*sizeof(c3_y));
-    u3r_bytes(0, syz_x, x_bytes, x_data);
+    // x_bytes is the data array (w/o leading 0x1; read in place)
+    _la_view x_view;
+    c3_y* x_bytes = _la_view_get(&x_view, x_data, syz_x, bloq);
 
     // y_bytes is the data array (w/ leading 0x1, skipped by ?axpy)
-    c3_y* y_bytes = (c3_y*)u3a_malloc((syz_x+1)*sizeof(c3_y));
+    u3i_slab y_sab;
+    c3_y* y_bytes = _la_slab_bare(&y_sab, syz_x);
 
     float16_t n16;
     float32_t n32;
     float64_t n64;
     float128_t n128;
 
+    c3_o nat_o = _la_nat_ok(rnd);
+
     //  Switch on the block size.  We assume that n fits in the target block size; Hoon typecheck should prevent.
     switch (u3x_atom(bloq)) {
       case 4:
-        u3r_bytes(0, 2, (c3_y*)&(n16.v), n);
+        _la_rbytes(0, 2, (c3_y*)&(n16.v), n);
+        if ( c3y == nat_o ) {
+          _la_nat_h(_la_nat_add, len_x, x_bytes, (c3_y*)&n16, 0, y_bytes, _la_nat_h_add);
+          break;
+        }
         // set y to [n]
         for (c3_d i = 0; i < len_x; i++) {
           ((float16_t*)y_bytes)[i] = n16;
         }
-        haxpy(len_x, (float16_t){SB_REAL16_ONE}, (float16_t*)x_bytes, 1, (float16_t*)y_bytes, 1, _la_rnd);
+        haxpy(len_x, (float16_t){SB_REAL16_ONE}, (float16_t*)x_bytes, 1, (float16_t*)y_bytes, 1, rnd);
         break;
 
       case 5:
-        u3r_bytes(0, 4, (c3_y*)&(n32.v), n);
+        _la_rbytes(0, 4, (c3_y*)&(n32.v), n);
+        if ( c3y == nat_o ) {
+          _la_nat_s(_la_nat_add, len_x, x_bytes, (c3_y*)&n32, 0, y_bytes, _la_nat_s_add);
+          break;
+        }
         // set y to [n]
         for (c3_d i = 0; i < len_x; i++) {
           ((float32_t*)y_bytes)[i] = n32;
         }
-        saxpy(len_x, (float32_t){SB_REAL32_ONE}, (float32_t*)x_bytes, 1, (float32_t*)y_bytes, 1, _la_rnd);
+        saxpy(len_x, (float32_t){SB_REAL32_ONE}, (float32_t*)x_bytes, 1, (float32_t*)y_bytes, 1, rnd);
         break;
 
       case 6:
-        u3r_bytes(0, 8, (c3_y*)&(n64.v), n);
+        _la_rbytes(0, 8, (c3_y*)&(n64.v), n);
+        if ( c3y == nat_o ) {
+          _la_nat_d(_la_nat_add, len_x, x_bytes, (c3_y*)&n64, 0, y_bytes, _la_nat_d_add);
+          break;
+        }
         // set y to [n]
         for (c3_d i = 0; i < len_x; i++) {
           ((float64_t*)y_bytes)[i] = n64;
         }
-        daxpy(len_x, (float64_t){SB_REAL64_ONE}, (float64_t*)x_bytes, 1, (float64_t*)y_bytes, 1, _la_rnd);
+        daxpy(len_x, (float64_t){SB_REAL64_ONE}, (float64_t*)x_bytes, 1, (float64_t*)y_bytes, 1, rnd);
         break;
 
       case 7:
-        u3r_bytes(0, 16, (c3_y*)&(n128.v[0]), n);
+        _la_rbytes(0, 16, (c3_y*)&(n128.v[0]), n);
         // set y to [n]
         for (c3_d i = 0; i < len_x; i++) {
           ((float128_t*)y_bytes)[i] = (float128_t){n128.v[0], n128.v[1]};
         }
-        qaxpy(len_x, (float128_t){SB_REAL128L_ONE,SB_REAL128U_ONE}, (float128_t*)x_bytes, 1, (float128_t*)y_bytes, 1, _la_rnd);
+        qaxpy(len_x, (float128_t){SB_REAL128L_ONE,SB_REAL128U_ONE}, (float128_t*)x_bytes, 1, (float128_t*)y_bytes, 1, rnd);
         break;
     }
 
     // r_data is the result noun of [data]
-    y_bytes[syz_x] = 0x1;  // pin head
-    u3_noun r_data = u3i_bytes((syz_x+1)*sizeof(c3_y), y_bytes);
+    u3_noun r_data = _la_mint(&y_sab);
 
     //  Clean up and return.
-    u3a_free(x_bytes);
-    u3a_free(y_bytes);
+    _la_view_put(&x_view);
 
-    return r_data;
+    return _la_sf_pop(sof_y, r_data);
   }
 
 /* subs - axpy = -1*[n]+x
@@ -1381,11 +1793,14 @@
   u3qi_la_subs_i754(u3_noun x_data,
                     u3_noun n,
                     u3_noun shape,
-                    u3_noun bloq)
+                    u3_noun bloq,
+                    c3_y    rnd)
   {
+    c3_y sof_y = _la_sf_push(rnd);
+
     //  Fence on valid bloq size.
     if (bloq < 4 || bloq > 7) {
-      return u3_none;
+      return _la_sf_pop(sof_y, u3_none);
     }
 
     //  Unpack the data as a byte array.  We assume total length < 2**64.
@@ -1396,8 +1811,8 @@
     c3_d syz_x = len_x * pow(2, bloq-3);
 
     // x_bytes is the data array (w/ leading 0x1, skipped by ?axpy)
-    c3_y* x_bytes = (c3_y*)u3a_malloc((syz_x+1)*sizeof(c3_y));
-    u3r_bytes(0, syz_x, x_bytes, x_data);
+    u3i_slab x_sab;
+    c3_y* x_bytes = _la_slab_from(&x_sab, x_data, syz_x);
 
     // y_bytes is the data array (w/o leading 0x1)
     c3_y* y_bytes = (c3_y*)u3a_malloc(syz_x*sizeof(c3_y));
@@ -1407,54 +1822,66 @@
     float64_t n64;
     float128_t n128;
 
+    c3_o nat_o = _la_nat_ok(rnd);
+
     //  Switch on the block size.  We assume that n fits in the target block size; Hoon typecheck should prevent.
     switch (u3x_atom(bloq)) {
       case 4:
-        u3r_bytes(0, 2, (c3_y*)&(n16.v), n);
+        _la_rbytes(0, 2, (c3_y*)&(n16.v), n);
+        if ( c3y == nat_o ) {
+          _la_nat_h(_la_nat_sub, len_x, x_bytes, (c3_y*)&n16, 0, x_bytes, _la_nat_h_sub);
+          break;
+        }
         // set y to [n]
         for (c3_d i = 0; i < len_x; i++) {
           ((float16_t*)y_bytes)[i] = n16;
         }
-        haxpy(len_x, (float16_t){SB_REAL16_NEGONE}, (float16_t*)y_bytes, 1, (float16_t*)x_bytes, 1, _la_rnd);
+        haxpy(len_x, (float16_t){SB_REAL16_NEGONE}, (float16_t*)y_bytes, 1, (float16_t*)x_bytes, 1, rnd);
         break;
 
       case 5:
-        u3r_bytes(0, 4, (c3_y*)&(n32.v), n);
+        _la_rbytes(0, 4, (c3_y*)&(n32.v), n);
+        if ( c3y == nat_o ) {
+          _la_nat_s(_la_nat_sub, len_x, x_bytes, (c3_y*)&n32, 0, x_bytes, _la_nat_s_sub);
+          break;
+        }
         // set y to [n]
         for (c3_d i = 0; i < len_x; i++) {
           ((float32_t*)y_bytes)[i] = n32;
         }
-        saxpy(len_x, (float32_t){SB_REAL32_NEGONE}, (float32_t*)y_bytes, 1, (float32_t*)x_bytes, 1, _la_rnd);
+        saxpy(len_x, (float32_t){SB_REAL32_NEGONE}, (float32_t*)y_bytes, 1, (float32_t*)x_bytes, 1, rnd);
         break;
 
       case 6:
-        u3r_bytes(0, 8, (c3_y*)&(n64.v), n);
+        _la_rbytes(0, 8, (c3_y*)&(n64.v), n);
+        if ( c3y == nat_o ) {
+          _la_nat_d(_la_nat_sub, len_x, x_bytes, (c3_y*)&n64, 0, x_bytes, _la_nat_d_sub);
+          break;
+        }
         // set y to [n]
         for (c3_d i = 0; i < len_x; i++) {
           ((float64_t*)y_bytes)[i] = n64;
         }
-        daxpy(len_x, (float64_t){SB_REAL64_NEGONE}, (float64_t*)y_bytes, 1, (float64_t*)x_bytes, 1, _la_rnd);
+        daxpy(len_x, (float64_t){SB_REAL64_NEGONE}, (float64_t*)y_bytes, 1, (float64_t*)x_bytes, 1, rnd);
         break;
 
       case 7:
-        u3r_bytes(0, 16, (c3_y*)&(n128.v[0]), n);
+        _la_rbytes(0, 16, (c3_y*)&(n128.v[0]), n);
         // set y to [n]
         for (c3_d i = 0; i < len_x; i++) {
           ((float128_t*)y_bytes)[i] = (float128_t){n128.v[0], n128.v[1]};
         }
-        qaxpy(len_x, (float128_t){SB_REAL128L_NEGONE,SB_REAL128U_NEGONE}, (float128_t*)y_bytes, 1, (float128_t*)x_bytes, 1, _la_rnd);
+        qaxpy(len_x, (float128_t){SB_REAL128L_NEGONE,SB_REAL128U_NEGONE}, (float128_t*)y_bytes, 1, (float128_t*)x_bytes, 1, rnd);
         break;
     }
 
     // r_data is the result noun of [data]
-    x_bytes[syz_x] = 0x1;  // pin head
-    u3_noun r_data = u3i_bytes((syz_x+1)*sizeof(c3_y), x_bytes);
+    u3_noun r_data = _la_mint(&x_sab);
 
     //  Clean up and return.
-    u3a_free(x_bytes);
     u3a_free(y_bytes);
 
-    return r_data;
+    return _la_sf_pop(sof_y, r_data);
   }
 
 /* muls - ?scal n * x
@@ -1464,11 +1891,14 @@
   u3qi_la_muls_i754(u3_noun x_data,
                     u3_noun n,
                     u3_noun shape,
-                    u3_noun bloq)
+                    u3_noun bloq,
+                    c3_y    rnd)
   {
+    c3_y sof_y = _la_sf_push(rnd);
+
     //  Fence on valid bloq size.
     if (bloq < 4 || bloq > 7) {
-      return u3_none;
+      return _la_sf_pop(sof_y, u3_none);
     }
 
     //  Unpack the data as a byte array.  We assume total length < 2**64.
@@ -1479,45 +1909,57 @@
     c3_d syz_x = len_x * pow(2, bloq-3);
 
     // x_bytes is the data array (w/ leading 0x1, skipped by ?axpy)
-    c3_y* x_bytes = (c3_y*)u3a_malloc((syz_x+1)*sizeof(c3_y));
-    u3r_bytes(0, syz_x, x_bytes, x_data);
-    x_bytes[syz_x] = 0x1;  // pin head
+    u3i_slab x_sab;
+    c3_y* x_bytes = _la_slab_from(&x_sab, x_data, syz_x);
 
     float16_t n16;
     float32_t n32;
     float64_t n64;
     float128_t n128;
 
+    c3_o nat_o = _la_nat_ok(rnd);
+
     //  Switch on the block size.
     switch (u3x_atom(bloq)) {
       case 4:
-        u3r_bytes(0, 2, (c3_y*)&(n16.v), n);
-        hscal(len_x, n16, (float16_t*)x_bytes, 1, _la_rnd);
+        _la_rbytes(0, 2, (c3_y*)&(n16.v), n);
+        if ( c3y == nat_o ) {
+          _la_nat_h(_la_nat_mul, len_x, x_bytes, (c3_y*)&n16, 0, x_bytes, _la_nat_h_scal);
+          break;
+        }
+        hscal(len_x, n16, (float16_t*)x_bytes, 1, rnd);
         break;
 
       case 5:
-        u3r_bytes(0, 4, (c3_y*)&(n32.v), n);
-        sscal(len_x, n32, (float32_t*)x_bytes, 1, _la_rnd);
+        _la_rbytes(0, 4, (c3_y*)&(n32.v), n);
+        if ( c3y == nat_o ) {
+          _la_nat_s(_la_nat_mul, len_x, x_bytes, (c3_y*)&n32, 0, x_bytes, _la_nat_s_scal);
+          break;
+        }
+        sscal(len_x, n32, (float32_t*)x_bytes, 1, rnd);
         break;
 
       case 6:
-        u3r_bytes(0, 8, (c3_y*)&(n64.v), n);
-        dscal(len_x, n64, (float64_t*)x_bytes, 1, _la_rnd);
+        _la_rbytes(0, 8, (c3_y*)&(n64.v), n);
+        if ( c3y == nat_o ) {
+          _la_nat_d(_la_nat_mul, len_x, x_bytes, (c3_y*)&n64, 0, x_bytes, _la_nat_d_scal);
+          break;
+        }
+        dscal(len_x, n64, (float64_t*)x_bytes, 1, rnd);
         break;
 
       case 7:
-        u3r_bytes(0, 16, (c3_y*)&(n128.v[0]), n);
-        qscal(len_x, n128, (float128_t*)x_bytes, 1, _la_rnd);
+        _la_rbytes(0, 16, (c3_y*)&(n128.v[0]), n);
+        qscal(len_x, n128, (float128_t*)x_bytes, 1, rnd);
         break;
     }
 
     // r_data is the result noun of [data]
-    u3_noun r_data = u3i_bytes((syz_x+1)*sizeof(c3_y), x_bytes);
+    u3_noun r_data = _la_mint(&x_sab);
 
     //  Clean up and return.
-    u3a_free(x_bytes);
 
-    return r_data;
+    return _la_sf_pop(sof_y, r_data);
   }
 
 /* divs - ?scal 1/n * x
@@ -1527,11 +1969,14 @@
   u3qi_la_divs_i754(u3_noun x_data,
                     u3_noun n,
                     u3_noun shape,
-                    u3_noun bloq)
+                    u3_noun bloq,
+                    c3_y    rnd)
   {
+    c3_y sof_y = _la_sf_push(rnd);
+
     //  Fence on valid bloq size.
     if (bloq < 4 || bloq > 7) {
-      return u3_none;
+      return _la_sf_pop(sof_y, u3_none);
     }
 
     //  Unpack the data as a byte array.  We assume total length < 2**64.
@@ -1542,53 +1987,65 @@
     c3_d syz_x = len_x * pow(2, bloq-3);
 
     // x_bytes is the data array (w/ leading 0x1, skipped by ?axpy)
-    c3_y* x_bytes = (c3_y*)u3a_malloc((syz_x+1)*sizeof(c3_y));
-    u3r_bytes(0, syz_x, x_bytes, x_data);
-    x_bytes[syz_x] = 0x1;  // pin head
+    u3i_slab x_sab;
+    c3_y* x_bytes = _la_slab_from(&x_sab, x_data, syz_x);
 
     float16_t in16;
     float32_t in32;
     float64_t in64;
     float128_t in128;
 
+    c3_o nat_o = _la_nat_ok(rnd);
+
     //  Switch on the block size.
     switch (u3x_atom(bloq)) {
       case 4:
         //  XX note that in16 is doing double duty here
-        u3r_bytes(0, 2, (c3_y*)&(in16.v), n);
+        _la_rbytes(0, 2, (c3_y*)&(in16.v), n);
         in16 = f16_div((float16_t){SB_REAL16_ONE}, in16);
-        hscal(len_x, in16, (float16_t*)x_bytes, 1, _la_rnd);
+        if ( c3y == nat_o ) {
+          _la_nat_h(_la_nat_mul, len_x, x_bytes, (c3_y*)&in16, 0, x_bytes, _la_nat_h_scal);
+          break;
+        }
+        hscal(len_x, in16, (float16_t*)x_bytes, 1, rnd);
         break;
 
       case 5:
         //  XX note that in32 is doing double duty here
-        u3r_bytes(0, 4, (c3_y*)&(in32.v), n);
+        _la_rbytes(0, 4, (c3_y*)&(in32.v), n);
         in32 = f32_div((float32_t){SB_REAL32_ONE}, in32);
-        sscal(len_x, in32, (float32_t*)x_bytes, 1, _la_rnd);
+        if ( c3y == nat_o ) {
+          _la_nat_s(_la_nat_mul, len_x, x_bytes, (c3_y*)&in32, 0, x_bytes, _la_nat_s_scal);
+          break;
+        }
+        sscal(len_x, in32, (float32_t*)x_bytes, 1, rnd);
         break;
 
       case 6:
         //  XX note that in64 is doing double duty here
-        u3r_bytes(0, 8, (c3_y*)&(in64.v), n);
+        _la_rbytes(0, 8, (c3_y*)&(in64.v), n);
         in64 = f64_div((float64_t){SB_REAL64_ONE}, in64);
-        dscal(len_x, in64, (float64_t*)x_bytes, 1, _la_rnd);
+        if ( c3y == nat_o ) {
+          _la_nat_d(_la_nat_mul, len_x, x_bytes, (c3_y*)&in64, 0, x_bytes, _la_nat_d_scal);
+          break;
+        }
+        dscal(len_x, in64, (float64_t*)x_bytes, 1, rnd);
         break;
 
       case 7:
         //  XX note that in128 is doing double duty here
-        u3r_bytes(0, 16, (c3_y*)&(in128.v[0]), n);
+        _la_rbytes(0, 16, (c3_y*)&(in128.v[0]), n);
         f128M_div(&((float128_t){SB_REAL128L_ONE,SB_REAL128U_ONE}), &in128, &in128);
-        qscal(len_x, in128, (float128_t*)x_bytes, 1, _la_rnd);
+        qscal(len_x, in128, (float128_t*)x_bytes, 1, rnd);
         break;
     }
 
     // r_data is the result noun of [data]
-    u3_noun r_data = u3i_bytes((syz_x+1)*sizeof(c3_y), x_bytes);
+    u3_noun r_data = _la_mint(&x_sab);
 
     //  Clean up and return.
-    u3a_free(x_bytes);
 
-    return r_data;
+    return _la_sf_pop(sof_y, r_data);
   }
 
 /* mods - x % [n] = x - r*floor(x/r)
@@ -1598,11 +2055,14 @@
   u3qi_la_mods_i754(u3_noun x_data,
                     u3_noun n,
                     u3_noun shape,
-                    u3_noun bloq)
+                    u3_noun bloq,
+                    c3_y    rnd)
   {
+    c3_y sof_y = _la_sf_push(rnd);
+
     //  Fence on valid bloq size.
     if (bloq < 4 || bloq > 7) {
-      return u3_none;
+      return _la_sf_pop(sof_y, u3_none);
     }
 
     //  Unpack the data as a byte array.  We assume total length < 2**64.
@@ -1614,8 +2074,8 @@
 
     // x_bytes is the data array (w/ leading 0x1, skipped by ?axpy)
     // we reuse it for results for parsimony
-    c3_y* x_bytes = (c3_y*)u3a_malloc((syz_x+1)*sizeof(c3_y));
-    u3r_bytes(0, syz_x+1, x_bytes, x_data);
+    u3i_slab x_sab;
+    c3_y* x_bytes = _la_slab_from(&x_sab, x_data, syz_x);
 
     float16_t n16, in16;
     float32_t n32, in32;
@@ -1625,7 +2085,7 @@
     //  Switch on the block size.
     switch (u3x_atom(bloq)) {
       case 4:
-        u3r_bytes(0, 2, (c3_y*)&(n16.v), n);
+        _la_rbytes(0, 2, (c3_y*)&(n16.v), n);
         in16 = f16_div((float16_t){SB_REAL16_ONE}, n16);
 
         for (c3_d i = 0; i < len_x; i++) {
@@ -1646,7 +2106,7 @@
         break;
 
       case 5:
-        u3r_bytes(0, 4, (c3_y*)&(n32.v), n);
+        _la_rbytes(0, 4, (c3_y*)&(n32.v), n);
         in32 = f32_div((float32_t){SB_REAL32_ONE}, n32);
 
         for (c3_d i = 0; i < len_x; i++) {
@@ -1667,7 +2127,7 @@
         break;
 
       case 6:
-        u3r_bytes(0, 8, (c3_y*)&(n64.v), n);
+        _la_rbytes(0, 8, (c3_y*)&(n64.v), n);
         in64 = f64_div((float64_t){SB_REAL64_ONE}, n64);
 
         for (c3_d i = 0; i < len_x; i++) {
@@ -1688,7 +2148,7 @@
         break;
 
       case 7:
-        u3r_bytes(0, 16, (c3_y*)&(n128.v[0]), n);
+        _la_rbytes(0, 16, (c3_y*)&(n128.v[0]), n);
         f128M_div(&((float128_t){SB_REAL128L_ONE,SB_REAL128U_ONE}), &n128, &in128);
 
         for (c3_d i = 0; i < len_x; i++) {
@@ -1713,12 +2173,11 @@
     }
 
     // r_data is the result noun of [data]
-    u3_noun r_data = u3i_bytes((syz_x+1)*sizeof(c3_y), x_bytes);
+    u3_noun r_data = _la_mint(&x_sab);
 
     //  Clean up and return.
-    u3a_free(x_bytes);
 
-    return r_data;
+    return _la_sf_pop(sof_y, r_data);
   }
 
 /* dot - ?dot = x · y
@@ -1727,11 +2186,14 @@
   u3qi_la_dot_i754(u3_noun x_data,
                    u3_noun y_data,
                    u3_noun shape,
-                   u3_noun bloq)
+                   u3_noun bloq,
+                   c3_y    rnd)
   {
+    c3_y sof_y = _la_sf_push(rnd);
+
     //  Fence on valid bloq size.
     if (bloq < 4 || bloq > 7) {
-      return u3_none;
+      return _la_sf_pop(sof_y, u3_none);
     }
 
     //  Unpack the data as a byte array.  We assume total length < 2**64.
@@ -1741,13 +2203,13 @@
     // syz_x is length in bytes
     c3_d syz_x = len_x * pow(2, bloq-3);
 
-    // x_bytes is the data array (w/o leading 0x1)
-    c3_y* x_bytes = (c3_y*)u3a_malloc(syz_x*sizeof(c3_y));
-    u3r_bytes(0, syz_x, x_bytes, x_data);
+    // x_bytes is the data array (w/o leading 0x1; read in place)
+    _la_view x_view;
+    c3_y* x_bytes = _la_view_get(&x_view, x_data, syz_x, bloq);
 
-    // y_bytes is the data array (w/ leading 0x1, skipped by ?axpy)
-    c3_y* y_bytes = (c3_y*)u3a_malloc((syz_x+1)*sizeof(c3_y));
-    u3r_bytes(0, syz_x+1, y_bytes, y_data);
+    // y_bytes is the data array (w/o leading 0x1; read in place)
+    _la_view y_view;
+    c3_y* y_bytes = _la_view_get(&y_view, y_data, syz_x, bloq);
 
     u3_noun r_data;
 
@@ -1755,38 +2217,38 @@
     switch (u3x_atom(bloq)) {
       case 4: {
         float16_t r16[2];
-        r16[0] = hdot(len_x, (float16_t*)x_bytes, 1, (float16_t*)y_bytes, 1, _la_rnd);
+        r16[0] = hdot(len_x, (float16_t*)x_bytes, 1, (float16_t*)y_bytes, 1, rnd);
         r16[1].v = 0x1;
-        r_data = u3i_bytes((2+1)*sizeof(c3_y), (c3_y*)r16);
+        r_data = _la_ibytes((2+1)*sizeof(c3_y), (c3_y*)r16);
         break;}
 
       case 5: {
         float32_t r32[2];
-        r32[0] = sdot(len_x, (float32_t*)x_bytes, 1, (float32_t*)y_bytes, 1, _la_rnd);
+        r32[0] = sdot(len_x, (float32_t*)x_bytes, 1, (float32_t*)y_bytes, 1, rnd);
         r32[1].v = 0x1;
-        r_data = u3i_bytes((4+1)*sizeof(c3_y), (c3_y*)r32);
+        r_data = _la_ibytes((4+1)*sizeof(c3_y), (c3_y*)r32);
         break;}
 
       case 6: {
         float64_t r64[2];
-        r64[0] = ddot(len_x, (float64_t*)x_bytes, 1, (float64_t*)y_bytes, 1, _la_rnd);
+        r64[0] = ddot(len_x, (float64_t*)x_bytes, 1, (float64_t*)y_bytes, 1, rnd);
         r64[1].v = 0x1;
-        r_data = u3i_bytes((8+1)*sizeof(c3_y), (c3_y*)r64);
+        r_data = _la_ibytes((8+1)*sizeof(c3_y), (c3_y*)r64);
         break;}
 
       case 7: {
         float128_t r128[2];
-        r128[0] = qdot(len_x, (float128_t*)x_bytes, 1, (float128_t*)y_bytes, 1, _la_rnd);
+        r128[0] = qdot(len_x, (float128_t*)x_bytes, 1, (float128_t*)y_bytes, 1, rnd);
         r128[1] = (float128_t){0x1, 0x0};
-        r_data = u3i_bytes((16+1)*sizeof(c3_y), (c3_y*)r128);
+        r_data = _la_ibytes((16+1)*sizeof(c3_y), (c3_y*)r128);
         break;}
     }
 
     //  Clean up and return.
-    u3a_free(x_bytes);
-    u3a_free(y_bytes);
+    _la_view_put(&x_view);
+    _la_view_put(&y_view);
 
-    return r_data;
+    return _la_sf_pop(sof_y, r_data);
   }
 
 /* diag - diag(x)
@@ -1814,10 +2276,11 @@
     c3_d len_x = _get_length(shape);
     c3_d syz_x = len_x * pow(2, bloq - 3);
     c3_d wyd = pow(2, bloq - 3);
-    c3_y* x_bytes = (c3_y*)u3a_malloc((syz_x+1)*sizeof(c3_y));
-    u3r_bytes(0, syz_x+1, x_bytes, x_data);
+    _la_view x_view;
+    c3_y* x_bytes = _la_view_get(&x_view, x_data, syz_x, bloq);
     c3_d syz_y = wyd * dims[1];
-    c3_y* y_bytes = (c3_y*)u3a_malloc((syz_y+1)*sizeof(c3_y));
+    u3i_slab y_sab;
+    c3_y* y_bytes = _la_slab_bare(&y_sab, syz_y);
 
     u3_noun r_data;
 
@@ -1828,18 +2291,158 @@
         y_bytes[i*wyd+k] = x_bytes[(i*dims[0]+i)*wyd+k];
       }
     }
-    y_bytes[syz_y] = 0x1;  // pin head
 
     //  Unpack the result back into a noun.
-    r_data = u3i_bytes((syz_y+1)*sizeof(c3_y), y_bytes);
+    r_data = _la_mint(&y_sab);
     
-    u3a_free(x_bytes);
-    u3a_free(y_bytes);
+    _la_view_put(&x_view);
     u3a_free(dims);
 
     return r_data;
   }
 
+/* transpose and permute - blocked lane moves
+**
+** Both run on one engine.  An axis permutation is a stack of 2-D planes,
+** one per index of the axes other than the source's contiguous (last)
+** axis and the result's; each plane is a transpose between those two.
+** A plane is halved along its longer side until the tile is at most
+** _LA_TP_LEAF lanes square (16 x 16 x 32 bytes fits L1 at every width),
+** so reads and writes both stay in cache whatever the matrix size.  The
+** tile is moved by a kernel specialized on lane width: a fixed-size
+** memcpy, which compiles to plain 1/2/4/8/16-byte loads and stores.
+*/
+#define _LA_TP_LEAF  16
+
+  typedef void (*_la_tp_leaf)(c3_d rows, c3_d cols,
+                              const c3_y* src, c3_d srs, c3_d scs,
+                              c3_y* dst, c3_d drs, c3_d dcs);
+
+#define _LA_TP(BL, WYD)                                                 \
+  static void                                                           \
+  _la_tp_b##BL(c3_d rows, c3_d cols,                                    \
+               const c3_y* src, c3_d srs, c3_d scs,                     \
+               c3_y* dst, c3_d drs, c3_d dcs)                           \
+  {                                                                     \
+    for ( c3_d i = 0; i < rows; i++ ) {                                 \
+      for ( c3_d j = 0; j < cols; j++ ) {                               \
+        memcpy(dst + (i*drs + j*dcs)*WYD,                               \
+               src + (i*srs + j*scs)*WYD, WYD);                         \
+      }                                                                 \
+    }                                                                   \
+  }
+
+  _LA_TP(3, 1)
+  _LA_TP(4, 2)
+  _LA_TP(5, 4)
+  _LA_TP(6, 8)
+  _LA_TP(7, 16)
+  _LA_TP(8, 32)
+
+  //  indexed by bloq - 3
+  static const _la_tp_leaf _la_tp_leafs[6] = {
+    _la_tp_b3, _la_tp_b4, _la_tp_b5, _la_tp_b6, _la_tp_b7, _la_tp_b8
+  };
+
+  //  dst[i*drs + j*dcs] := src[i*srs + j*scs] over a rows x cols plane
+  static void
+  _la_tp_plane(_la_tp_leaf lef, c3_d wyd, c3_d rows, c3_d cols,
+               const c3_y* src, c3_d srs, c3_d scs,
+               c3_y* dst, c3_d drs, c3_d dcs)
+  {
+    while ( (rows > _LA_TP_LEAF) || (cols > _LA_TP_LEAF) ) {
+      if ( rows >= cols ) {
+        c3_d h = rows >> 1;
+        _la_tp_plane(lef, wyd, h, cols, src, srs, scs, dst, drs, dcs);
+        src  += h*srs*wyd;
+        dst  += h*drs*wyd;
+        rows -= h;
+      }
+      else {
+        c3_d h = cols >> 1;
+        _la_tp_plane(lef, wyd, rows, h, src, srs, scs, dst, drs, dcs);
+        src  += h*scs*wyd;
+        dst  += h*dcs*wyd;
+        cols -= h;
+      }
+    }
+    lef(rows, cols, src, srs, scs, dst, drs, dcs);
+  }
+
+  //  r := x with its n axes reordered; axis k of r is axis per[k] of x
+  static void
+  _la_permute(c3_d n, const c3_d* dim, const c3_d* per, c3_d bloq,
+              const c3_y* x, c3_y* r)
+  {
+    c3_d len = 1;
+    for ( c3_d a = 0; a < n; a++ ) {
+      len *= dim[a];
+    }
+    if ( 0 == len ) {
+      return;
+    }
+
+    c3_d wyd = (c3_d)1 << (bloq - 3);
+    _la_tp_leaf lef = _la_tp_leafs[bloq - 3];
+
+    //  strides in lanes, both indexed by axis of x
+    c3_d* xst = (c3_d*)u3a_malloc(n*sizeof(c3_d));
+    c3_d* rst = (c3_d*)u3a_malloc(n*sizeof(c3_d));
+    c3_d* idx = (c3_d*)u3a_malloc(n*sizeof(c3_d));
+    c3_d  s;
+    s = 1;
+    for ( c3_d a = n; a-- > 0; ) {
+      xst[a] = s;
+      s *= dim[a];
+    }
+    s = 1;
+    for ( c3_d k = n; k-- > 0; ) {
+      rst[per[k]] = s;
+      s *= dim[per[k]];
+    }
+    memset(idx, 0, n*sizeof(c3_d));
+
+    //  u is contiguous in x, v in r
+    c3_d u = n - 1;
+    c3_d v = per[n - 1];
+    c3_d xo = 0, ro = 0;
+
+    while ( 1 ) {
+      if ( u == v ) {
+        memcpy(r + ro*wyd, x + xo*wyd, dim[u]*wyd);
+      }
+      else {
+        _la_tp_plane(lef, wyd, dim[v], dim[u],
+                     x + xo*wyd, xst[v], 1,
+                     r + ro*wyd, 1, rst[u]);
+      }
+
+      //  step the remaining axes, last fastest
+      c3_ds a = (c3_ds)n - 1;
+      for ( ; a >= 0; a-- ) {
+        if ( ((c3_d)a == u) || ((c3_d)a == v) ) {
+          continue;
+        }
+        idx[a]++;
+        xo += xst[a];
+        ro += rst[a];
+        if ( idx[a] < dim[a] ) {
+          break;
+        }
+        xo -= idx[a]*xst[a];
+        ro -= idx[a]*rst[a];
+        idx[a] = 0;
+      }
+      if ( a < 0 ) {
+        break;
+      }
+    }
+
+    u3a_free(idx);
+    u3a_free(rst);
+    u3a_free(xst);
+  }
+
 /* transpose - x'
 */
   u3_noun
@@ -1851,38 +2454,87 @@
     if (u3qb_lent(shape) != 2) {
       return u3m_bail(c3__exit);
     }
+    //  Lanes narrower than a byte go to Hoon.
+    c3_d bl = u3x_atom(bloq);
+    if ( (bl < 3) || (bl > 8) ) {
+      return u3_none;
+    }
     //  Unpack shape into an array of dimensions.
     c3_d *dims = _get_dims(shape);
+    c3_d per[2] = { 1, 0 };
 
-    //  Unpack the data as a byte array.  We assume total length < 2**64.
-    c3_d len_x = _get_length(shape);
-    c3_d syz_x = len_x * pow(2, bloq - 3);
-    c3_d wyd = pow(2, bloq - 3);
-    c3_y* x_bytes = (c3_y*)u3a_malloc((syz_x+1)*sizeof(c3_y));
-    u3r_bytes(0, syz_x+1, x_bytes, x_data);
-    c3_y* y_bytes = (c3_y*)u3a_malloc((syz_x+1)*sizeof(c3_y));
+    c3_d syz_x = _get_length(shape) << (bl - 3);
+    _la_view x_view;
+    c3_y* x_bytes = _la_view_get(&x_view, x_data, syz_x, bl);
+    u3i_slab y_sab;
+    c3_y* y_bytes = _la_slab_bare(&y_sab, syz_x);
 
-    u3_noun r_data;
+    _la_permute(2, dims, per, bl, x_bytes, y_bytes);
 
-    // Grab the index at i*n_x+j in bytes; put it at j.
-    for (c3_d i = 0; i < dims[1]; i++) {
-      for (c3_d j = 0; j < dims[0]; j++) {
-        // Scan across whole field width.
-        for (c3_y k = 0; k < wyd; k++) {
-          y_bytes[(j*dims[1]+i)*wyd+k] = x_bytes[(i*dims[0]+j)*wyd+k];
-        }
+    _la_view_put(&x_view);
+    u3a_free(dims);
+
+    return _la_mint(&y_sab);
+  }
+
+/* permute - axis k of the result is axis (snag k perm) of x
+**
+** Declines (u3_none -> Hoon, which crashes) unless perm is a permutation
+** of 0..n-1.  Result is [meta data].
+*/
+  u3_noun
+  u3qi_la_permute(u3_noun x_data,
+                  u3_noun shape,
+                  u3_noun perm,
+                  u3_noun bloq,
+                  u3_noun kind,
+                  u3_noun tail)
+  {
+    c3_d bl = u3x_atom(bloq);
+    if ( (bl < 3) || (bl > 8) ) {
+      return u3_none;
+    }
+
+    c3_d n = u3r_chub(0, u3qb_lent(shape));
+    if ( (0 == n) || (n != u3r_chub(0, u3qb_lent(perm))) ) {
+      return u3_none;
+    }
+
+    c3_d* dims = _get_dims(shape);
+    c3_d* per  = (c3_d*)u3a_malloc(n*sizeof(c3_d));
+    c3_y* see  = (c3_y*)u3a_malloc(n);
+    memset(see, 0, n);
+    for ( c3_d k = 0; k < n; k++, perm = u3t(perm) ) {
+      u3_noun p = u3h(perm);
+      if ( (c3n == u3a_is_cat(p)) || (p >= n) || see[p] ) {
+        u3a_free(see);
+        u3a_free(per);
+        u3a_free(dims);
+        return u3_none;
       }
+      see[p] = 1;
+      per[k] = p;
     }
-    y_bytes[syz_x] = 0x1;  // pin head
+    u3a_free(see);
 
-    //  Unpack the result back into a noun.
-    r_data = u3i_bytes((syz_x+1)*sizeof(c3_y), y_bytes);
+    c3_d syz_x = _get_length(shape) << (bl - 3);
+    _la_view x_view;
+    c3_y* x_bytes = _la_view_get(&x_view, x_data, syz_x, bl);
+    u3i_slab r_sab;
+    c3_y* r_bytes = _la_slab_bare(&r_sab, syz_x);
 
-    u3a_free(x_bytes);
-    u3a_free(y_bytes);
+    _la_permute(n, dims, per, bl, x_bytes, r_bytes);
+    _la_view_put(&x_view);
+
+    u3_noun r_shape = u3_nul;
+    for ( c3_d k = n; k-- > 0; ) {
+      r_shape = u3nc(u3i_chub(dims[per[k]]), r_shape);
+    }
+    u3a_free(per);
     u3a_free(dims);
 
-    return r_data;
+    return u3nc(u3nq(r_shape, u3k(bloq), u3k(kind), u3k(tail)),
+                _la_mint(&r_sab));
   }
 
 /* linspace - [a a+(b-a)/n ... b]
@@ -1891,16 +2543,19 @@
   u3qi_la_linspace_i754(u3_noun a,
                         u3_noun b,
                         u3_noun n,
-                        u3_noun bloq)
+                        u3_noun bloq,
+                        c3_y    rnd)
   {
+    c3_y sof_y = _la_sf_push(rnd);
+
     //  Fence on valid bloq size.
     if (bloq < 4 || bloq > 7) {
-      return u3_none;
+      return _la_sf_pop(sof_y, u3_none);
     }
 
     //  Guard degenerate count: n = 0 underflows n-1 and writes out of bounds.
     if (n < 1) {
-      return u3_none;
+      return _la_sf_pop(sof_y, u3_none);
     }
 
     u3_noun r_data;
@@ -1908,67 +2563,65 @@
     switch (u3x_atom(bloq)) {
       case 4: {
         float16_t a16, b16;
-        u3r_bytes(0, 2, (c3_y*)&(a16.v), a);
-        u3r_bytes(0, 2, (c3_y*)&(b16.v), b);
+        _la_rbytes(0, 2, (c3_y*)&(a16.v), a);
+        _la_rbytes(0, 2, (c3_y*)&(b16.v), b);
         float16_t span16 = f16_sub(b16, a16);
         float16_t interval16 = f16_div(span16, i32_to_f16(n-1));
-        c3_y* x_bytes16 = (c3_y*)u3a_malloc((n*2+1)*sizeof(c3_y));
+        u3i_slab x_sab;
+        c3_y* x_bytes16 = _la_slab_bare(&x_sab, n*2);
         for (c3_d i = 1; i < n-1; i++) {
           ((float16_t*)x_bytes16)[i] = f16_add(a16, f16_mul(i32_to_f16(i), interval16));
         }
         //  Assign in reverse order so that n=1 case is correctly left-hand bound.
         ((float16_t*)x_bytes16)[n-1] = b16;
         ((float16_t*)x_bytes16)[0] = a16;
-        x_bytes16[n*2] = 0x1;  // pin head
-        r_data = u3i_bytes((n*2+1)*sizeof(c3_y), x_bytes16);
-        u3a_free(x_bytes16);
+        r_data = _la_mint(&x_sab);
         break;}
       
       case 5: {
         float32_t a32, b32;
-        u3r_bytes(0, 4, (c3_y*)&(a32.v), a);
-        u3r_bytes(0, 4, (c3_y*)&(b32.v), b);
+        _la_rbytes(0, 4, (c3_y*)&(a32.v), a);
+        _la_rbytes(0, 4, (c3_y*)&(b32.v), b);
         float32_t span32 = f32_sub(b32, a32);
         float32_t interval32 = f32_div(span32, i32_to_f32(n-1));
-        c3_y* x_bytes32 = (c3_y*)u3a_malloc((n*4+1)*sizeof(c3_y));
+        u3i_slab x_sab;
+        c3_y* x_bytes32 = _la_slab_bare(&x_sab, n*4);
         for (c3_d i = 1; i < n-1; i++) {
           ((float32_t*)x_bytes32)[i] = f32_add(a32, f32_mul(i32_to_f32(i), interval32));
         }
         ((float32_t*)x_bytes32)[n-1] = b32;
         ((float32_t*)x_bytes32)[0] = a32;
-        x_bytes32[n*4] = 0x1;  // pin head
-        r_data = u3i_bytes((n*4+1)*sizeof(c3_y), x_bytes32);
-        u3a_free(x_bytes32);
+        r_data = _la_mint(&x_sab);
         break;}
 
       case 6: {
         float64_t a64, b64;
-        u3r_bytes(0, 8, (c3_y*)&(a64.v), a);
-        u3r_bytes(0, 8, (c3_y*)&(b64.v), b);
+        _la_rbytes(0, 8, (c3_y*)&(a64.v), a);
+        _la_rbytes(0, 8, (c3_y*)&(b64.v), b);
         float64_t span64 = f64_sub(b64, a64);
         float64_t interval64 = f64_div(span64, i32_to_f64(n-1));
-        c3_y* x_bytes64 = (c3_y*)u3a_malloc((n*8+1)*sizeof(c3_y));
+        u3i_slab x_sab;
+        c3_y* x_bytes64 = _la_slab_bare(&x_sab, n*8);
         for (c3_d i = 1; i < n-1; i++) {
           ((float64_t*)x_bytes64)[i] = f64_add(a64, f64_mul(i32_to_f64(i), interval64));
         }
         ((float64_t*)x_bytes64)[n-1] = b64;
         ((float64_t*)x_bytes64)[0] = a64;
-        x_bytes64[n*8] = 0x1;  // pin head
-        r_data = u3i_bytes((n*8+1)*sizeof(c3_y), x_bytes64);
-        u3a_free(x_bytes64);
+        r_data = _la_mint(&x_sab);
         break;}
       
       case 7: {
         float128_t a128, b128;
-        u3r_bytes(0, 16, (c3_y*)&(a128.v[0]), a);
-        u3r_bytes(0, 16, (c3_y*)&(b128.v[0]), b);
+        _la_rbytes(0, 16, (c3_y*)&(a128.v[0]), a);
+        _la_rbytes(0, 16, (c3_y*)&(b128.v[0]), b);
         float128_t span128;
         f128M_sub(&b128, &a128, &span128);
         float128_t interval128;
         float128_t n128;
         i32_to_f128M(n-1, &n128);
         f128M_div(&span128, &n128, &interval128);
-        c3_y* x_bytes128 = (c3_y*)u3a_malloc((n*16+1)*sizeof(c3_y));
+        u3i_slab x_sab;
+        c3_y* x_bytes128 = _la_slab_bare(&x_sab, n*16);
         float128_t i128;
         for (c3_d i = 1; i < n-1; i++) {
           i32_to_f128M(i, &i128);
@@ -1977,13 +2630,11 @@
         }
         ((float128_t*)x_bytes128)[n-1] = b128;
         ((float128_t*)x_bytes128)[0] = a128;
-        x_bytes128[n*16] = 0x1;  // pin head
-        r_data = u3i_bytes((n*16+1)*sizeof(c3_y), x_bytes128);
-        u3a_free(x_bytes128);
+        r_data = _la_mint(&x_sab);
         break;}
     }
 
-    return r_data;
+    return _la_sf_pop(sof_y, r_data);
   }
 
 /* range - [a a+d ... b]
@@ -1992,11 +2643,14 @@
   u3qi_la_range_i754(u3_noun a,
                      u3_noun b,
                      u3_noun d,
-                     u3_noun bloq)
+                     u3_noun bloq,
+                     c3_y    rnd)
   {
+    c3_y sof_y = _la_sf_push(rnd);
+
     //  Fence on valid bloq size.
     if (bloq < 4 || bloq > 7) {
-      return u3_none;
+      return _la_sf_pop(sof_y, u3_none);
     }
 
     u3_noun r_data;
@@ -2004,71 +2658,69 @@
     switch (u3x_atom(bloq)) {
       case 4: {
         float16_t a16, b16, interval16;
-        u3r_bytes(0, 2, (c3_y*)&(a16.v), a);
-        u3r_bytes(0, 2, (c3_y*)&(b16.v), b);
-        u3r_bytes(0, 2, (c3_y*)&(interval16.v), d);
+        _la_rbytes(0, 2, (c3_y*)&(a16.v), a);
+        _la_rbytes(0, 2, (c3_y*)&(b16.v), b);
+        _la_rbytes(0, 2, (c3_y*)&(interval16.v), d);
         c3_ds raw_n16 = f16_to_i64(f16_ceil(f16_div(f16_sub(b16, a16), interval16)), softfloat_round_minMag, false);
-        if ( raw_n16 < 1 || raw_n16 > 0xffffffff ) { return u3_none; }
+        if ( raw_n16 < 1 || raw_n16 > 0xffffffff ) { return _la_sf_pop(sof_y, u3_none); }
         c3_d n16 = raw_n16;
-        c3_y* x_bytes16 = (c3_y*)u3a_malloc(((n16+1)*2)*sizeof(c3_y));
+        u3i_slab x_sab;
+        c3_y* x_bytes16 = _la_slab_bare(&x_sab, n16*2);
         ((float16_t*)x_bytes16)[0] = a16;
         for (c3_d i = 1; i < n16; i++) {
           ((float16_t*)x_bytes16)[i] = f16_add(a16, f16_mul(i32_to_f16(i), interval16));
         }
-        ((float16_t*)x_bytes16)[n16].v = 0x1;  // pin head
-        r_data = u3i_bytes(((n16+1)*2)*sizeof(c3_y), x_bytes16);
-        u3a_free(x_bytes16);
+        r_data = _la_mint(&x_sab);
         break;}
       
       case 5: {
         float32_t a32, b32, interval32;
-        u3r_bytes(0, 4, (c3_y*)&(a32.v), a);
-        u3r_bytes(0, 4, (c3_y*)&(b32.v), b);
-        u3r_bytes(0, 4, (c3_y*)&(interval32.v), d);
+        _la_rbytes(0, 4, (c3_y*)&(a32.v), a);
+        _la_rbytes(0, 4, (c3_y*)&(b32.v), b);
+        _la_rbytes(0, 4, (c3_y*)&(interval32.v), d);
         c3_ds raw_n32 = f32_to_i64(f32_ceil(f32_div(f32_sub(b32, a32), interval32)), softfloat_round_minMag, false);
-        if ( raw_n32 < 1 || raw_n32 > 0xffffffff ) { return u3_none; }
+        if ( raw_n32 < 1 || raw_n32 > 0xffffffff ) { return _la_sf_pop(sof_y, u3_none); }
         c3_d n32 = raw_n32;
-        c3_y* x_bytes32 = (c3_y*)u3a_malloc(((n32+1)*4)*sizeof(c3_y));
+        u3i_slab x_sab;
+        c3_y* x_bytes32 = _la_slab_bare(&x_sab, n32*4);
         ((float32_t*)x_bytes32)[0] = a32;
         for (c3_d i = 1; i < n32; i++) {
           ((float32_t*)x_bytes32)[i] = f32_add(a32, f32_mul(i32_to_f32(i), interval32));
         }
-        ((float32_t*)x_bytes32)[n32].v = 0x1;  // pin head
-        r_data = u3i_bytes(((n32+1)*4)*sizeof(c3_y), x_bytes32);
-        u3a_free(x_bytes32);
+        r_data = _la_mint(&x_sab);
         break;}
 
       case 6: {
         float64_t a64, b64, interval64;
-        u3r_bytes(0, 8, (c3_y*)&(a64.v), a);
-        u3r_bytes(0, 8, (c3_y*)&(b64.v), b);
-        u3r_bytes(0, 8, (c3_y*)&(interval64.v), d);
+        _la_rbytes(0, 8, (c3_y*)&(a64.v), a);
+        _la_rbytes(0, 8, (c3_y*)&(b64.v), b);
+        _la_rbytes(0, 8, (c3_y*)&(interval64.v), d);
         c3_ds raw_n64 = f64_to_i64(f64_ceil(f64_div(f64_sub(b64, a64), interval64)), softfloat_round_minMag, false);
-        if ( raw_n64 < 1 || raw_n64 > 0xffffffff ) { return u3_none; }
+        if ( raw_n64 < 1 || raw_n64 > 0xffffffff ) { return _la_sf_pop(sof_y, u3_none); }
         c3_d n64 = raw_n64;
-        c3_y* x_bytes64 = (c3_y*)u3a_malloc(((n64+1)*8)*sizeof(c3_y));
+        u3i_slab x_sab;
+        c3_y* x_bytes64 = _la_slab_bare(&x_sab, n64*8);
         ((float64_t*)x_bytes64)[0] = a64;
         for (c3_d i = 1; i < n64; i++) {
           ((float64_t*)x_bytes64)[i] = f64_add(a64, f64_mul(i32_to_f64(i), interval64));
         }
-        ((float64_t*)x_bytes64)[n64].v = 0x1;  // pin head
-        r_data = u3i_bytes(((n64+1)*8)*sizeof(c3_y), x_bytes64);
-        u3a_free(x_bytes64);
+        r_data = _la_mint(&x_sab);
         break;}
       
       case 7: {
         float128_t a128, b128, interval128;
-        u3r_bytes(0, 16, (c3_y*)&(a128.v[0]), a);
-        u3r_bytes(0, 16, (c3_y*)&(b128.v[0]), b);
-        u3r_bytes(0, 16, (c3_y*)&(interval128.v[0]), d);
+        _la_rbytes(0, 16, (c3_y*)&(a128.v[0]), a);
+        _la_rbytes(0, 16, (c3_y*)&(b128.v[0]), b);
+        _la_rbytes(0, 16, (c3_y*)&(interval128.v[0]), d);
         float128_t tmp;
         f128M_sub(&b128, &a128, &tmp);
         f128M_div(&tmp, &interval128, &tmp);
         f128M_ceil(&tmp, &tmp);
         c3_ds raw_n128 = f128M_to_i64(&tmp, softfloat_round_minMag, false);
-        if ( raw_n128 < 1 || raw_n128 > 0xffffffff ) { return u3_none; }
+        if ( raw_n128 < 1 || raw_n128 > 0xffffffff ) { return _la_sf_pop(sof_y, u3_none); }
         c3_d n128 = raw_n128;
-        c3_y* x_bytes128 = (c3_y*)u3a_malloc(((n128+1)*16)*sizeof(c3_y));
+        u3i_slab x_sab;
+        c3_y* x_bytes128 = _la_slab_bare(&x_sab, n128*16);
         float128_t i128;
         ((float128_t*)x_bytes128)[0] = a128;
         for (c3_d i = 1; i < n128; i++) {
@@ -2076,14 +2728,11 @@
           f128M_mul(&i128, &interval128, &((float128_t*)x_bytes128)[i]);
           f128M_add(&a128, &((float128_t*)x_bytes128)[i], &((float128_t*)x_bytes128)[i]);
         }
-        ((float128_t*)x_bytes128)[n128].v[0] = 0x1;  // pin head
-        ((float128_t*)x_bytes128)[n128].v[1] = 0x0;  // pin head
-        r_data = u3i_bytes(((n128+1)*16)*sizeof(c3_y), x_bytes128);
-        u3a_free(x_bytes128);
+        r_data = _la_mint(&x_sab);
         break;}
     }
 
-    return r_data;
+    return _la_sf_pop(sof_y, r_data);
   }
 
 /* trace - tr(x)
@@ -2091,38 +2740,468 @@
   u3_noun
   u3qi_la_trace_i754(u3_noun x_data,
                      u3_noun shape,
-                     u3_noun bloq)
+                     u3_noun bloq,
+                     c3_y    rnd)
   {
     u3_noun d_data = u3qi_la_diag(x_data, shape, bloq);
     c3_d *dim_x = _get_dims(shape);
     c3_d len_x0 = dim_x[0];
     u3a_free(dim_x);
-    u3_noun r_data = u3qi_la_dot_i754(d_data, d_data, u3nt(len_x0, 0x1, u3_nul), u3k(bloq));
+    u3_noun r_data = u3qi_la_dot_i754(d_data, d_data, u3nt(len_x0, 0x1, u3_nul), u3k(bloq), rnd);
     return r_data;
   }
 
-/* mmul
+/* blocked GEMM for mmul - r := x . y
+**
+** x is m*n, y is n*p, r is m*p, all row-major lanes.  Hoon's +mmul builds
+** each cell as ((0 + x[i,0]*y[0,j]) + x[i,1]*y[1,j]) + ..., rounding after
+** every mul and every add, so the kernels below keep exactly that order:
+** the k loop is only cut into consecutive kc-long blocks, and a cell's
+** partial sum is parked in r between blocks (a store is exact).  r must
+** come in zeroed.
+**
+** Each block of x is packed into contiguous _LA_MR-row micro-panels and
+** each block of y into _LA_NR-column micro-panels, k-major, so the micro-
+** kernel walks both linearly.  Block sizes are per lane width (bloq 4..8):
+** a y micro-panel stays in L1 and an x block in L2.  The micro-kernel is
+** passed in, so the same driver serves %i754 and %cplx lanes.
 */
-  u3_noun
-  u3qi_la_mmul_i754(u3_noun x_data,
-                    u3_noun y_data,
-                    u3_noun x_shape,
-                    u3_noun y_shape,
-                    u3_noun bloq)
-  {
-    //  Unpack the data as a byte array.  We assume total length < 2**64.
-    c3_d M = u3x_atom(u3h(x_shape));
-    c3_d Na= u3x_atom(u3h(u3t(x_shape)));
-    c3_d Nb= u3x_atom(u3h(y_shape));
-    c3_d P = u3x_atom(u3h(u3t(y_shape)));
+#define _LA_MR  4
+#define _LA_NR  4
 
-    if ((u3_nul != u3t(u3t(x_shape))) ||
-        (u3_nul != u3t(u3t(y_shape))) ||
-        (Na != Nb)) {
-      return u3m_bail(c3__exit);
-    }
+  static const c3_d _la_gemm_mc[5] = {  256,  128,   64,  32,  16 };
+  static const c3_d _la_gemm_kc[5] = {  512,  256,  128,  64,  32 };
+  static const c3_d _la_gemm_nc[5] = { 2048, 1024,  512, 256, 128 };
+
+  typedef void (*_la_gemm_mk)(c3_d, const c3_y*, const c3_y*, c3_y*, c3_d, c3_d, c3_d);
+
+/* micro-kernels: r[mr,nr] += xp[mr,kc] . yp[kc,nr], one rounding per op
+*/
+#define _LA_MK(SUF, TY, ADD, MUL)                                            \
+  static void                                                                \
+  _la_gemm_mk_##SUF(c3_d kc, const c3_y* xp_y, const c3_y* yp_y,             \
+                    c3_y* r_y, c3_d ldr, c3_d mr, c3_d nr)                   \
+  {                                                                          \
+    const TY* xp = (const TY*)xp_y;                                          \
+    const TY* yp = (const TY*)yp_y;                                          \
+    TY*       r  = (TY*)r_y;                                                 \
+    TY        acc[_LA_MR][_LA_NR];                                           \
+    for ( c3_d i = 0; i < mr; i++ )                                          \
+      for ( c3_d j = 0; j < nr; j++ ) acc[i][j] = r[i*ldr + j];              \
+    for ( c3_d k = 0; k < kc; k++ ) {                                        \
+      const TY* a = xp + k*_LA_MR;                                           \
+      const TY* b = yp + k*_LA_NR;                                           \
+      for ( c3_d i = 0; i < mr; i++ )                                        \
+        for ( c3_d j = 0; j < nr; j++ )                                      \
+          acc[i][j] = ADD(acc[i][j], MUL(a[i], b[j]));                       \
+    }                                                                        \
+    for ( c3_d i = 0; i < mr; i++ )                                          \
+      for ( c3_d j = 0; j < nr; j++ ) r[i*ldr + j] = acc[i][j];              \
+  }
+
+  _LA_MK(h, float16_t, f16_add, f16_mul)
+  _LA_MK(s, float32_t, f32_add, f32_mul)
+  _LA_MK(d, float64_t, f64_add, f64_mul)
+#undef _LA_MK
+
+  static void
+  _la_gemm_mk_q(c3_d kc, const c3_y* xp_y, const c3_y* yp_y,
+                c3_y* r_y, c3_d ldr, c3_d mr, c3_d nr)
+  {
+    const float128_t* xp = (const float128_t*)xp_y;
+    const float128_t* yp = (const float128_t*)yp_y;
+    float128_t*       r  = (float128_t*)r_y;
+    float128_t        acc[_LA_MR][_LA_NR];
+    float128_t        pro;
+
+    for ( c3_d i = 0; i < mr; i++ )
+      for ( c3_d j = 0; j < nr; j++ ) acc[i][j] = r[i*ldr + j];
+    for ( c3_d k = 0; k < kc; k++ ) {
+      const float128_t* a = xp + k*_LA_MR;
+      const float128_t* b = yp + k*_LA_NR;
+      for ( c3_d i = 0; i < mr; i++ ) {
+        for ( c3_d j = 0; j < nr; j++ ) {
+          f128M_mul(&a[i], &b[j], &pro);
+          f128M_add(&acc[i][j], &pro, &acc[i][j]);
+        }
+      }
+    }
+    for ( c3_d i = 0; i < mr; i++ )
+      for ( c3_d j = 0; j < nr; j++ ) r[i*ldr + j] = acc[i][j];
+  }
+
+  static const _la_gemm_mk _la_gemm_mks[4] = {
+    _la_gemm_mk_h, _la_gemm_mk_s, _la_gemm_mk_d, _la_gemm_mk_q
+  };
+
+/* pack x[i0.., k0..] (mc*kc) into _LA_MR-row panels, k-major
+*/
+  static void
+  _la_gemm_pack_x(const c3_y* x, c3_d ldx, c3_d mc, c3_d kc, c3_d wyd, c3_y* xp)
+  {
+    for ( c3_d i0 = 0; i0 < mc; i0 += _LA_MR ) {
+      c3_d mr = c3_min(_LA_MR, mc - i0);
+      for ( c3_d k = 0; k < kc; k++ ) {
+        for ( c3_d i = 0; i < mr; i++ ) {
+          memcpy(xp + (k*_LA_MR + i)*wyd, x + ((i0 + i)*ldx + k)*wyd, wyd);
+        }
+      }
+      xp += _LA_MR * kc * wyd;
+    }
+  }
+
+/* pack y[k0.., j0..] (kc*nc) into _LA_NR-column panels, k-major
+*/
+  static void
+  _la_gemm_pack_y(const c3_y* y, c3_d ldy, c3_d kc, c3_d nc, c3_d wyd, c3_y* yp)
+  {
+    for ( c3_d j0 = 0; j0 < nc; j0 += _LA_NR ) {
+      c3_d nr = c3_min(_LA_NR, nc - j0);
+      for ( c3_d k = 0; k < kc; k++ ) {
+        memcpy(yp + k*_LA_NR*wyd, y + (k*ldy + j0)*wyd, nr*wyd);
+      }
+      yp += _LA_NR * kc * wyd;
+    }
+  }
+
+/* _la_gemm_run - blocked r := x . y into caller-supplied pack buffers
+**
+** xp holds mc*kc lanes and yp kc*nc lanes (see _la_gemm_scratch).
+*/
+  static void
+  _la_gemm_run(c3_d m, c3_d n, c3_d p,
+               const c3_y* x, const c3_y* y, c3_y* r,
+               c3_d bloq, _la_gemm_mk mk, c3_y* xp, c3_y* yp)
+  {
+    c3_d        wyd = (c3_d)1 << (bloq - 3);
+    c3_d        mcb = _la_gemm_mc[bloq - 4];
+    c3_d        kcb = _la_gemm_kc[bloq - 4];
+    c3_d        ncb = _la_gemm_nc[bloq - 4];
+
+    for ( c3_d j0 = 0; j0 < p; j0 += ncb ) {
+      c3_d nc = c3_min(ncb, p - j0);
+      //  k blocks run in order, so each cell still sums k = 0, 1, ...
+      for ( c3_d k0 = 0; k0 < n; k0 += kcb ) {
+        c3_d kc = c3_min(kcb, n - k0);
+        _la_gemm_pack_y(y + (k0*p + j0)*wyd, p, kc, nc, wyd, yp);
+        for ( c3_d i0 = 0; i0 < m; i0 += mcb ) {
+          c3_d mc = c3_min(mcb, m - i0);
+          _la_gemm_pack_x(x + (i0*n + k0)*wyd, n, mc, kc, wyd, xp);
+          for ( c3_d i = 0; i < mc; i += _LA_MR ) {
+            for ( c3_d j = 0; j < nc; j += _LA_NR ) {
+              mk(kc,
+                 xp + i*kc*wyd,
+                 yp + j*kc*wyd,
+                 r + ((i0 + i)*p + j0 + j)*wyd,
+                 p,
+                 c3_min(_LA_MR, mc - i),
+                 c3_min(_LA_NR, nc - j));
+            }
+          }
+        }
+      }
+    }
+  }
+
+/* _la_gemm_scratch - bytes of x and y pack buffers for bloq
+*/
+  static inline void
+  _la_gemm_scratch(c3_d bloq, c3_d* xsz, c3_d* ysz)
+  {
+    c3_d wyd = (c3_d)1 << (bloq - 3);
+    *xsz = _la_gemm_mc[bloq - 4] * _la_gemm_kc[bloq - 4] * wyd;
+    *ysz = _la_gemm_kc[bloq - 4] * _la_gemm_nc[bloq - 4] * wyd;
+  }
+
+/* parallel mmul
+**
+** Every cell of r is independent, so above a size threshold the rows of r
+** are cut into bands of whole _LA_MR tiles, one per thread.  A cell is
+** still summed start to finish by one thread in the serial order, so the
+** result is bit-identical for any thread count.
+**
+** Workers read x and y in place on the loom, which nothing writes while
+** the calling thread waits in pthread_join.  They write only to the C
+** heap: the bands accumulate into a heap copy of r, copied into the slab
+** after the last join, so no loom page is dirtied off the main thread.
+**
+** _la_gemm enters the rounding mode once, before the first thread starts,
+** and restores the caller's after the last join.  A worker stores the mode
+** only if its softfloat_roundingMode differs: so where SoftFloat keeps the
+** mode per thread (THREAD_LOCAL) each worker sets its own copy, and where
+** the mode is one global no worker writes it while the others run.
+**
+** The thread cap defaults to _LA_PAR_MAX (and the number of online cores);
+** bands stay serial below _LA_PAR_MIN multiply-adds (m*n*p).  Both can be
+** overridden at build time; at run time LAGOON_THREADS can lower the cap
+** (LAGOON_THREADS=1 disables threading) and LAGOON_PAR_MIN moves the
+** threshold.
+*/
+#ifndef _LA_PAR_MAX
+#define _LA_PAR_MAX  16
+#endif
+#ifndef _LA_PAR_MIN
+#define _LA_PAR_MIN  (1ULL << 24)
+#endif
+
+  typedef struct {
+    c3_d        m, n, p;      //  band rows, inner, columns
+    const c3_y* x;            //  first row of the band in x
+    const c3_y* y;
+    c3_y*       r;            //  first row of the band in r
+    c3_d        bloq;
+    _la_gemm_mk mk;
+    c3_y        rnd_y;        //  softfloat rounding mode for the product
+                              //  (already entered by _la_gemm)
+  } _la_gemm_band;
+
+  static void*
+  _la_gemm_work(void* arg)
+  {
+    _la_gemm_band* ban_u = arg;
+    c3_d xsz, ysz;
+
+    if ( softfloat_roundingMode != ban_u->rnd_y ) {
+      softfloat_roundingMode = ban_u->rnd_y;
+    }
+    _la_gemm_scratch(ban_u->bloq, &xsz, &ysz);
+    c3_y* xp = c3_malloc(xsz);
+    c3_y* yp = c3_malloc(ysz);
+    _la_gemm_run(ban_u->m, ban_u->n, ban_u->p,
+                 ban_u->x, ban_u->y, ban_u->r,
+                 ban_u->bloq, ban_u->mk, xp, yp);
+    c3_free(xp);
+    c3_free(yp);
+    return 0;
+  }
+
+  static c3_d
+  _la_par_env(const c3_c* nam_c, c3_d def)
+  {
+    const c3_c* val_c = getenv(nam_c);
+    if ( (0 == val_c) || (0 == *val_c) ) {
+      return def;
+    }
+    return (c3_d)strtoull(val_c, 0, 10);
+  }
+
+/* _la_gemm_threads - number of bands for an m*n*p product
+*/
+  static c3_d
+  _la_gemm_threads(c3_d m, c3_d n, c3_d p)
+  {
+    c3_d max = _la_par_env("LAGOON_THREADS", _LA_PAR_MAX);
+    c3_d min = _la_par_env("LAGOON_PAR_MIN", _LA_PAR_MIN);
+    c3_ds cor = sysconf(_SC_NPROCESSORS_ONLN);
+    c3_d tiz = (m + _LA_MR - 1) / _LA_MR;   //  row tiles to hand out
+
+    c3_d mnp;
+
+    if ( (max <= 1) || (tiz < 2) || (0 == n) || (0 == p) ) {
+      return 1;
+    }
+    //  m*n*p, saturating
+    mnp = ( m > UINT64_MAX / n ) ? UINT64_MAX : m*n;
+    mnp = ( mnp > UINT64_MAX / p ) ? UINT64_MAX : mnp*p;
+    if ( mnp < min ) {
+      return 1;
+    }
+    if ( (cor > 0) && ((c3_d)cor < max) ) {
+      max = cor;
+    }
+    //  _la_gemm sizes its per-band arrays on the stack by this
+    max = c3_min(max, _LA_PAR_MAX);
+    return c3_min(max, tiz);
+  }
+
+  static void
+  _la_gemm(c3_d m, c3_d n, c3_d p,
+           const c3_y* x, const c3_y* y, c3_y* r,
+           c3_d bloq, _la_gemm_mk mk,
+           c3_y rnd)
+  {
+    c3_d wyd = (c3_d)1 << (bloq - 3);
+    c3_d tot = _la_gemm_threads(m, n, p);
+
+    if ( 1 == tot ) {
+      c3_d xsz, ysz;
+      _la_gemm_scratch(bloq, &xsz, &ysz);
+      c3_y* xp = (c3_y*)u3a_malloc(xsz);
+      c3_y* yp = (c3_y*)u3a_malloc(ysz);
+      c3_y sof_y = _la_sf_push(rnd);
+      _la_gemm_run(m, n, p, x, y, r, bloq, mk, xp, yp);
+      _la_sf_pop(sof_y, 0);
+      u3a_free(xp);
+      u3a_free(yp);
+      return;
+    }
+
+    _la_gemm_band ban_u[tot];     //  tot <= _LA_PAR_MAX
+    pthread_t     tid_u[tot];
+    c3_o          liv_o[tot];
+    c3_d          tiz = (m + _LA_MR - 1) / _LA_MR;
+    c3_d          i0  = 0;
+    c3_d          syz = m*p*wyd;
+    c3_y*         hep = c3_malloc(syz);   //  r on the C heap
+    c3_y          sof_y;
+
+    memcpy(hep, r, syz);
+
+    //  spread row tiles as evenly as possible; the last band takes the tail
+    for ( c3_d t = 0; t < tot; t++ ) {
+      c3_d til = tiz / tot + ((t < tiz % tot) ? 1 : 0);
+      c3_d mb  = c3_min(til * _LA_MR, m - i0);
+
+      ban_u[t] = (_la_gemm_band){ mb, n, p,
+                                  x + i0*n*wyd, y, hep + i0*p*wyd,
+                                  bloq, mk, _la_sf_mode(rnd) };
+      i0 += mb;
+    }
+
+    //  band 0 runs on this thread; a band whose thread can't start does too
+    sof_y = _la_sf_push(rnd);
+    for ( c3_d t = 1; t < tot; t++ ) {
+      liv_o[t] = ( 0 == pthread_create(&tid_u[t], 0, _la_gemm_work, &ban_u[t]) )
+                 ? c3y : c3n;
+    }
+    _la_gemm_work(&ban_u[0]);
+    for ( c3_d t = 1; t < tot; t++ ) {
+      if ( c3y == liv_o[t] ) {
+        pthread_join(tid_u[t], 0);
+      }
+      else {
+        _la_gemm_work(&ban_u[t]);
+      }
+    }
+    _la_sf_pop(sof_y, 0);
+    memcpy(r, hep, syz);
+    c3_free(hep);
+  }
+
+/* complex lanes (%cplx)
+**
+** A %cplx lane of width 2^bloq is a {real, imag} pair of 2^(bloq-1)-bit
+** floats, real in the low half: bloq 5..8 = 2x f16/f32/f64/f128.  The
+** element ops copy /lib/complex exactly, one rounding per component op:
+**
+**   mul  (ar*br - ai*bi) + (ar*bi + ai*br)i
+**   add  (ar + br) + (ai + bi)i
+**   conj ar + (0 - ai)i        (a rounded subtract, not a sign flip, so
+**                               conj(x+0i) is x-0i only under %d)
+*/
+  static inline float128_t
+  _la_qadd(float128_t a, float128_t b) { float128_t r; f128M_add(&a, &b, &r); return r; }
+  static inline float128_t
+  _la_qsub(float128_t a, float128_t b) { float128_t r; f128M_sub(&a, &b, &r); return r; }
+  static inline float128_t
+  _la_qmul(float128_t a, float128_t b) { float128_t r; f128M_mul(&a, &b, &r); return r; }
+
+/* _la_cx_*  - r := a*b (r may not alias a or b)
+** _la_cdot_* - r := Sum conj?(x_i)*y_i, summed from the last lane down, as
+**              +dot's (reel ... add) over the ravel does
+** _la_gemm_cmk_* - complex micro-kernels for _la_gemm, same order as +mmul
+*/
+#define _LA_CX(SUF, TY, ADD, SUB, MUL)                                       \
+  static inline void                                                         \
+  _la_cx_mul_##SUF(const TY* a, const TY* b, TY* r)                          \
+  {                                                                          \
+    r[0] = SUB(MUL(a[0], b[0]), MUL(a[1], b[1]));                            \
+    r[1] = ADD(MUL(a[0], b[1]), MUL(a[1], b[0]));                            \
+  }                                                                          \
+                                                                             \
+  static void                                                                \
+  _la_cdot_##SUF(c3_d len, const c3_y* x_y, const c3_y* y_y,                 \
+                 c3_o cnj_o, c3_y* r_y)                                      \
+  {                                                                          \
+    const TY* x = (const TY*)x_y;                                            \
+    const TY* y = (const TY*)y_y;                                            \
+    TY        acc[2], zer, a[2], pro[2];                                     \
+    memset(&zer, 0, sizeof(TY));                                             \
+    acc[0] = acc[1] = zer;                                                   \
+    for ( c3_d i = len; i-- > 0; ) {                                         \
+      a[0] = x[2*i];                                                         \
+      a[1] = ( c3y == cnj_o ) ? SUB(zer, x[2*i + 1]) : x[2*i + 1];           \
+      _la_cx_mul_##SUF(a, y + 2*i, pro);                                     \
+      acc[0] = ADD(pro[0], acc[0]);                                          \
+      acc[1] = ADD(pro[1], acc[1]);                                          \
+    }                                                                        \
+    memcpy(r_y, acc, sizeof(acc));                                           \
+  }                                                                          \
+                                                                             \
+  static void                                                                \
+  _la_gemm_cmk_##SUF(c3_d kc, const c3_y* xp_y, const c3_y* yp_y,            \
+                     c3_y* r_y, c3_d ldr, c3_d mr, c3_d nr)                  \
+  {                                                                          \
+    const TY* xp = (const TY*)xp_y;                                          \
+    const TY* yp = (const TY*)yp_y;                                          \
+    TY*       r  = (TY*)r_y;                                                 \
+    TY        acc[_LA_MR][_LA_NR][2], pro[2];                                \
+    for ( c3_d i = 0; i < mr; i++ )                                          \
+      for ( c3_d j = 0; j < nr; j++ ) {                                      \
+        acc[i][j][0] = r[2*(i*ldr + j)];                                     \
+        acc[i][j][1] = r[2*(i*ldr + j) + 1];                                 \
+      }                                                                      \
+    for ( c3_d k = 0; k < kc; k++ ) {                                        \
+      const TY* a = xp + 2*k*_LA_MR;                                         \
+      const TY* b = yp + 2*k*_LA_NR;                                         \
+      for ( c3_d i = 0; i < mr; i++ )                                        \
+        for ( c3_d j = 0; j < nr; j++ ) {                                    \
+          _la_cx_mul_##SUF(a + 2*i, b + 2*j, pro);                           \
+          acc[i][j][0] = ADD(acc[i][j][0], pro[0]);                          \
+          acc[i][j][1] = ADD(acc[i][j][1], pro[1]);                          \
+        }                                                                    \
+    }                                                                        \
+    for ( c3_d i = 0; i < mr; i++ )                                          \
+      for ( c3_d j = 0; j < nr; j++ ) {                                      \
+        r[2*(i*ldr + j)]     = acc[i][j][0];                                 \
+        r[2*(i*ldr + j) + 1] = acc[i][j][1];                                 \
+      }                                                                      \
+  }
+
+  _LA_CX(h, float16_t,  f16_add,  f16_sub,  f16_mul)
+  _LA_CX(s, float32_t,  f32_add,  f32_sub,  f32_mul)
+  _LA_CX(d, float64_t,  f64_add,  f64_sub,  f64_mul)
+  _LA_CX(q, float128_t, _la_qadd, _la_qsub, _la_qmul)
+#undef _LA_CX
+
+  typedef void (*_la_cdot_fn)(c3_d, const c3_y*, const c3_y*, c3_o, c3_y*);
+
+  static const _la_cdot_fn _la_cdots[4] = {
+    _la_cdot_h, _la_cdot_s, _la_cdot_d, _la_cdot_q
+  };
+
+  static const _la_gemm_mk _la_gemm_cmks[4] = {
+    _la_gemm_cmk_h, _la_gemm_cmk_s, _la_gemm_cmk_d, _la_gemm_cmk_q
+  };
+
+/* mmul
+*/
+  u3_noun
+  u3qi_la_mmul_i754(u3_noun x_data,
+                    u3_noun y_data,
+                    u3_noun x_shape,
+                    u3_noun y_shape,
+                    u3_noun bloq,
+                    c3_y    rnd)
+  {
+    //  Unpack the data as a byte array.  We assume total length < 2**64.
+    c3_d M = u3x_atom(u3h(x_shape));
+    c3_d Na= u3x_atom(u3h(u3t(x_shape)));
+    c3_d Nb= u3x_atom(u3h(y_shape));
+    c3_d P = u3x_atom(u3h(u3t(y_shape)));
+
+    if ((u3_nul != u3t(u3t(x_shape))) ||
+        (u3_nul != u3t(u3t(y_shape))) ||
+        (Na != Nb)) {
+      return u3m_bail(c3__exit);
+    }
     c3_d N = Na;
 
+    //  The blocked kernels cover the IEEE widths only; punt anything else.
+    if ( (u3x_atom(bloq) < 4) || (u3x_atom(bloq) > 7) ) {
+      return u3_none;
+    }
+
     //  Unpack the data as a byte array.  We assume total length < 2**64.
     // len_x is length in base units
     c3_d len_x = _get_length(x_shape);    // M*N
@@ -2130,9 +3209,9 @@
     // syz_x is length in bytes
     c3_d syz_x = len_x * pow(2, bloq-3);  // M*N
 
-    // x_bytes is the data array (w/o leading 0x1)
-    c3_y* x_bytes = (c3_y*)u3a_malloc(syz_x*sizeof(c3_y));
-    u3r_bytes(0, syz_x, x_bytes, x_data);
+    // x_bytes is the data array (w/o leading 0x1; read in place)
+    _la_view x_view;
+    c3_y* x_bytes = _la_view_get(&x_view, x_data, syz_x, bloq);
 
     // len_x is length in base units
     c3_d len_y = _get_length(y_shape);    // N*P
@@ -2140,9 +3219,9 @@
     // syz_x is length in bytes
     c3_d syz_y = len_y * pow(2, bloq-3);  // N*P
 
-    // y_bytes is the data array (w/o leading 0x1)
-    c3_y* y_bytes = (c3_y*)u3a_malloc(syz_y*sizeof(c3_y));
-    u3r_bytes(0, syz_y, y_bytes, y_data);
+    // y_bytes is the data array (w/o leading 0x1; read in place)
+    _la_view y_view;
+    c3_y* y_bytes = _la_view_get(&y_view, y_data, syz_y, bloq);
     
     // len_r is length in base units
     c3_d len_r = M*P;                     // M*P
@@ -2151,46 +3230,448 @@
     c3_d syz_r = len_r * pow(2, bloq-3);  // M*P
 
     // r_bytes is the result array
-    c3_y* r_bytes = (c3_y*)u3a_malloc((syz_r+1)*sizeof(c3_y));
-    r_bytes[syz_r] = 0x1;  // pin head
+    u3i_slab r_sab;
+    c3_y* r_bytes = _la_slab_bare(&r_sab, syz_r);
     // initialize with 0x0s
     for (c3_d i = 0; i < syz_r; i++) {
       r_bytes[i] = 0x0;
     }
 
-    //  Switch on the block size.
-    switch (u3x_atom(bloq)) {
-      case 4:
-        hgemm('N', 'N', M, N, P, (float16_t){SB_REAL16_ONE}, (float16_t*)x_bytes, N, (float16_t*)y_bytes, P, (float16_t){SB_REAL16_ZERO}, (float16_t*)r_bytes, P, _la_rnd);
-        break;
+    //  Blocked kernel in +mmul's summation order.
+    _la_gemm(M, N, P, x_bytes, y_bytes, r_bytes, u3x_atom(bloq),
+             _la_gemm_mks[bloq - 4], rnd);
 
-      case 5:
-        sgemm('N', 'N', M, N, P, (float32_t){SB_REAL32_ONE}, (float32_t*)x_bytes, N, (float32_t*)y_bytes, P, (float32_t){SB_REAL32_ZERO}, (float32_t*)r_bytes, P, _la_rnd);
-        break;
+    //  Unpack the result back into a noun.
+    u3_noun r_data = _la_mint(&r_sab);
+    u3_noun M_ = u3i_chub(M);
+    u3_noun P_ = u3i_chub(P);
 
-      case 6:
-        dgemm('N', 'N', M, N, P, (float64_t){SB_REAL64_ONE}, (float64_t*)x_bytes, N, (float64_t*)y_bytes, P, (float64_t){SB_REAL64_ZERO}, (float64_t*)r_bytes, P, _la_rnd);
-        break;
+    _la_view_put(&x_view);
+    _la_view_put(&y_view);
 
-      case 7:
-        qgemm('N', 'N', M, N, P, (float128_t){SB_REAL128L_ONE,SB_REAL128U_ONE}, (float128_t*)x_bytes, N, (float128_t*)y_bytes, P, (float128_t){SB_REAL128L_ZERO,SB_REAL128U_ZERO}, (float128_t*)r_bytes, P, _la_rnd);
-        break;
+    return u3nc(u3nq(u3nt(M_, P_, u3_nul), u3k(bloq), c3__i754, u3_nul), r_data);
+  }
+
+/* dot, dotc - %cplx
+*/
+  static u3_noun
+  _la_dot_cplx(u3_noun x_data,
+               u3_noun y_data,
+               u3_noun shape,
+               u3_noun bloq,
+               c3_o    cnj_o,
+               c3_y    rnd)
+  {
+    c3_y sof_y = _la_sf_push(rnd);
+
+    //  Fence on valid bloq size.
+    if (bloq < 5 || bloq > 8) {
+      return _la_sf_pop(sof_y, u3_none);
     }
 
-    //  Unpack the result back into a noun.
-    u3_noun r_data = u3i_bytes(syz_r+1, r_bytes);
+    //  Unpack the data as a byte array.  We assume total length < 2**64.
+    // len_x is length in base units
+    c3_d len_x = _get_length(shape);
+
+    // wyd is bytes per lane; syz_x is length in bytes
+    c3_d wyd = (c3_d)1 << (bloq - 3);
+    c3_d syz_x = len_x * wyd;
+
+    // x_bytes, y_bytes are the data arrays (w/o leading 0x1; read in place)
+    _la_view x_view;
+    c3_y* x_bytes = _la_view_get(&x_view, x_data, syz_x, bloq);
+    _la_view y_view;
+    c3_y* y_bytes = _la_view_get(&y_view, y_data, syz_x, bloq);
+
+    u3i_slab r_sab;
+    c3_y* r_bytes = _la_slab_bare(&r_sab, wyd);
+    _la_cdots[bloq - 5](len_x, x_bytes, y_bytes, cnj_o, r_bytes);
+
+    //  Clean up and return.
+    _la_view_put(&x_view);
+    _la_view_put(&y_view);
+
+    return _la_sf_pop(sof_y, _la_mint(&r_sab));
+  }
+
+  u3_noun
+  u3qi_la_dot_cplx(u3_noun x_data,
+                   u3_noun y_data,
+                   u3_noun shape,
+                   u3_noun bloq,
+                   c3_y    rnd)
+  {
+    return _la_dot_cplx(x_data, y_data, shape, bloq, c3n, rnd);
+  }
+
+  u3_noun
+  u3qi_la_dotc_cplx(u3_noun x_data,
+                    u3_noun y_data,
+                    u3_noun shape,
+                    u3_noun bloq,
+                    c3_y    rnd)
+  {
+    return _la_dot_cplx(x_data, y_data, shape, bloq, c3y, rnd);
+  }
+
+/* mmul - %cplx
+*/
+  u3_noun
+  u3qi_la_mmul_cplx(u3_noun x_data,
+                    u3_noun y_data,
+                    u3_noun x_shape,
+                    u3_noun y_shape,
+                    u3_noun bloq,
+                    c3_y    rnd)
+  {
+    //  Fence on valid bloq size.
+    if (bloq < 5 || bloq > 8) {
+      return u3_none;
+    }
+
+    if ((c3n == u3du(x_shape)) || (c3n == u3du(u3t(x_shape))) ||
+        (c3n == u3du(y_shape)) || (c3n == u3du(u3t(y_shape))) ||
+        (u3_nul != u3t(u3t(x_shape))) ||
+        (u3_nul != u3t(u3t(y_shape)))) {
+      return u3_none;
+    }
+
+    c3_d M = u3x_atom(u3h(x_shape));
+    c3_d N = u3x_atom(u3h(u3t(x_shape)));
+    c3_d P = u3x_atom(u3h(u3t(y_shape)));
+
+    if ( N != u3x_atom(u3h(y_shape)) ) {
+      return u3_none;
+    }
+
+    c3_d wyd = (c3_d)1 << (bloq - 3);
+
+    // x_bytes, y_bytes are the data arrays (w/o leading 0x1; read in place)
+    _la_view x_view;
+    c3_y* x_bytes = _la_view_get(&x_view, x_data, M*N*wyd, bloq);
+    _la_view y_view;
+    c3_y* y_bytes = _la_view_get(&y_view, y_data, N*P*wyd, bloq);
+
+    // r_bytes is the result array, every cell starting at +0+0i
+    c3_d syz_r = M*P*wyd;
+    u3i_slab r_sab;
+    c3_y* r_bytes = _la_slab_bare(&r_sab, syz_r);
+    memset(r_bytes, 0, syz_r);
+
+    _la_gemm(M, N, P, x_bytes, y_bytes, r_bytes, u3x_atom(bloq),
+             _la_gemm_cmks[bloq - 5], rnd);
+
+    u3_noun r_data = _la_mint(&r_sab);
     u3_noun M_ = u3i_chub(M);
     u3_noun P_ = u3i_chub(P);
 
-    u3a_free(x_bytes);
-    u3a_free(y_bytes);
-    u3a_free(r_bytes);
+    _la_view_put(&x_view);
+    _la_view_put(&y_view);
 
-    return u3nc(u3nq(u3nt(M_, P_, u3_nul), u3k(bloq), c3__i754, u3_nul), r_data);
+    return u3nc(u3nq(u3nt(M_, P_, u3_nul), u3k(bloq), c3__cplx, u3_nul), r_data);
   }
 
-  u3_noun
-  u3wi_la_add(u3_noun cor)
+/* reductions along one axis - +sum-axis, +prod-axis, +max-axis, +min-axis,
+**                             +argmax-axis, +argmin-axis (and +prod)
+**
+** .a is walked as outer x n x inner: the reduced axis has n lanes at stride
+** inner, and each of the outer*inner result cells is one pass down its
+** fiber.  The folds repeat the Hoon ones lane for lane, so a whole-ray
+** reduction agrees with +cumsum, +max and friends:
+**
+**   sum   acc = 0, then acc = x_k + acc for k = n-1 .. 0   (+reel)
+**   prod  acc = x_n-1, then acc = x_k * acc for k = n-2 .. 0
+**   max   acc = x_0, then acc = x_k if x_k > acc, k = n-1 .. 0 (min: <)
+**   arg*  the first k whose lane is bitwise equal to max/min
+**
+** %i754 (bloq 4..7) runs on SoftFloat under the core's rounding mode and
+** %uint (bloq 3..6) wraps at the lane width.  Other kinds punt.
+*/
+  typedef enum { _LA_RSUM, _LA_RPROD, _LA_RMAX, _LA_RMIN } _la_rop;
+
+  static inline bool
+  _la_qlt(float128_t a, float128_t b) { return f128M_lt(&a, &b); }
+
+#define _LA_RED(SUF, TY, ADD, MUL, LT)                                       \
+  static TY                                                                  \
+  _la_red_##SUF(_la_rop op, c3_d n, c3_d stp, const TY* x)                   \
+  {                                                                          \
+    TY acc;                                                                  \
+    switch ( op ) {                                                          \
+      case _LA_RSUM: {                                                       \
+        memset(&acc, 0, sizeof(TY));                                         \
+        for ( c3_d k = n; k-- > 0; ) {                                       \
+          acc = ADD(x[k*stp], acc);                                          \
+        }                                                                    \
+      } break;                                                               \
+      case _LA_RPROD: {                                                      \
+        acc = x[(n-1)*stp];                                                  \
+        for ( c3_d k = n-1; k-- > 0; ) {                                     \
+          acc = MUL(x[k*stp], acc);                                          \
+        }                                                                    \
+      } break;                                                               \
+      case _LA_RMAX: {                                                       \
+        acc = x[0];                                                          \
+        for ( c3_d k = n; k-- > 0; ) {                                       \
+          if ( LT(acc, x[k*stp]) ) acc = x[k*stp];                           \
+        }                                                                    \
+      } break;                                                               \
+      case _LA_RMIN: {                                                       \
+        acc = x[0];                                                          \
+        for ( c3_d k = n; k-- > 0; ) {                                       \
+          if ( LT(x[k*stp], acc) ) acc = x[k*stp];                           \
+        }                                                                    \
+      } break;                                                               \
+    }                                                                        \
+    return acc;                                                              \
+  }
+
+  _LA_RED(h, float16_t,  f16_add,   f16_mul,   f16_lt)
+  _LA_RED(s, float32_t,  f32_add,   f32_mul,   f32_lt)
+  _LA_RED(d, float64_t,  f64_add,   f64_mul,   f64_lt)
+  _LA_RED(q, float128_t, _la_qadd,  _la_qmul,  _la_qlt)
+
+  //  integer lanes of 2^bl bits, bl 3..6; sgn_o for signed ordering
+  static inline c3_d
+  _la_red_lane(const c3_y* x, c3_d i, c3_d wyd)
+  {
+    c3_d v = 0;
+    memcpy(&v, x + i*wyd, wyd);
+    return v;
+  }
+
+  static inline c3_o
+  _la_red_lt(c3_o sgn_o, c3_d sft, c3_d a, c3_d b)
+  {
+    return ( c3y == sgn_o ) ? __((c3_ds)(a << sft) < (c3_ds)(b << sft))
+                            : __(a < b);
+  }
+
+  static c3_d
+  _la_red_i(_la_rop op, c3_o sgn_o, c3_d bl, c3_d n, c3_d stp, const c3_y* x)
+  {
+    c3_d wyd = (c3_d)1 << (bl - 3);
+    c3_d sft = 64 - ((c3_d)1 << bl);
+    c3_d msk = ~(c3_d)0 >> sft;
+    c3_d acc = 0;
+    switch ( op ) {
+      case _LA_RSUM: {
+        for ( c3_d k = n; k-- > 0; ) {
+          acc = (_la_red_lane(x, k*stp, wyd) + acc) & msk;
+        }
+      } break;
+      case _LA_RPROD: {
+        acc = _la_red_lane(x, (n-1)*stp, wyd);
+        for ( c3_d k = n-1; k-- > 0; ) {
+          acc = (_la_red_lane(x, k*stp, wyd) * acc) & msk;
+        }
+      } break;
+      case _LA_RMAX: {
+        acc = _la_red_lane(x, 0, wyd);
+        for ( c3_d k = n; k-- > 0; ) {
+          c3_d v = _la_red_lane(x, k*stp, wyd);
+          if ( c3y == _la_red_lt(sgn_o, sft, acc, v) ) acc = v;
+        }
+      } break;
+      case _LA_RMIN: {
+        acc = _la_red_lane(x, 0, wyd);
+        for ( c3_d k = n; k-- > 0; ) {
+          c3_d v = _la_red_lane(x, k*stp, wyd);
+          if ( c3y == _la_red_lt(sgn_o, sft, v, acc) ) acc = v;
+        }
+      } break;
+    }
+    return acc;
+  }
+
+/* reduce x along axis axe; arg_o returns first-extreme indices as 64-bit
+** lanes instead of the extremes.  Result data, or u3_none to punt.
+*/
+  static u3_noun
+  _la_reduce(u3_noun x_data,
+             u3_noun shape,
+             u3_noun bloq,
+             u3_noun kind,
+             c3_d    axe,
+             _la_rop op,
+             c3_o    arg_o,
+             c3_y    rnd)
+  {
+    c3_y sof_y = _la_sf_push(rnd);
+
+    c3_d bl = u3x_atom(bloq);
+    switch ( kind ) {
+      case c3__i754: if ( (bl < 4) || (bl > 7) ) return _la_sf_pop(sof_y, u3_none); break;
+      case c3__uint: if ( (bl < 3) || (bl > 6) ) return _la_sf_pop(sof_y, u3_none); break;
+      default:       return _la_sf_pop(sof_y, u3_none);
+    }
+
+    c3_d nd = u3r_chub(0, u3qb_lent(shape));
+    if ( axe >= nd ) {
+      return _la_sf_pop(sof_y, u3_none);
+    }
+    c3_d* dims = _get_dims(shape);
+    c3_d outer = 1, inner = 1;
+    for ( c3_d a = 0; a < axe; a++ )       outer *= dims[a];
+    for ( c3_d a = axe + 1; a < nd; a++ )  inner *= dims[a];
+    c3_d n = dims[axe];
+    u3a_free(dims);
+
+    c3_d cells = outer * inner;
+    if ( (0 == n) && (0 != cells) && (_LA_RSUM != op) ) {
+      return _la_sf_pop(sof_y, u3_none);
+    }
+
+    c3_d wyd = (c3_d)1 << (bl - 3);
+    c3_d owd = ( c3y == arg_o ) ? 8 : wyd;
+
+    _la_view x_view;
+    c3_y* x_bytes = _la_view_get(&x_view, x_data, outer*n*inner*wyd, bl);
+    u3i_slab r_sab;
+    c3_y* r_bytes = _la_slab_bare(&r_sab, cells*owd);
+
+    for ( c3_d c = 0; c < cells; c++ ) {
+      const c3_y* fib = x_bytes + ((c / inner)*n*inner + (c % inner))*wyd;
+      c3_y val[16];
+
+      if ( c3__i754 == kind ) {
+        switch ( bl ) {
+          case 4: { float16_t  v = _la_red_h(op, n, inner, (const float16_t*)fib);
+                    memcpy(val, &v, wyd); } break;
+          case 5: { float32_t  v = _la_red_s(op, n, inner, (const float32_t*)fib);
+                    memcpy(val, &v, wyd); } break;
+          case 6: { float64_t  v = _la_red_d(op, n, inner, (const float64_t*)fib);
+                    memcpy(val, &v, wyd); } break;
+          case 7: { float128_t v = _la_red_q(op, n, inner, (const float128_t*)fib);
+                    memcpy(val, &v, wyd); } break;
+        }
+      }
+      else {
+        c3_d v = _la_red_i(op, __(c3__uint != kind), bl, n, inner, fib);
+        memcpy(val, &v, wyd);
+      }
+
+      if ( c3y == arg_o ) {
+        c3_d k = 0;
+        while ( (k < n) && memcmp(fib + k*inner*wyd, val, wyd) ) {
+          k++;
+        }
+        memcpy(r_bytes + c*8, &k, 8);
+      }
+      else {
+        memcpy(r_bytes + c*wyd, val, wyd);
+      }
+    }
+
+    _la_view_put(&x_view);
+    return _la_sf_pop(sof_y, _la_mint(&r_sab));
+  }
+
+  //  reduced meta: shape with axis axe set to 1; arg_o gives 64-bit %uint
+  static u3_noun
+  _la_reduce_meta(u3_noun shape, u3_noun bloq, u3_noun kind, u3_noun tail,
+                  c3_d axe, c3_o arg_o)
+  {
+    u3_noun r_shape = u3_nul;
+    c3_d nd = u3r_chub(0, u3qb_lent(shape));
+    c3_d* dims = _get_dims(shape);
+    for ( c3_d a = nd; a-- > 0; ) {
+      r_shape = u3nc(( a == axe ) ? 1 : u3i_chub(dims[a]), r_shape);
+    }
+    u3a_free(dims);
+    if ( c3y == arg_o ) {
+      return u3nq(r_shape, 6, c3__uint, u3_nul);
+    }
+    return u3nq(r_shape, u3k(bloq), u3k(kind), u3k(tail));
+  }
+
+#ifndef LAGOON_JET_HARNESS
+
+/* generic element-wise drivers - +el-wise-op, +bin-op, +ter-op
+**
+** These know nothing of the kind: lane i of each operand is cut straight
+** out of its data, the gate is slammed on the lanes, and the low 2^bloq
+** bits of the product are written back, as +rep keeps them.  The gate
+** still runs as Nock (or under its own jet); what this buys is one linear
+** pass for the kinds and bloqs the typed jets punt on.  Any bloq works,
+** including sub-byte lanes.
+*/
+  static inline u3_atom
+  _la_lane_get(const c3_y* buf_y, c3_d i, c3_d bl)
+  {
+    if ( bl >= 3 ) {
+      c3_d wyd = (c3_d)1 << (bl - 3);
+      return _la_ibytes(wyd, buf_y + i*wyd);
+    }
+    c3_d bit = i << bl;
+    return (buf_y[bit >> 3] >> (bit & 7)) & ((1 << (1 << bl)) - 1);
+  }
+
+  //  buf_y must be zeroed at lane i
+  static inline void
+  _la_lane_put(c3_y* buf_y, c3_d i, c3_d bl, u3_atom a)
+  {
+    if ( bl >= 3 ) {
+      c3_d wyd = (c3_d)1 << (bl - 3);
+      _la_rbytes(0, wyd, buf_y + i*wyd, a);
+    }
+    else {
+      c3_d bit = i << bl;
+      buf_y[bit >> 3] |= (u3r_byte(0, a) & ((1 << (1 << bl)) - 1)) << (bit & 7);
+    }
+  }
+
+  //  nop_y operands (1..3) sharing one meta, already _check'd
+  static u3_noun
+  _la_lanes_slam(c3_y nop_y, u3_noun* dat_u, u3_noun shape, u3_noun bloq, u3_noun gat)
+  {
+    c3_d bl  = u3x_atom(bloq);
+    c3_d len = _get_length(shape);
+    c3_d syz = ((len << bl) + 7) >> 3;
+
+    _la_view vew_u[3];
+    c3_y*    buf_y[3];
+    for ( c3_y j = 0; j < nop_y; j++ ) {
+      buf_y[j] = _la_view_get(&vew_u[j], dat_u[j], syz, bl);
+    }
+
+    //  lanes plus the 0x1 pin in lane len
+    u3i_slab r_sab;
+    u3i_slab_init(&r_sab, 3, (((len + 1) << bl) + 7) >> 3);
+
+    u3j_site sit_u;
+    u3j_gate_prep(&sit_u, u3k(gat));
+    for ( c3_d i = 0; i < len; i++ ) {
+      u3_noun sam;
+      switch ( nop_y ) {
+        case 1:  sam = _la_lane_get(buf_y[0], i, bl);
+                 break;
+        case 2:  sam = u3nc(_la_lane_get(buf_y[0], i, bl),
+                            _la_lane_get(buf_y[1], i, bl));
+                 break;
+        default: sam = u3nt(_la_lane_get(buf_y[0], i, bl),
+                            _la_lane_get(buf_y[1], i, bl),
+                            _la_lane_get(buf_y[2], i, bl));
+                 break;
+      }
+      u3_noun pro = u3j_gate_slam(&sit_u, sam);
+      if ( c3n == u3ud(pro) ) {
+        return u3m_bail(c3__exit);
+      }
+      _la_lane_put(r_sab.buf_y, i, bl, pro);
+      u3z(pro);
+    }
+    u3j_gate_lose(&sit_u);
+    _la_lane_put(r_sab.buf_y, len, bl, 1);
+
+    for ( c3_y j = 0; j < nop_y; j++ ) {
+      _la_view_put(&vew_u[j]);
+    }
+    return _la_mint(&r_sab);
+  }
+
+  static u3_noun
+  _la_w_add(u3_noun cor)
   {
     // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data,
@@ -2223,8 +3704,7 @@
       } else {
         switch (x_kind) {
           case c3__i754:
-            _set_rounding_la(rnd);
-            u3_noun r_data = u3qi_la_add_i754(x_data, y_data, x_shape, x_bloq);
+            u3_noun r_data = u3qi_la_add_i754(x_data, y_data, x_shape, x_bloq, _la_rnd_of(rnd));
             if (r_data == u3_none) { return u3_none; }
             return u3nc(u3nq(u3k(x_shape), u3k(x_bloq), u3k(x_kind), u3k(x_tail)), r_data);
 
@@ -2235,8 +3715,8 @@
     }
   }
 
-  u3_noun
-  u3wi_la_sub(u3_noun cor)
+  static u3_noun
+  _la_w_sub(u3_noun cor)
   {
       // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data,
@@ -2269,8 +3749,7 @@
       } else {
         switch (x_kind) {
           case c3__i754:
-            _set_rounding_la(rnd);
-            u3_noun r_data = u3qi_la_sub_i754(x_data, y_data, x_shape, x_bloq);
+            u3_noun r_data = u3qi_la_sub_i754(x_data, y_data, x_shape, x_bloq, _la_rnd_of(rnd));
             if (r_data == u3_none) { return u3_none; }
             return u3nc(u3nq(u3k(x_shape), u3k(x_bloq), u3k(x_kind), u3k(x_tail)), r_data);
 
@@ -2281,8 +3760,8 @@
     }
   }
 
-  u3_noun
-  u3wi_la_mul(u3_noun cor)
+  static u3_noun
+  _la_w_mul(u3_noun cor)
   {
       // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data,
@@ -2315,8 +3794,7 @@
       } else {
         switch (x_kind) {
           case c3__i754:
-            _set_rounding_la(rnd);
-            u3_noun r_data = u3qi_la_mul_i754(x_data, y_data, x_shape, x_bloq);
+            u3_noun r_data = u3qi_la_mul_i754(x_data, y_data, x_shape, x_bloq, _la_rnd_of(rnd));
             if (r_data == u3_none) { return u3_none; }
             return u3nc(u3nq(u3k(x_shape), u3k(x_bloq), u3k(x_kind), u3k(x_tail)), r_data);
 
@@ -2327,8 +3805,8 @@
     }
   }
 
-  u3_noun
-  u3wi_la_div(u3_noun cor)
+  static u3_noun
+  _la_w_div(u3_noun cor)
   {
       // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data,
@@ -2361,8 +3839,7 @@
       } else {
         switch (x_kind) {
           case c3__i754:
-            _set_rounding_la(rnd);
-            u3_noun r_data = u3qi_la_div_i754(x_data, y_data, x_shape, x_bloq);
+            u3_noun r_data = u3qi_la_div_i754(x_data, y_data, x_shape, x_bloq, _la_rnd_of(rnd));
             if (r_data == u3_none) { return u3_none; }
             return u3nc(u3nq(u3k(x_shape), u3k(x_bloq), u3k(x_kind), u3k(x_tail)), r_data);
 
@@ -2373,8 +3850,8 @@
     }
   }
 
-  u3_noun
-  u3wi_la_mod(u3_noun cor)
+  static u3_noun
+  _la_w_mod(u3_noun cor)
   {
       // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data,
@@ -2407,8 +3884,7 @@
       } else {
         switch (x_kind) {
           case c3__i754:
-            _set_rounding_la(rnd);
-            u3_noun r_data = u3qi_la_mod_i754(x_data, y_data, x_shape, x_bloq);
+            u3_noun r_data = u3qi_la_mod_i754(x_data, y_data, x_shape, x_bloq, _la_rnd_of(rnd));
             if (r_data == u3_none) { return u3_none; }
             return u3nc(u3nq(u3k(x_shape), u3k(x_bloq), u3k(x_kind), u3k(x_tail)), r_data);
 
@@ -2419,8 +3895,22 @@
     }
   }
 
-  u3_noun
-  u3wi_la_cumsum(u3_noun cor)
+/* Box a scalar reduction result as a ray, as +scalar-to-ray does: the shape
+** is all 1s at the input's rank.  The data already carries its 0x1 pin.
+*/
+  static u3_noun
+  _la_scalar_box(u3_noun x_shape, u3_noun x_bloq, u3_noun x_kind,
+                 u3_noun x_tail, u3_noun r_data)
+  {
+    c3_d rank = 0;  u3_noun s = x_shape;
+    while ( c3y == u3du(s) ) { rank++;  s = u3t(s); }
+    u3_noun sh = u3_nul;
+    for ( c3_d i = 0; i < rank; i++ ) sh = u3nc(0x1, sh);
+    return u3nc(u3nq(sh, u3k(x_bloq), u3k(x_kind), u3k(x_tail)), r_data);
+  }
+
+  static u3_noun
+  _la_w_cumsum(u3_noun cor)
   {
     // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data;
@@ -2448,8 +3938,7 @@
       } else {
         switch (x_kind) {
           case c3__i754:
-            _set_rounding_la(rnd);
-            u3_noun r_data = u3qi_la_cumsum_i754(x_data, x_shape, x_bloq);
+            u3_noun r_data = u3qi_la_cumsum_i754(x_data, x_shape, x_bloq, _la_rnd_of(rnd));
             if (r_data == u3_none) { return u3_none; }
             return u3nc(u3nq(u3nc(0x1, u3_nul), u3k(x_bloq), u3k(x_kind), u3k(x_tail)), r_data);
 
@@ -2460,8 +3949,8 @@
     }
   }
 
-  u3_noun
-  u3wi_la_argmin(u3_noun cor)
+  static u3_noun
+  _la_w_argmin(u3_noun cor)
   {
     // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data;
@@ -2497,8 +3986,8 @@
     }
   }
 
-  u3_noun
-  u3wi_la_ravel(u3_noun cor)
+  static u3_noun
+  _la_w_ravel(u3_noun cor)
   {
     // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data;
@@ -2534,8 +4023,8 @@
     }
   }
 
-  u3_noun
-  u3wi_la_argmax(u3_noun cor)
+  static u3_noun
+  _la_w_argmax(u3_noun cor)
   {
     // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data;
@@ -2571,8 +4060,8 @@
     }
   }
 
-  u3_noun
-  u3wi_la_min(u3_noun cor)
+  static u3_noun
+  _la_w_min(u3_noun cor)
   {
     // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data;
@@ -2609,8 +4098,8 @@
     }
   }
 
-  u3_noun
-  u3wi_la_max(u3_noun cor)
+  static u3_noun
+  _la_w_max(u3_noun cor)
   {
     // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data;
@@ -2647,8 +4136,8 @@
     }
   }
 
-  u3_noun
-  u3wi_la_abs(u3_noun cor)
+  static u3_noun
+  _la_w_abs(u3_noun cor)
   {
     // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data;
@@ -2684,8 +4173,8 @@
     }
   }
 
-  u3_noun
-  u3wi_la_gth(u3_noun cor)
+  static u3_noun
+  _la_w_gth(u3_noun cor)
   {
     // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data,
@@ -2725,8 +4214,8 @@
     }
   }
 
-  u3_noun
-  u3wi_la_gte(u3_noun cor)
+  static u3_noun
+  _la_w_gte(u3_noun cor)
   {
     // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data,
@@ -2766,8 +4255,8 @@
     }
   }
 
-  u3_noun
-  u3wi_la_lth(u3_noun cor)
+  static u3_noun
+  _la_w_lth(u3_noun cor)
   {
     // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data,
@@ -2807,8 +4296,8 @@
     }
   }
 
-  u3_noun
-  u3wi_la_lte(u3_noun cor)
+  static u3_noun
+  _la_w_lte(u3_noun cor)
   {
     // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data,
@@ -2848,8 +4337,8 @@
     }
   }
 
-  u3_noun
-  u3wi_la_adds(u3_noun cor)
+  static u3_noun
+  _la_w_adds(u3_noun cor)
   {
     // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data, n;
@@ -2872,8 +4361,7 @@
       rnd = u3h(u3t(u3t(u3t(cor))));  // 30
       switch (x_kind) {
         case c3__i754:
-          _set_rounding_la(rnd);
-          u3_noun r_data = u3qi_la_adds_i754(x_data, n, x_shape, x_bloq);
+          u3_noun r_data = u3qi_la_adds_i754(x_data, n, x_shape, x_bloq, _la_rnd_of(rnd));
           if (r_data == u3_none) { return u3_none; }
           return u3nc(u3nq(u3k(x_shape), u3k(x_bloq), u3k(x_kind), u3k(x_tail)), r_data);
 
@@ -2883,8 +4371,8 @@
     }
   }
 
-  u3_noun
-  u3wi_la_subs(u3_noun cor)
+  static u3_noun
+  _la_w_subs(u3_noun cor)
   {
     // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data, n;
@@ -2907,8 +4395,7 @@
       rnd = u3h(u3t(u3t(u3t(cor))));  // 30
       switch (x_kind) {
         case c3__i754:
-          _set_rounding_la(rnd);
-          u3_noun r_data = u3qi_la_subs_i754(x_data, n, x_shape, x_bloq);
+          u3_noun r_data = u3qi_la_subs_i754(x_data, n, x_shape, x_bloq, _la_rnd_of(rnd));
           if (r_data == u3_none) { return u3_none; }
           return u3nc(u3nq(u3k(x_shape), u3k(x_bloq), u3k(x_kind), u3k(x_tail)), r_data);
 
@@ -2918,8 +4405,8 @@
     }
   }
 
-  u3_noun
-  u3wi_la_muls(u3_noun cor)
+  static u3_noun
+  _la_w_muls(u3_noun cor)
   {
     // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data, n;
@@ -2942,8 +4429,7 @@
       rnd = u3h(u3t(u3t(u3t(cor))));  // 30
       switch (x_kind) {
         case c3__i754:
-          _set_rounding_la(rnd);
-          u3_noun r_data = u3qi_la_muls_i754(x_data, n, x_shape, x_bloq);
+          u3_noun r_data = u3qi_la_muls_i754(x_data, n, x_shape, x_bloq, _la_rnd_of(rnd));
           if (r_data == u3_none) { return u3_none; }
           return u3nc(u3nq(u3k(x_shape), u3k(x_bloq), u3k(x_kind), u3k(x_tail)), r_data);
 
@@ -2953,8 +4439,8 @@
     }
   }
 
-  u3_noun
-  u3wi_la_divs(u3_noun cor)
+  static u3_noun
+  _la_w_divs(u3_noun cor)
   {
     // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data, n;
@@ -2977,8 +4463,7 @@
       rnd = u3h(u3t(u3t(u3t(cor))));  // 30
       switch (x_kind) {
         case c3__i754:
-          _set_rounding_la(rnd);
-          u3_noun r_data = u3qi_la_divs_i754(x_data, n, x_shape, x_bloq);
+          u3_noun r_data = u3qi_la_divs_i754(x_data, n, x_shape, x_bloq, _la_rnd_of(rnd));
           if (r_data == u3_none) { return u3_none; }
           return u3nc(u3nq(u3k(x_shape), u3k(x_bloq), u3k(x_kind), u3k(x_tail)), r_data);
 
@@ -2988,8 +4473,8 @@
     }
   }
 
-  u3_noun
-  u3wi_la_mods(u3_noun cor)
+  static u3_noun
+  _la_w_mods(u3_noun cor)
   {
     // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data, n;
@@ -3012,8 +4497,7 @@
       rnd = u3h(u3t(u3t(u3t(cor))));  // 30
       switch (x_kind) {
         case c3__i754:
-          _set_rounding_la(rnd);
-          u3_noun r_data = u3qi_la_mods_i754(x_data, n, x_shape, x_bloq);
+          u3_noun r_data = u3qi_la_mods_i754(x_data, n, x_shape, x_bloq, _la_rnd_of(rnd));
           if (r_data == u3_none) { return u3_none; }
           return u3nc(u3nq(u3k(x_shape), u3k(x_bloq), u3k(x_kind), u3k(x_tail)), r_data);
 
@@ -3023,8 +4507,8 @@
     }
   }
 
-  u3_noun
-  u3wi_la_dot(u3_noun cor)
+  static u3_noun
+  _la_w_dot(u3_noun cor)
   {
     // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data,
@@ -3056,14 +4540,19 @@
       } else {
         switch (x_kind) {
           case c3__i754:
-            _set_rounding_la(rnd);
-            u3_noun r_data = u3qi_la_dot_i754(x_data, y_data, x_shape, x_bloq);
+            u3_noun r_data = u3qi_la_dot_i754(x_data, y_data, x_shape, x_bloq, _la_rnd_of(rnd));
             if (r_data == u3_none) { return u3_none; }
             c3_d *dim_x = _get_dims(x_shape);
             c3_d len_x0 = dim_x[0];
             u3a_free(dim_x);
             return u3nc(u3nq(u3nt(len_x0, 0x1, u3_nul), u3k(x_bloq), u3k(x_kind), u3k(x_tail)), r_data);
 
+          case c3__cplx: {
+            u3_noun r_data = u3qi_la_dot_cplx(x_data, y_data, x_shape, x_bloq, _la_rnd_of(rnd));
+            if (r_data == u3_none) { return u3_none; }
+            return _la_scalar_box(x_shape, x_bloq, x_kind, x_tail, r_data);
+          }
+
           default:
             return u3_none;
         }
@@ -3071,8 +4560,54 @@
     }
   }
 
-  u3_noun
-  u3wi_la_transpose(u3_noun cor)
+  static u3_noun
+  _la_w_dotc(u3_noun cor)
+  {
+    // Each argument is a ray, [=meta data=@ux]
+    u3_noun x_meta, x_data,
+            y_meta, y_data;
+
+    if ( c3n == u3r_mean(cor,
+                         {u3x_sam_4, &x_meta},
+                         {u3x_sam_5, &x_data},
+                         {u3x_sam_6, &y_meta},
+                         {u3x_sam_7, &y_data}) ||
+         c3n == u3r_sing(x_meta, y_meta) ||
+         c3n == u3ud(x_data) ||
+         c3n == u3ud(y_data) )
+    {
+      return u3m_bail(c3__exit);
+    } else {
+      u3_noun x_shape, x_bloq, x_kind, x_tail,
+              rnd;
+      x_shape = u3h(x_meta);          //  2
+      x_bloq = u3h(u3t(x_meta));      //  6
+      x_kind = u3h(u3t(u3t(x_meta))); // 14
+      x_tail = u3t(u3t(u3t(x_meta))); // 15
+      rnd = u3h(u3t(u3t(u3t(cor))));  // 30
+      if ( c3n == u3ud(x_bloq) ||
+           c3n == u3ud(x_kind)
+         )
+      {
+        return u3m_bail(c3__exit);
+      } else {
+        switch (x_kind) {
+          //  conj is the identity on real kinds; let +dotc call the +dot jet
+          case c3__cplx: {
+            u3_noun r_data = u3qi_la_dotc_cplx(x_data, y_data, x_shape, x_bloq, _la_rnd_of(rnd));
+            if (r_data == u3_none) { return u3_none; }
+            return _la_scalar_box(x_shape, x_bloq, x_kind, x_tail, r_data);
+          }
+
+          default:
+            return u3_none;
+        }
+      }
+    }
+  }
+
+  static u3_noun
+  _la_w_transpose(u3_noun cor)
   {
     // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data;
@@ -3091,20 +4626,50 @@
       x_tail = u3t(u3t(u3t(x_meta))); // 15
       if ( c3n == u3ud(x_bloq) ||
            c3n == u3ud(x_kind) ||
-           c3n == _check(cor)
+           c3n == _check(u3nc(x_meta, x_data))
          )
       {
         return u3m_bail(c3__exit);
       } else {
         u3_noun r_data = u3qi_la_transpose(x_data, x_shape, x_bloq);
         if (r_data == u3_none) { return u3_none; }
-        return u3nc(u3nq(u3nt(u3k(u3h(x_shape)), u3k(u3h(u3t(x_shape))), u3_nul), u3k(x_bloq), u3k(x_kind), u3k(x_tail)), r_data);
+        return u3nc(u3nq(u3nt(u3k(u3h(u3t(x_shape))), u3k(u3h(x_shape)), u3_nul), u3k(x_bloq), u3k(x_kind), u3k(x_tail)), r_data);
       }
     }
   }
 
-  u3_noun
-  u3wi_la_linspace(u3_noun cor)
+  static u3_noun
+  _la_w_permute(u3_noun cor)
+  {
+    u3_noun x_meta, x_data, perm;
+
+    if ( c3n == u3r_mean(cor,
+                         {u3x_sam_4, &x_meta},
+                         {u3x_sam_5, &x_data},
+                         {u3x_sam_3, &perm}) ||
+         c3n == u3ud(x_data) )
+    {
+      return u3m_bail(c3__exit);
+    } else {
+      u3_noun x_shape, x_bloq, x_kind, x_tail;
+      x_shape = u3h(x_meta);          //  2
+      x_bloq = u3h(u3t(x_meta));      //  6
+      x_kind = u3h(u3t(u3t(x_meta))); // 14
+      x_tail = u3t(u3t(u3t(x_meta))); // 15
+      if ( c3n == u3ud(x_bloq) ||
+           c3n == _check(u3nc(x_meta, x_data))
+         )
+      {
+        return u3m_bail(c3__exit);
+      } else {
+        // result is already [meta data]
+        return u3qi_la_permute(x_data, x_shape, perm, x_bloq, x_kind, x_tail);
+      }
+    }
+  }
+
+  static u3_noun
+  _la_w_linspace(u3_noun cor)
   {
     u3_noun x_meta, a, b, n, rnd;
 
@@ -3132,8 +4697,7 @@
       } else {
         switch (x_kind) {
           case c3__i754:
-            _set_rounding_la(rnd);
-            u3_noun r_data = u3qi_la_linspace_i754(a, b, n, x_bloq);
+            u3_noun r_data = u3qi_la_linspace_i754(a, b, n, x_bloq, _la_rnd_of(rnd));
             if (r_data == u3_none) { return u3_none; }
             x_shape = u3nc(u3x_atom(n), u3_nul);
             return u3nc(u3nq(u3k(x_shape), u3k(x_bloq), u3k(x_kind), u3k(x_tail)), r_data);
@@ -3145,8 +4709,8 @@
     }
   }
 
-  u3_noun
-  u3wi_la_range(u3_noun cor)
+  static u3_noun
+  _la_w_range(u3_noun cor)
   {
     u3_noun x_meta, a, b, d, rnd;
 
@@ -3172,35 +4736,34 @@
       } else {
         switch (x_kind) {
           case c3__i754:
-            _set_rounding_la(rnd);
-            u3_noun r_data = u3qi_la_range_i754(a, b, d, x_bloq);
+            u3_noun r_data = u3qi_la_range_i754(a, b, d, x_bloq, _la_rnd_of(rnd));
             if (r_data == u3_none) { return u3_none; }
             c3_d a_, b_, d_;
             c3_ds n_;
             switch (x_bloq) {
               case 4:
-                u3r_bytes(0, 2, (c3_y*)&a_, a);
-                u3r_bytes(0, 2, (c3_y*)&b_, b);
-                u3r_bytes(0, 2, (c3_y*)&d_, d);
+                _la_rbytes(0, 2, (c3_y*)&a_, a);
+                _la_rbytes(0, 2, (c3_y*)&b_, b);
+                _la_rbytes(0, 2, (c3_y*)&d_, d);
                 n_ = f16_to_i64(f16_ceil(f16_div(f16_sub((float16_t){b_}, (float16_t){a_}), (float16_t){d_})), softfloat_round_minMag, false) - 1;
                 break;
               case 5:
-                u3r_bytes(0, 4, (c3_y*)&a_, a);
-                u3r_bytes(0, 4, (c3_y*)&b_, b);
-                u3r_bytes(0, 4, (c3_y*)&d_, d);
+                _la_rbytes(0, 4, (c3_y*)&a_, a);
+                _la_rbytes(0, 4, (c3_y*)&b_, b);
+                _la_rbytes(0, 4, (c3_y*)&d_, d);
                 n_ = f32_to_i64(f32_ceil(f32_div(f32_sub((float32_t){b_}, (float32_t){a_}), (float32_t){d_})), softfloat_round_minMag, false) - 1;
                 break;
               case 6:
-                u3r_bytes(0, 8, (c3_y*)&a_, a);
-                u3r_bytes(0, 8, (c3_y*)&b_, b);
-                u3r_bytes(0, 8, (c3_y*)&d_, d);
+                _la_rbytes(0, 8, (c3_y*)&a_, a);
+                _la_rbytes(0, 8, (c3_y*)&b_, b);
+                _la_rbytes(0, 8, (c3_y*)&d_, d);
                 n_ = f64_to_i64(f64_ceil(f64_div(f64_sub((float64_t){b_}, (float64_t){a_}), (float64_t){d_})), softfloat_round_minMag, false) - 1;
                 break;
               case 7: {
                 c3_d a__[2], b__[2], d__[2];
-                u3r_bytes(0, 16, (c3_y*)&a__, a);
-                u3r_bytes(0, 16, (c3_y*)&b__, b);
-                u3r_bytes(0, 16, (c3_y*)&d__, d);
+                _la_rbytes(0, 16, (c3_y*)&a__, a);
+                _la_rbytes(0, 16, (c3_y*)&b__, b);
+                _la_rbytes(0, 16, (c3_y*)&d__, d);
                 float128_t tmp;
                 f128M_sub((float128_t*)&b__, (float128_t*)&a__, &tmp);
                 f128M_div(&tmp, (float128_t*)&d__, &tmp);
@@ -3219,8 +4782,8 @@
     }
   }
 
-  u3_noun
-  u3wi_la_diag(u3_noun cor)
+  static u3_noun
+  _la_w_diag(u3_noun cor)
   {
     // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data;
@@ -3254,8 +4817,8 @@
     }
   }
 
-  u3_noun
-  u3wi_la_trace(u3_noun cor)
+  static u3_noun
+  _la_w_trace(u3_noun cor)
   {
     // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data;
@@ -3279,7 +4842,8 @@
       } else {
         switch (x_kind) {
           case c3__i754: {
-            u3_noun r_data = u3qi_la_trace_i754(x_data, x_shape, x_bloq);
+            u3_noun rnd = u3h(u3t(u3t(u3t(cor))));  // 30
+            u3_noun r_data = u3qi_la_trace_i754(x_data, x_shape, x_bloq, _la_rnd_of(rnd));
             if (r_data == u3_none) { return u3_none; }
             return u3nc(u3nq(u3nt(0x1, 0x1, u3_nul), u3k(x_bloq), u3k(x_kind), u3k(x_tail)), r_data);}
 
@@ -3290,8 +4854,8 @@
     }
   }
 
-  u3_noun
-  u3wi_la_mmul(u3_noun cor)
+  static u3_noun
+  _la_w_mmul(u3_noun cor)
   {
     // Each argument is a ray, [=meta data=@ux]
     u3_noun x_meta, x_data,
@@ -3323,14 +4887,318 @@
       } else {
         switch (x_kind) {
           case c3__i754:
-            _set_rounding_la(rnd);
-            u3_noun r_data = u3qi_la_mmul_i754(x_data, y_data, x_shape, y_shape, x_bloq);
+            u3_noun r_data = u3qi_la_mmul_i754(x_data, y_data, x_shape, y_shape, x_bloq, _la_rnd_of(rnd));
             // result is already [meta data]
             return r_data;
 
+          case c3__cplx: {
+            if ( c3n == u3r_sing(u3t(u3t(x_meta)), u3t(u3t(y_meta))) ||
+                 c3n == u3r_sing(x_bloq, u3h(u3t(y_meta))) )
+            {
+              return u3_none;
+            }
+            // result is already [meta data]
+            return u3qi_la_mmul_cplx(x_data, y_data, x_shape, y_shape, x_bloq, _la_rnd_of(rnd));
+          }
+
           default:
             return u3_none;
         }
       }
     }
   }
+
+  static u3_noun
+  _la_w_el_wise_op(u3_noun cor)
+  {
+    u3_noun x_meta, x_data, gat;
+
+    if ( c3n == u3r_mean(cor,
+                         {u3x_sam_4, &x_meta},
+                         {u3x_sam_5, &x_data},
+                         {u3x_sam_3, &gat}) ||
+         c3n == u3ud(x_data) ||
+         c3n == u3ud(u3h(u3t(x_meta))) ||
+         c3n == _check(u3nc(x_meta, x_data)) )
+    {
+      return u3m_bail(c3__exit);
+    } else {
+      u3_noun dat_u[1] = { x_data };
+      u3_noun r_data = _la_lanes_slam(1, dat_u, u3h(x_meta), u3h(u3t(x_meta)), gat);
+      return u3nc(u3k(x_meta), r_data);
+    }
+  }
+
+  static u3_noun
+  _la_w_bin_op(u3_noun cor)
+  {
+    u3_noun x_meta, x_data,
+            y_meta, y_data, gat;
+
+    if ( c3n == u3r_mean(cor,
+                         {u3x_sam_4, &x_meta},
+                         {u3x_sam_5, &x_data},
+                         {u3x_sam_12, &y_meta},
+                         {u3x_sam_13, &y_data},
+                         {u3x_sam_7, &gat}) ||
+         c3n == u3ud(x_data) ||
+         c3n == u3ud(y_data) ||
+         c3n == u3ud(u3h(u3t(x_meta))) ||
+         c3n == u3r_sing(x_meta, y_meta) ||
+         c3n == _check(u3nc(x_meta, x_data)) ||
+         c3n == _check(u3nc(y_meta, y_data)) )
+    {
+      return u3m_bail(c3__exit);
+    } else {
+      u3_noun dat_u[2] = { x_data, y_data };
+      u3_noun r_data = _la_lanes_slam(2, dat_u, u3h(x_meta), u3h(u3t(x_meta)), gat);
+      return u3nc(u3k(x_meta), r_data);
+    }
+  }
+
+  static u3_noun
+  _la_w_ter_op(u3_noun cor)
+  {
+    u3_noun x_meta, x_data,
+            y_meta, y_data,
+            z_ray, z_meta, z_data, gat;
+
+    if ( c3n == u3r_mean(cor,
+                         {u3x_sam_4, &x_meta},
+                         {u3x_sam_5, &x_data},
+                         {u3x_sam_12, &y_meta},
+                         {u3x_sam_13, &y_data},
+                         {u3x_sam_14, &z_ray},
+                         {u3x_sam_15, &gat}) ||
+         c3n == u3r_cell(z_ray, &z_meta, &z_data) ||
+         c3n == u3ud(x_data) ||
+         c3n == u3ud(y_data) ||
+         c3n == u3ud(z_data) ||
+         c3n == u3ud(u3h(u3t(x_meta))) ||
+         c3n == u3r_sing(x_meta, y_meta) ||
+         c3n == u3r_sing(z_meta, y_meta) ||
+         c3n == _check(u3nc(x_meta, x_data)) ||
+         c3n == _check(u3nc(y_meta, y_data)) ||
+         c3n == _check(u3nc(z_meta, z_data)) )
+    {
+      return u3m_bail(c3__exit);
+    } else {
+      u3_noun dat_u[3] = { x_data, y_data, z_data };
+      u3_noun r_data = _la_lanes_slam(3, dat_u, u3h(x_meta), u3h(u3t(x_meta)), gat);
+      return u3nc(u3k(x_meta), r_data);
+    }
+  }
+
+  static u3_noun
+  _la_w_prod(u3_noun cor)
+  {
+    // Each argument is a ray, [=meta data=@ux]
+    u3_noun x_meta, x_data;
+
+    if ( c3n == u3r_mean(cor,
+                         {u3x_sam_2, &x_meta},
+                         {u3x_sam_3, &x_data}) ||
+         c3n == u3ud(x_data) )
+    {
+      return u3m_bail(c3__exit);
+    } else {
+      u3_noun x_shape, x_bloq, x_kind, x_tail,
+              rnd;
+      x_shape = u3h(x_meta);          //  2
+      x_bloq = u3h(u3t(x_meta));      //  6
+      x_kind = u3h(u3t(u3t(x_meta))); // 14
+      x_tail = u3t(u3t(u3t(x_meta))); // 15
+      rnd = u3h(u3t(u3t(u3t(cor))));  // 30
+      if ( c3n == u3ud(x_bloq) ||
+           c3n == u3ud(x_kind) ||
+           c3n == _check(u3nc(x_meta, x_data))
+         )
+      {
+        return u3m_bail(c3__exit);
+      } else {
+        //  the whole ray is one fiber
+        u3_noun flat = u3nc(u3i_chub(_get_length(x_shape)), u3_nul);
+        u3_noun r_data = _la_reduce(x_data, flat, x_bloq, x_kind, 0, _LA_RPROD, c3n, _la_rnd_of(rnd));
+        u3z(flat);
+        if (r_data == u3_none) { return u3_none; }
+        return _la_scalar_box(x_shape, x_bloq, x_kind, x_tail, r_data);
+      }
+    }
+  }
+
+/* shared body of the +*-axis wrappers; sample is [a=ray axis=@ud]
+*/
+  static u3_noun
+  _la_wi_reduce(u3_noun cor, _la_rop op, c3_o arg_o)
+  {
+    u3_noun x_meta, x_data, axis;
+
+    if ( c3n == u3r_mean(cor,
+                         {u3x_sam_4, &x_meta},
+                         {u3x_sam_5, &x_data},
+                         {u3x_sam_3, &axis}) ||
+         c3n == u3ud(x_data) ||
+         c3n == u3ud(axis) )
+    {
+      return u3m_bail(c3__exit);
+    } else {
+      u3_noun x_shape, x_bloq, x_kind, x_tail,
+              rnd;
+      x_shape = u3h(x_meta);          //  2
+      x_bloq = u3h(u3t(x_meta));      //  6
+      x_kind = u3h(u3t(u3t(x_meta))); // 14
+      x_tail = u3t(u3t(u3t(x_meta))); // 15
+      rnd = u3h(u3t(u3t(u3t(cor))));  // 30
+      if ( c3n == u3ud(x_bloq) ||
+           c3n == u3ud(x_kind) ||
+           c3n == _check(u3nc(x_meta, x_data))
+         )
+      {
+        return u3m_bail(c3__exit);
+      } else {
+        if ( c3n == u3a_is_cat(axis) ) {
+          return u3_none;
+        }
+        u3_noun r_data = _la_reduce(x_data, x_shape, x_bloq, x_kind, axis, op, arg_o, _la_rnd_of(rnd));
+        if (r_data == u3_none) { return u3_none; }
+        return u3nc(_la_reduce_meta(x_shape, x_bloq, x_kind, x_tail, axis, arg_o), r_data);
+      }
+    }
+  }
+
+  static u3_noun
+  _la_w_sum_axis(u3_noun cor)
+  {
+    return _la_wi_reduce(cor, _LA_RSUM, c3n);
+  }
+
+  static u3_noun
+  _la_w_prod_axis(u3_noun cor)
+  {
+    return _la_wi_reduce(cor, _LA_RPROD, c3n);
+  }
+
+  static u3_noun
+  _la_w_max_axis(u3_noun cor)
+  {
+    return _la_wi_reduce(cor, _LA_RMAX, c3n);
+  }
+
+  static u3_noun
+  _la_w_min_axis(u3_noun cor)
+  {
+    return _la_wi_reduce(cor, _LA_RMIN, c3n);
+  }
+
+  static u3_noun
+  _la_w_argmax_axis(u3_noun cor)
+  {
+    return _la_wi_reduce(cor, _LA_RMAX, c3y);
+  }
+
+  static u3_noun
+  _la_w_argmin_axis(u3_noun cor)
+  {
+    return _la_wi_reduce(cor, _LA_RMIN, c3y);
+  }
+
+
+/* per-jet statistics (jets/i/jstat.h)
+**
+** Each u3wi_la_* runs its _la_w_* body under U3QI_JST, keyed by the kind
+** and bloq of its first ray, so a kind or bloq that falls through to
+** `u3_none` shows up as a punt against that key.  The key is only looked
+** for when U3_JET_STATS is on.
+*/
+  //  c3y if [met] looks like a ray's meta, [shape bloq kind tail], with
+  //  [kind] a short cord; the kind need not be one this file knows
+  static c3_o
+  _la_jst_meta(u3_noun met, c3_m* kind_m, c3_y* bloq_y)
+  {
+    u3_noun shp, blq, kin, tal;
+
+    if ( c3n == u3r_qual(met, &shp, &blq, &kin, &tal) ) {
+      return c3n;
+    }
+    if ( (c3n == u3a_is_cat(blq)) || (blq > 31) ||
+         (c3n == u3a_is_cat(kin)) || (0 == kin) ||
+         ((u3_nul != shp) && (c3n == u3du(shp))) )
+    {
+      return c3n;
+    }
+    for ( c3_w kin_w = kin; kin_w; kin_w >>= 8 ) {
+      c3_y c_y = kin_w & 0xff;
+      if ( !(((c_y >= 'a') && (c_y <= 'z')) || ((c_y >= '0') && (c_y <= '9'))) ) {
+        return c3n;
+      }
+    }
+    *kind_m = (c3_m)kin;
+    *bloq_y = (c3_y)blq;
+    return c3y;
+  }
+
+  static u3_noun
+  _la_jst(u3_noun cor, const c3_c* arm_c, u3_noun (*fun_f)(u3_noun))
+  {
+    c3_m kind_m = 0;
+    c3_y bloq_y = 0;
+
+    if ( c3y == u3qi_jst_on_o ) {
+      u3_noun sam = u3r_at(u3x_sam, cor);
+
+      //  the sample is a ray, or a ray or meta comes first
+      if ( (u3_none != sam) && (c3y == u3du(sam)) &&
+           (c3n == _la_jst_meta(u3h(sam), &kind_m, &bloq_y)) &&
+           (c3y == u3du(u3h(sam))) )
+      {
+        _la_jst_meta(u3h(u3h(sam)), &kind_m, &bloq_y);
+      }
+    }
+    return U3QI_JST("la", arm_c, kind_m, bloq_y, fun_f(cor));
+  }
+
+#define _LA_JST(nam)                                                           \
+  u3_noun u3wi_la_##nam(u3_noun cor) { return _la_jst(cor, #nam, _la_w_##nam); }
+
+  _LA_JST(add)
+  _LA_JST(sub)
+  _LA_JST(mul)
+  _LA_JST(div)
+  _LA_JST(mod)
+  _LA_JST(cumsum)
+  _LA_JST(argmin)
+  _LA_JST(ravel)
+  _LA_JST(argmax)
+  _LA_JST(min)
+  _LA_JST(max)
+  _LA_JST(abs)
+  _LA_JST(gth)
+  _LA_JST(gte)
+  _LA_JST(lth)
+  _LA_JST(lte)
+  _LA_JST(adds)
+  _LA_JST(subs)
+  _LA_JST(muls)
+  _LA_JST(divs)
+  _LA_JST(mods)
+  _LA_JST(dot)
+  _LA_JST(dotc)
+  _LA_JST(transpose)
+  _LA_JST(permute)
+  _LA_JST(linspace)
+  _LA_JST(range)
+  _LA_JST(diag)
+  _LA_JST(trace)
+  _LA_JST(mmul)
+  _LA_JST(el_wise_op)
+  _LA_JST(bin_op)
+  _LA_JST(ter_op)
+  _LA_JST(prod)
+  _LA_JST(sum_axis)
+  _LA_JST(prod_axis)
+  _LA_JST(max_axis)
+  _LA_JST(min_axis)
+  _LA_JST(argmax_axis)
+  _LA_JST(argmin_axis)
+
+#endif  //  LAGOON_JET_HARNESS
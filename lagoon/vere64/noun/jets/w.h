@@ -410,14 +410,23 @@
     u3_noun u3wi_la_divs(u3_noun);
     u3_noun u3wi_la_mods(u3_noun);
     u3_noun u3wi_la_dot(u3_noun);
+    u3_noun u3wi_la_dotc(u3_noun);
     u3_noun u3wi_la_diag(u3_noun);
     u3_noun u3wi_la_transpose(u3_noun);
+    u3_noun u3wi_la_permute(u3_noun);
     u3_noun u3wi_la_cumsum(u3_noun);
     u3_noun u3wi_la_argmin(u3_noun);
     u3_noun u3wi_la_argmax(u3_noun);
     u3_noun u3wi_la_ravel(u3_noun);
     u3_noun u3wi_la_min(u3_noun);
     u3_noun u3wi_la_max(u3_noun);
+    u3_noun u3wi_la_prod(u3_noun);
+    u3_noun u3wi_la_sum_axis(u3_noun);
+    u3_noun u3wi_la_prod_axis(u3_noun);
+    u3_noun u3wi_la_max_axis(u3_noun);
+    u3_noun u3wi_la_min_axis(u3_noun);
+    u3_noun u3wi_la_argmax_axis(u3_noun);
+    u3_noun u3wi_la_argmin_axis(u3_noun);
     u3_noun u3wi_la_linspace(u3_noun);
     u3_noun u3wi_la_range(u3_noun);
     u3_noun u3wi_la_abs(u3_noun);
@@ -428,6 +437,9 @@
 
     u3_noun u3wi_la_trace(u3_noun);
     u3_noun u3wi_la_mmul(u3_noun);
+    u3_noun u3wi_la_el_wise_op(u3_noun);
+    u3_noun u3wi_la_bin_op(u3_noun);
+    u3_noun u3wi_la_ter_op(u3_noun);
 
 #endif /* ifndef U3_JETS_W_H */
 
@@ -0,0 +1,26 @@
+#!/bin/sh
+# Build + run the native %i754 lane harness against the SAME Berkeley SoftFloat
+# the vere jets use.  The zig-archived .a is not 8-byte aligned for Apple ld, so
+# we re-archive it with libtool (chmod the extracted .o's; they come out
+# read-only).  Pass `full` to also sweep every f32 x (slow).
+set -e
+
+SFINC="$(dirname "$(find "$HOME/urbit" -name softfloat.h 2>/dev/null | grep -i softfloat/source/include | head -1)")"
+SFLIB="$(find "$HOME/urbit/vere-ml64" -name libsoftfloat.a 2>/dev/null | head -1)"
+SBINC="$(dirname "$(find "$HOME/urbit" -name softblas.h 2>/dev/null | grep -i softblas/include | head -1)")"
+SBLIB="$(find "$HOME/urbit/vere-ml64" -name libsoftblas.a 2>/dev/null | head -1)"
+[ -n "$SFINC" ] && [ -n "$SFLIB" ] || { echo "softfloat not found (build vere-ml64 first)"; exit 1; }
+[ -n "$SBINC" ] && [ -n "$SBLIB" ] || { echo "softblas not found (build vere-ml64 first)"; exit 1; }
+
+WORK="$(mktemp -d)"
+for L in "$SFLIB" "$SBLIB"; do
+  N="$(basename "$L")"
+  mkdir "$WORK/${N%.a}"
+  ( cd "$WORK/${N%.a}" && ar x "$L" && chmod u+rw ./*.o && libtool -static -o "$WORK/$N" ./*.o )
+done
+# The harness build also compiles the u3qi kernels over noun_shim.h, so it
+# links SoftBLAS too.
+cc -O2 -ffp-contract=off -I"$(dirname "$0")" -I"$SFINC" -I"$SBINC" "$(dirname "$0")/native_check.c" \
+  "$WORK/libsoftblas.a" "$WORK/libsoftfloat.a" -lm -lpthread -o "$WORK/native_check"
+"$WORK/native_check" "$@"
+rm -rf "$WORK"
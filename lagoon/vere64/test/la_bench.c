@@ -0,0 +1,272 @@
+// la_bench.c -- off-ship size sweep for the Lagoon u3qi kernels.
+//
+// Includes the MASTER jet (noun/jets/lagoon.c; with -DLA_BENCH_VERE the
+// 32-bit vere copy, which adds %int2) with -DLAGOON_JET_HARNESS, so the
+// kernels timed here are byte-for-byte the kernels the runtime jet runs,
+// over noun_shim.h instead of the loom.  Each cell is one op on rays of n
+// lanes, n = 10, 100, ... up to max_n, for every bloq of every kind:
+//
+//   %i754  bloq 4..7   add sub mul div mod adds dot cumsum argmax abs
+//                      transpose mmul
+//   %cplx  bloq 5..8   dot transpose mmul
+//   %int2  bloq 3..6   add sub mul div mod dot argmax transpose (vere only)
+//   %fixp  bloq 3..6   mul div dot mmul, Q(N/2-1).(N/2)   (vere only; its
+//                      add/sub/mod are the %int2 kernels)
+//
+// transpose and mmul take the square ray nearest n, capped at mmul_max
+// lanes (a quarter of that at bloq 7 and for %cplx), as SoftBLAS gemm is
+// cubic.  Operands are built once per cell, outside the timed
+// loop, from finite values in [0.5, 2) (random lanes for %int2 and %fixp,
+// with nonzero divisors).
+//
+// Time is wall clock over enough repetitions to do about 10^7 lane-ops.
+// The shim clocks its marshalling entry points (u3r_bytes, slab init, bare
+// and mint, u3i_bytes), so each cell's time splits into marshalling (getting
+// lanes out of atoms and the result back into one) and compute (the rest).
+// Reported per cell: GFLOP/s over total and over compute time (lane-ops for
+// %int2, %fixp and argmax; transpose does none) and GB/s of operand plus result
+// lanes over total time.  The CSV goes to out.csv, a table to stderr.
+//
+// Build/run: ./la_bench.sh [vere] [out.csv [max_n [mmul_max]]]
+
+#define LAGOON_JET_HARNESS
+#ifdef LA_BENCH_VERE
+#include "../../vere/noun/jets/i/lagoon.c"
+#else
+#include "../noun/jets/lagoon.c"
+#endif
+
+#include <inttypes.h>
+
+static uint64_t rng = 0x9e3779b97f4a7c15ULL;
+static uint64_t rnd64(void) {
+  rng ^= rng << 13; rng ^= rng >> 7; rng ^= rng << 17; return rng;
+}
+
+//  one operand cell: data for x and y, flat and square shapes
+typedef struct {
+  c3_y    kind;       //  'f' %i754, 'c' %cplx, 'i' %int2, 'x' %fixp
+  c3_y    bloq;
+  c3_d    n, m;       //  lanes; side of the square ray (m*m <= n)
+  u3_noun x, y;       //  n lanes
+  u3_noun sx, sy;     //  m*m lanes
+  u3_noun shp, sqr;   //  [n ~], [m m ~]
+  u3_noun one;        //  scalar operand for adds
+  u3_noun prc;        //  %fixp precision [a b]
+} cell;
+
+//  a finite value in [0.5, 2) as a 2^b-bit IEEE lane, little-endian
+static void fill_f(c3_y b, c3_y* p) {
+  c3_d r = rnd64(), s = rnd64();
+  switch ( b ) {
+    case 4: { c3_s v = (c3_s)(((14 + (r & 1)) << 10) | ((r >> 1) & 0x3ff));
+              memcpy(p, &v, 2); break; }
+    case 5: { c3_w v = (c3_w)(((126 + (r & 1)) << 23) | ((r >> 1) & 0x7fffff));
+              memcpy(p, &v, 4); break; }
+    case 6: { c3_d v = ((1022 + (r & 1)) << 52) | ((r >> 1) & 0xfffffffffffffULL);
+              memcpy(p, &v, 8); break; }
+    case 7: { c3_d v[2] = { s, ((16382 + (r & 1)) << 48) | ((r >> 1) & 0xffffffffffffULL) };
+              memcpy(p, v, 16); break; }
+  }
+}
+
+//  a ray's data: [len] lanes of 2^b bits from [kind], then the 0x1 pin
+static u3_noun mk_data(c3_y kind, c3_y b, c3_d len, c3_o div_o) {
+  u3i_slab sab_u;
+  c3_d wyd = (c3_d)1 << (b - 3);
+  u3i_slab_init(&sab_u, b, len + 1);
+  for ( c3_d i = 0; i < len; i++ ) {
+    c3_y* p = sab_u.buf_y + i * wyd;
+    if ( 'f' == kind ) {
+      fill_f(b, p);
+    }
+    else if ( 'c' == kind ) {
+      fill_f(b - 1, p);
+      fill_f(b - 1, p + wyd / 2);
+    }
+    else {
+      for ( c3_d k = 0; k < wyd; k += 8 ) {
+        c3_d r = rnd64();
+        memcpy(p + k, &r, c3_min(8, wyd - k));
+      }
+      if ( c3y == div_o ) {           //  positive and odd: never traps
+        p[0] |= 1;
+        p[wyd - 1] &= 0x7f;
+      }
+    }
+  }
+  sab_u.buf_y[len * wyd] = 1;
+  return u3i_slab_mint(&sab_u);
+}
+
+static void cell_init(cell* c, c3_y kind, c3_y b, c3_d n, c3_d mmul_max) {
+  c3_d cap = ( 7 <= b || 'c' == kind ) ? mmul_max / 4 : mmul_max;
+  c3_d sq  = c3_min(n, cap);
+  c3_d m   = 1;
+  while ( (m + 1) * (m + 1) <= sq ) m++;
+
+  c->kind = kind; c->bloq = b; c->n = n; c->m = m;
+  c->x   = mk_data(kind, b, n, c3n);
+  c->y   = mk_data(kind, b, n, c3y);
+  c->sx  = mk_data(kind, b, m * m, c3n);
+  c->sy  = mk_data(kind, b, m * m, c3n);
+  c->shp = u3nc(u3i_chub(n), u3_nul);
+  c->sqr = u3nt(u3i_chub(m), u3i_chub(m), u3_nul);
+  c->one = mk_data(kind, b, 1, c3n);
+  c->prc = u3nc(((c3_d)1 << (b - 1)) - 1, (c3_d)1 << (b - 1));
+}
+
+static void cell_free(cell* c) {
+  u3z(c->x); u3z(c->y); u3z(c->sx); u3z(c->sy);
+  u3z(c->shp); u3z(c->sqr); u3z(c->one); u3z(c->prc);
+}
+
+//  ops: the call, and per-lane flops and lanes moved (in + out)
+typedef u3_noun (*op_f)(cell*);
+typedef struct {
+  const c3_c* nam;
+  c3_y        kind;
+  op_f        fun;
+  double      flo, lan;       //  per lane of n (per m^3 / m^2 for mmul)
+  c3_o        sqr_o;          //  runs on the square ray
+} op;
+
+#define RN softfloat_round_near_even
+static u3_noun f_add(cell* c)  { return u3qi_la_add_i754(c->x, c->y, c->shp, c->bloq, RN); }
+static u3_noun f_sub(cell* c)  { return u3qi_la_sub_i754(c->x, c->y, c->shp, c->bloq, RN); }
+static u3_noun f_mul(cell* c)  { return u3qi_la_mul_i754(c->x, c->y, c->shp, c->bloq, RN); }
+static u3_noun f_div(cell* c)  { return u3qi_la_div_i754(c->x, c->y, c->shp, c->bloq, RN); }
+static u3_noun f_mod(cell* c)  { return u3qi_la_mod_i754(c->x, c->y, c->shp, c->bloq, RN); }
+static u3_noun f_adds(cell* c) { return u3qi_la_adds_i754(c->x, c->one, c->shp, c->bloq, RN); }
+static u3_noun f_dot(cell* c)  { return u3qi_la_dot_i754(c->x, c->y, c->shp, c->bloq, RN); }
+static u3_noun f_cums(cell* c) { return u3qi_la_cumsum_i754(c->x, c->shp, c->bloq, RN); }
+static u3_noun f_amax(cell* c) { return u3qi_la_argmax_i754(c->x, c->shp, c->bloq); }
+static u3_noun f_abs(cell* c)  { return u3qi_la_abs_i754(c->x, c->shp, c->bloq); }
+static u3_noun f_mmul(cell* c) { return u3qi_la_mmul_i754(c->sx, c->sy, c->sqr, c->sqr, c->bloq, RN); }
+static u3_noun a_tran(cell* c) { return u3qi_la_transpose(c->sx, c->sqr, c->bloq); }
+static u3_noun c_dot(cell* c)  { return u3qi_la_dot_cplx(c->x, c->y, c->shp, c->bloq, RN); }
+static u3_noun c_mmul(cell* c) { return u3qi_la_mmul_cplx(c->sx, c->sy, c->sqr, c->sqr, c->bloq, RN); }
+#ifdef LA_BENCH_VERE
+static u3_noun i_add(cell* c)  { return _la_int2_binop(c->x, c->y, c->shp, c->bloq, _LA_ADD); }
+static u3_noun i_sub(cell* c)  { return _la_int2_binop(c->x, c->y, c->shp, c->bloq, _LA_SUB); }
+static u3_noun i_mul(cell* c)  { return _la_int2_binop(c->x, c->y, c->shp, c->bloq, _LA_MUL); }
+static u3_noun i_div(cell* c)  { return _la_int2_binop(c->x, c->y, c->shp, c->bloq, _LA_DIV); }
+static u3_noun i_mod(cell* c)  { return _la_int2_binop(c->x, c->y, c->shp, c->bloq, _LA_REM); }
+static u3_noun i_dot(cell* c)  { return _la_int2_dot(c->x, c->y, c->shp, c->bloq); }
+static u3_noun i_amax(cell* c) { return _la_int2_argminmax(c->x, c->shp, c->bloq, 1); }
+static u3_noun x_mul(cell* c)  { return _la_fixp_binop(c->x, c->y, c->shp, c->bloq, c->prc, _LA_MUL); }
+static u3_noun x_div(cell* c)  { return _la_fixp_binop(c->x, c->y, c->shp, c->bloq, c->prc, _LA_DIV); }
+static u3_noun x_dot(cell* c)  { return _la_fixp_dot(c->x, c->y, c->shp, c->bloq, c->prc); }
+static u3_noun x_mmul(cell* c) { return u3qi_la_mmul_fixp(c->sx, c->sy, c->sqr, c->sqr, c->bloq, c->prc); }
+#endif
+
+static const op OPS[] = {
+  {"add",       'f', f_add,  1, 3, c3n},
+  {"sub",       'f', f_sub,  1, 3, c3n},
+  {"mul",       'f', f_mul,  1, 3, c3n},
+  {"div",       'f', f_div,  1, 3, c3n},
+  {"mod",       'f', f_mod,  1, 3, c3n},
+  {"adds",      'f', f_adds, 1, 2, c3n},
+  {"dot",       'f', f_dot,  2, 2, c3n},
+  {"cumsum",    'f', f_cums, 1, 2, c3n},
+  {"argmax",    'f', f_amax, 1, 1, c3n},
+  {"abs",       'f', f_abs,  1, 2, c3n},
+  {"transpose", 'f', a_tran, 0, 2, c3y},
+  {"mmul",      'f', f_mmul, 2, 3, c3y},
+  {"dot",       'c', c_dot,  8, 2, c3n},
+  {"transpose", 'c', a_tran, 0, 2, c3y},
+  {"mmul",      'c', c_mmul, 8, 3, c3y},
+#ifdef LA_BENCH_VERE
+  {"add",       'i', i_add,  1, 3, c3n},
+  {"sub",       'i', i_sub,  1, 3, c3n},
+  {"mul",       'i', i_mul,  1, 3, c3n},
+  {"div",       'i', i_div,  1, 3, c3n},
+  {"mod",       'i', i_mod,  1, 3, c3n},
+  {"dot",       'i', i_dot,  2, 2, c3n},
+  {"argmax",    'i', i_amax, 1, 1, c3n},
+  {"transpose", 'i', a_tran, 0, 2, c3y},
+  {"mul",       'x', x_mul,  1, 3, c3n},
+  {"div",       'x', x_div,  1, 3, c3n},
+  {"dot",       'x', x_dot,  2, 2, c3n},
+  {"mmul",      'x', x_mmul, 2, 3, c3y},
+#endif
+};
+#define NOPS ( sizeof OPS / sizeof OPS[0] )
+
+static const c3_c* kind_c(c3_y k) {
+  return ( 'f' == k ) ? "i754" : ( 'c' == k ) ? "cplx" :
+         ( 'i' == k ) ? "int2" : "fixp";
+}
+
+int main(int argc, char** argv) {
+  const c3_c* out_c = ( argc > 1 ) ? argv[1] : "la-bench.csv";
+  c3_d max_n    = ( argc > 2 ) ? strtoull(argv[2], 0, 10) : 10000000;
+  c3_d mmul_max = ( argc > 3 ) ? strtoull(argv[3], 0, 10) : 250000;
+  FILE* f = fopen(out_c, "w");
+  if ( !f || max_n < 10 ) {
+    fprintf(stderr, "usage: la_bench [out.csv [max_n>=10 [mmul_max]]]\n");
+    return 1;
+  }
+  softfloat_roundingMode = softfloat_round_near_even;
+
+  fprintf(f, "word_size,kind,bloq,op,n,reps,total_ns,marshal_ns,compute_ns,"
+             "gflops,gflops_compute,gbytes_s,status\n");
+  fprintf(stderr, "%-4s %-4s %-9s %9s %9s %9s %9s %6s\n",
+          "kind", "bloq", "op", "n", "GFLOP/s", "(comp)", "GB/s", "mar%");
+
+  static const struct { c3_y kind, lo, hi; } KINDS[] = {
+    {'f', 4, 7}, {'c', 5, 8}, {'i', 3, 6}, {'x', 3, 6},
+  };
+  for ( unsigned k = 0; k < 4; k++ ) {
+    c3_t any_t = 0;
+    for ( unsigned o = 0; o < NOPS; o++ ) any_t |= ( OPS[o].kind == KINDS[k].kind );
+    if ( !any_t ) continue;
+
+    for ( c3_y b = KINDS[k].lo; b <= KINDS[k].hi; b++ ) {
+      for ( c3_d n = 10; n <= max_n; n *= 10 ) {
+        cell c;
+        cell_init(&c, KINDS[k].kind, b, n, mmul_max);
+
+        for ( unsigned o = 0; o < NOPS; o++ ) {
+          const op* p = &OPS[o];
+          if ( p->kind != c.kind ) continue;
+
+          c3_d   m   = c.m;
+          double len = ( c3y == p->sqr_o ) ? (double)(m * m) : (double)n;
+          double flo = p->flo * (( !strcmp(p->nam, "mmul") ) ? (double)(m * m * m) : len);
+          double byt = p->lan * len * (double)((c3_d)1 << (b - 3));
+          double wrk = ( flo > len ) ? flo : len;
+          c3_d reps  = (c3_d)c3_max(1.0, c3_min(1e5, 1e7 / wrk));
+
+          //  warm-up, which also tells a punt from a result
+          u3_noun pro = p->fun(&c);
+          const c3_c* sta_c = ( u3_none == pro ) ? "punt" : "ok";
+          if ( u3_none != pro ) u3z(pro);
+
+          c3_d mar0 = la_shim_mar_ns, t0 = la_shim_now();
+          for ( c3_d r = 0; r < reps; r++ ) {
+            pro = p->fun(&c);
+            if ( u3_none != pro ) u3z(pro);
+          }
+          c3_d tot = la_shim_now() - t0, mar = la_shim_mar_ns - mar0;
+          c3_d cmp = ( tot > mar ) ? tot - mar : 0;
+          double gf  = flo * reps / (double)tot;
+          double gfc = cmp ? flo * reps / (double)cmp : 0;
+          double gbs = byt * reps / (double)tot;
+
+          fprintf(f, "%u,%s,%u,%s,%" PRIu64 ",%" PRIu64 ",%" PRIu64 ",%" PRIu64
+                     ",%" PRIu64 ",%.4f,%.4f,%.4f,%s\n",
+                  (unsigned)(8 * sizeof(void*)), kind_c(c.kind), b, p->nam,
+                  (c3_d)len, reps, tot, mar, cmp, gf, gfc, gbs, sta_c);
+          fprintf(stderr, "%-4s %-4u %-9s %9" PRIu64 " %9.3f %9.3f %9.3f %5.1f%%%s\n",
+                  kind_c(c.kind), b, p->nam, (c3_d)len, gf, gfc, gbs,
+                  100.0 * (double)mar / (double)tot,
+                  ( u3_none == pro ) ? "  punt" : "");
+        }
+        cell_free(&c);
+      }
+    }
+  }
+  fclose(f);
+  return 0;
+}
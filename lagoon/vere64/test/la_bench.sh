@@ -0,0 +1,42 @@
+#!/bin/sh
+# Build + run the Lagoon size sweep (la_bench.c) against the SAME Berkeley
+# SoftFloat and SoftBLAS the vere jets use; see build.sh for the re-archive
+# step.  Pass `vere` first to time the 32-bit vere copy of the jet instead,
+# which adds the %int2 and %fixp kernels (and needs SoftUnum and GMP).
+#
+#   ./la_bench.sh [vere] [out.csv [max_n [mmul_max]]]
+#   ./la_bench.sh la-bench.csv 100000         # stop at 10^5 lanes
+#
+# Set CFLAGS to time another build, e.g. CFLAGS='-DLAGOON_NO_NATIVE'.
+set -e
+
+HERE="$(dirname "$0")"
+SFINC="$(dirname "$(find "$HOME/urbit" -name softfloat.h 2>/dev/null | grep -i softfloat/source/include | head -1)")"
+SFLIB="$(find "$HOME/urbit/vere-ml64" -name libsoftfloat.a 2>/dev/null | head -1)"
+SBINC="$(dirname "$(find "$HOME/urbit" -name softblas.h 2>/dev/null | grep -i softblas/include | head -1)")"
+SBLIB="$(find "$HOME/urbit/vere-ml64" -name libsoftblas.a 2>/dev/null | head -1)"
+[ -n "$SFINC" ] && [ -n "$SFLIB" ] || { echo "softfloat not found (build vere-ml64 first)"; exit 1; }
+[ -n "$SBINC" ] && [ -n "$SBLIB" ] || { echo "softblas not found (build vere-ml64 first)"; exit 1; }
+
+WORK="$(mktemp -d)"
+for L in "$SFLIB" "$SBLIB"; do
+  N="$(basename "$L")"
+  mkdir "$WORK/${N%.a}"
+  ( cd "$WORK/${N%.a}" && ar x "$L" && chmod u+rw ./*.o && libtool -static -o "$WORK/$N" ./*.o )
+done
+LIBS="$WORK/libsoftblas.a $WORK/libsoftfloat.a"
+INCS="-I$HERE -I$SFINC -I$SBINC"
+
+if [ "$1" = vere ]; then
+  shift
+  SUINC="$(dirname "$(find "$HOME/urbit" -name softunum.h 2>/dev/null | head -1)")"
+  SULIB="$(find "$HOME/urbit/vere-ml64" -name libsoftunum.a 2>/dev/null | head -1)"
+  [ -n "$SUINC" ] && [ -n "$SULIB" ] || { echo "softunum not found (build vere-ml64 first)"; exit 1; }
+  INCS="$INCS -I$SUINC -I$HERE/../../../libmath/vere/noun -DLA_BENCH_VERE"
+  LIBS="$SULIB $LIBS -lgmp"
+fi
+
+# shellcheck disable=SC2086
+cc -O2 -ffp-contract=off ${CFLAGS:-} $INCS "$HERE/la_bench.c" $LIBS -lm -lpthread -o "$WORK/la_bench"
+"$WORK/la_bench" "${1:-la-bench.csv}" ${2:-} ${3:-}
+rm -rf "$WORK"
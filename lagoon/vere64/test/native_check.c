@@ -0,0 +1,246 @@
+// native_check.c -- differential harness for the native %i754 lanes.
+//
+// Includes the MASTER jet (noun/jets/lagoon.c) with -DLAGOON_JET_HARNESS, so
+// the kernels tested here are byte-for-byte the kernels the runtime jet runs.
+// Every lane of _la_nat_h/_la_nat_s/_la_nat_d (add, sub, mul, div) is compared
+// bit-for-bit against SoftFloat under softfloat_round_near_even, over:
+//
+//   - every f16 x against every f16 edge y (f16 goes via binary32, so this
+//     covers the widen/narrow for each input and each rounding case);
+//   - every pair drawn from a table of edge values (zeros, subnormals, the
+//     normal boundary, ulps around 1, max finite, infinities, quiet and
+//     signaling NaNs with payloads);
+//   - random pairs drawn by class (raw bits, close exponents for
+//     cancellation, subnormal, near overflow/underflow, edge-vs-random);
+//   - ray and broadcast operands, with the result aliasing x and y, across
+//     lengths that straddle the chunk size.
+//
+// The NaN-lane redo is the SoftFloat op itself, so NaN lanes must match too,
+// and the harness checks the kernel redid exactly the lanes SoftFloat says
+// are NaN.  `native_check full` also sweeps every f32 x against the edge y
+// table and every f16 pair (slow).
+//
+// Build/run: ./build.sh [full]
+
+#define LAGOON_JET_HARNESS
+#include "../noun/jets/lagoon.c"
+
+#ifndef _LA_NATIVE
+#  error "native lanes compiled out on this host (FLT_EVAL_METHOD != 0?)"
+#endif
+
+#include <inttypes.h>
+
+static uint64_t fails = 0, cases = 0, redos = 0;
+
+static uint64_t rng = 0x9e3779b97f4a7c15ULL;
+static uint64_t rnd64(void) {
+  rng ^= rng << 13; rng ^= rng >> 7; rng ^= rng << 17; return rng;
+}
+
+// SoftFloat reference, one lane; also the kernels' NaN redo.
+static void h_add(const float16_t* x, const float16_t* y, float16_t* r) { *r = f16_add(*x, *y); redos++; }
+static void h_sub(const float16_t* x, const float16_t* y, float16_t* r) { *r = f16_sub(*x, *y); redos++; }
+static void h_mul(const float16_t* x, const float16_t* y, float16_t* r) { *r = f16_mul(*x, *y); redos++; }
+static void h_div(const float16_t* x, const float16_t* y, float16_t* r) { *r = f16_div(*x, *y); redos++; }
+static void s_add(const float32_t* x, const float32_t* y, float32_t* r) { *r = f32_add(*x, *y); redos++; }
+static void s_sub(const float32_t* x, const float32_t* y, float32_t* r) { *r = f32_sub(*x, *y); redos++; }
+static void s_mul(const float32_t* x, const float32_t* y, float32_t* r) { *r = f32_mul(*x, *y); redos++; }
+static void s_div(const float32_t* x, const float32_t* y, float32_t* r) { *r = f32_div(*x, *y); redos++; }
+static void d_add(const float64_t* x, const float64_t* y, float64_t* r) { *r = f64_add(*x, *y); redos++; }
+static void d_sub(const float64_t* x, const float64_t* y, float64_t* r) { *r = f64_sub(*x, *y); redos++; }
+static void d_mul(const float64_t* x, const float64_t* y, float64_t* r) { *r = f64_mul(*x, *y); redos++; }
+static void d_div(const float64_t* x, const float64_t* y, float64_t* r) { *r = f64_div(*x, *y); redos++; }
+
+static void (*const h_ref[4])(const float16_t*, const float16_t*, float16_t*) = { h_add, h_sub, h_mul, h_div };
+static void (*const s_ref[4])(const float32_t*, const float32_t*, float32_t*) = { s_add, s_sub, s_mul, s_div };
+static void (*const d_ref[4])(const float64_t*, const float64_t*, float64_t*) = { d_add, d_sub, d_mul, d_div };
+static const char* const nam[4] = { "add", "sub", "mul", "div" };
+
+static int h_nan(uint16_t c) { return ((c >> 10) & 0x1f) == 0x1f && (c & 0x3ff); }
+static int s_nan(uint32_t c) { return ((c >> 23) & 0xff) == 0xff && (c & 0x7fffff); }
+static int d_nan(uint64_t c) { return ((c >> 52) & 0x7ff) == 0x7ff && (c & 0xfffffffffffffULL); }
+
+static const uint16_t h_edge[] = {
+  0x0000, 0x8000, 0x0001, 0x8001, 0x03ff, 0x83ff, 0x0400, 0x8400, 0x0401,
+  0x07ff, 0x1000, 0x1400, 0x3bff, 0x3c00, 0xbc00, 0x3c01, 0x3fff, 0x4000,
+  0x6400, 0x67ff, 0x7bfe, 0x7bff, 0xfbff, 0x7c00, 0xfc00, 0x7e00, 0xfe00,
+  0x7e01, 0x7dff, 0x7c01, 0xfc01, 0x3555, 0x5bff, 0x2000,
+};
+static const uint32_t s_edge[] = {
+  0x00000000, 0x80000000, 0x00000001, 0x80000001, 0x007fffff, 0x807fffff,
+  0x00800000, 0x80800000, 0x00800001, 0x00ffffff, 0x01000000, 0x33800000,
+  0x34000000, 0x3f7fffff, 0x3f800000, 0xbf800000, 0x3f800001, 0x3fffffff,
+  0x40000000, 0x4b000000, 0x4b7fffff, 0x4b800000, 0x7effffff, 0xfeffffff,
+  0x7f7ffffe, 0x7f7fffff, 0xff7fffff, 0x7f800000, 0xff800000, 0x7fc00000,
+  0xffc00000, 0x7fc00001, 0x7fbfffff, 0x7f800001, 0xff800001, 0x3eaaaaab,
+  0x5f800000, 0x1f800000, 0x2f800000, 0x4f800000,
+};
+static const uint64_t d_edge[] = {
+  0x0000000000000000ULL, 0x8000000000000000ULL, 0x0000000000000001ULL,
+  0x8000000000000001ULL, 0x000fffffffffffffULL, 0x800fffffffffffffULL,
+  0x0010000000000000ULL, 0x8010000000000000ULL, 0x0010000000000001ULL,
+  0x001fffffffffffffULL, 0x0020000000000000ULL, 0x3ca0000000000000ULL,
+  0x3cb0000000000000ULL, 0x3fefffffffffffffULL, 0x3ff0000000000000ULL,
+  0xbff0000000000000ULL, 0x3ff0000000000001ULL, 0x3fffffffffffffffULL,
+  0x4000000000000000ULL, 0x4330000000000000ULL, 0x433fffffffffffffULL,
+  0x4340000000000000ULL, 0x7fdfffffffffffffULL, 0xffdfffffffffffffULL,
+  0x7feffffffffffffeULL, 0x7fefffffffffffffULL, 0xffefffffffffffffULL,
+  0x7ff0000000000000ULL, 0xfff0000000000000ULL, 0x7ff8000000000000ULL,
+  0xfff8000000000000ULL, 0x7ff8000000000001ULL, 0x7ff7ffffffffffffULL,
+  0x7ff0000000000001ULL, 0xfff0000000000001ULL, 0x3fd5555555555555ULL,
+  0x5ff0000000000000ULL, 0x1ff0000000000000ULL, 0x2ff0000000000000ULL,
+  0x4ff0000000000000ULL,
+};
+#define N_HE (sizeof(h_edge) / sizeof(h_edge[0]))
+#define N_SE (sizeof(s_edge) / sizeof(s_edge[0]))
+#define N_DE (sizeof(d_edge) / sizeof(d_edge[0]))
+
+// one random operand by class; [a] seeds the close-exponent class
+static uint32_t s_draw(uint32_t a) {
+  uint64_t r = rnd64();
+  switch ( r % 6 ) {
+    default: return (uint32_t)(r >> 8);
+    case 1:  return (a & 0xff800000) ^ ((uint32_t)(r >> 16) & 0x817fffff);
+    case 2:  return (uint32_t)(r >> 16) & 0x807fffff;
+    case 3:  return ((uint32_t)(r >> 16) & 0x81ffffff) | 0x7e000000;
+    case 4:  return ((uint32_t)(r >> 16) & 0x81ffffff) | 0x00800000;
+    case 5:  return s_edge[(r >> 8) % N_SE];
+  }
+}
+static uint64_t d_draw(uint64_t a) {
+  uint64_t r = rnd64(), s = rnd64();
+  switch ( r % 6 ) {
+    default: return s;
+    case 1:  return (a & 0xfff0000000000000ULL) ^ (s & 0x801fffffffffffffULL);
+    case 2:  return s & 0x800fffffffffffffULL;
+    case 3:  return (s & 0x803fffffffffffffULL) | 0x7fc0000000000000ULL;
+    case 4:  return (s & 0x803fffffffffffffULL) | 0x0010000000000000ULL;
+    case 5:  return d_edge[(r >> 8) % N_DE];
+  }
+}
+
+// Run op over n lanes three ways (fresh r, r == x, r == y; y broadcast when
+// ysd is 0) and diff against the SoftFloat reference.
+#define CHECK(SUF, UT, TY, REF, ISNAN, FMT)                                    \
+static void SUF##_check(int op, uint64_t n, const UT* x, const UT* y,        \
+                        c3_d ysd) {                                           \
+  UT* w = malloc(n * sizeof(UT));                                             \
+  UT* r = malloc(n * sizeof(UT));                                             \
+  uint64_t want_nan = 0;                                                      \
+  for ( uint64_t i = 0; i < n; i++ ) {                                        \
+    TY p, q, s;                                                               \
+    memcpy(&p, &x[i], sizeof(UT));                                            \
+    memcpy(&q, &y[ysd ? i : 0], sizeof(UT));                                  \
+    REF[op](&p, &q, &s);                                                      \
+    memcpy(&w[i], &s, sizeof(UT));                                            \
+    want_nan += ISNAN(w[i]);                                                  \
+  }                                                                           \
+  for ( int k = 0; k < 3; k++ ) {                                             \
+    if ( (2 == k) && !ysd ) break;                                            \
+    const UT* yy = y;                                                         \
+    if ( 1 == k ) memcpy(r, x, n * sizeof(UT));                               \
+    if ( 2 == k ) { memcpy(r, y, n * sizeof(UT)); yy = r; }                   \
+    redos = 0;                                                                \
+    _la_nat_##SUF(op, n, (const c3_y*)((1 == k) ? r : x),                     \
+                  (const c3_y*)yy, ysd, (c3_y*)r, REF[op]);                   \
+    if ( redos != want_nan ) {                                                \
+      fails++;                                                                \
+      printf(#SUF "%s redid %" PRIu64 " lanes, want %" PRIu64 "\n",           \
+             nam[op], redos, want_nan);                                       \
+    }                                                                         \
+    for ( uint64_t i = 0; i < n; i++ ) {                                      \
+      cases++;                                                                \
+      if ( r[i] != w[i] && fails++ < 32 ) {                                   \
+        printf(#SUF "%s 0x" FMT " 0x" FMT "  got 0x" FMT "  want 0x" FMT     \
+               "  *** FAIL\n", nam[op], x[i], y[ysd ? i : 0], r[i], w[i]);    \
+      }                                                                       \
+    }                                                                         \
+  }                                                                           \
+  free(w); free(r);                                                           \
+}
+
+CHECK(h, uint16_t, float16_t, h_ref, h_nan, "%04" PRIx16)
+CHECK(s, uint32_t, float32_t, s_ref, s_nan, "%08" PRIx32)
+CHECK(d, uint64_t, float64_t, d_ref, d_nan, "%016" PRIx64)
+
+#define RAND_N 1000003  //  not a multiple of the chunk size
+
+int main(int argc, char** argv) {
+  softfloat_roundingMode = softfloat_round_near_even;
+  fesetround(FE_TONEAREST);
+
+  uint32_t* sx = malloc(RAND_N * sizeof(uint32_t));
+  uint32_t* sy = malloc(RAND_N * sizeof(uint32_t));
+  uint64_t* dx = malloc(RAND_N * sizeof(uint64_t));
+  uint64_t* dy = malloc(RAND_N * sizeof(uint64_t));
+  uint16_t* hx = malloc(65536 * sizeof(uint16_t));
+  for ( uint64_t i = 0; i < 65536; i++ ) hx[i] = (uint16_t)i;
+
+  for ( int op = 0; op < 4; op++ ) {
+    //  every f16 x against each f16 edge y, broadcast and as a ray
+    for ( uint64_t j = 0; j < N_HE; j++ ) h_check(op, 65536, hx, &h_edge[j], 0);
+    h_check(op, 65536, hx, hx + 0, 1);
+    {
+      uint16_t* hy = malloc(65536 * sizeof(uint16_t));
+      for ( uint64_t i = 0; i < 65536; i++ ) hy[i] = (uint16_t)(rnd64() >> 16);
+      h_check(op, 65536, hx, hy, 1);
+      free(hy);
+    }
+
+    //  edge x edge, as rays and with each edge value broadcast
+    uint64_t k = 0;
+    for ( uint64_t i = 0; i < N_SE; i++ )
+      for ( uint64_t j = 0; j < N_SE; j++, k++ ) { sx[k] = s_edge[i]; sy[k] = s_edge[j]; }
+    s_check(op, k, sx, sy, 1);
+    for ( uint64_t j = 0; j < N_SE; j++ ) s_check(op, N_SE, s_edge, &s_edge[j], 0);
+
+    k = 0;
+    for ( uint64_t i = 0; i < N_DE; i++ )
+      for ( uint64_t j = 0; j < N_DE; j++, k++ ) { dx[k] = d_edge[i]; dy[k] = d_edge[j]; }
+    d_check(op, k, dx, dy, 1);
+    for ( uint64_t j = 0; j < N_DE; j++ ) d_check(op, N_DE, d_edge, &d_edge[j], 0);
+
+    //  random by class, ray and broadcast, a few lengths around the chunk
+    for ( uint64_t i = 0; i < RAND_N; i++ ) {
+      sx[i] = s_draw(0);  sy[i] = s_draw(sx[i]);
+      dx[i] = d_draw(0);  dy[i] = d_draw(dx[i]);
+    }
+    s_check(op, RAND_N, sx, sy, 1);
+    d_check(op, RAND_N, dx, dy, 1);
+    s_check(op, RAND_N, sx, sy, 0);
+    d_check(op, RAND_N, dx, dy, 0);
+    for ( uint64_t n = 1; n <= 3 * _LA_NAT_LANES + 1; n += 85 ) {
+      s_check(op, n, sx + n, sy + n, 1);
+      d_check(op, n, dx + n, dy + n, 1);
+    }
+    printf("%-4s %" PRIu64 " lanes, %" PRIu64 " failures\n", nam[op], cases, fails);
+  }
+
+  if ( (argc > 1) && (0 == strcmp(argv[1], "full")) ) {
+    //  every f32 x against each edge y, 2^20 lanes at a time
+    const uint64_t blk = (uint64_t)1 << 20;
+    uint32_t* fx = malloc(blk * sizeof(uint32_t));
+    for ( int op = 0; op < 4; op++ ) {
+      for ( uint64_t j = 0; j < N_SE; j++ ) {
+        for ( uint64_t b = 0; b < ((uint64_t)1 << 32); b += blk ) {
+          for ( uint64_t i = 0; i < blk; i++ ) fx[i] = (uint32_t)(b + i);
+          s_check(op, blk, fx, &s_edge[j], 0);
+        }
+      }
+      printf("full %-4s %" PRIu64 " lanes, %" PRIu64 " failures\n", nam[op], cases, fails);
+    }
+    free(fx);
+    for ( int op = 0; op < 4; op++ ) {
+      for ( uint64_t j = 0; j < 65536; j++ ) {
+        uint16_t y = (uint16_t)j;
+        h_check(op, 65536, hx, &y, 0);
+      }
+      printf("full h%-3s %" PRIu64 " lanes, %" PRIu64 " failures\n", nam[op], cases, fails);
+    }
+  }
+
+  free(hx); free(sx); free(sy); free(dx); free(dy);
+  printf("\n%s (%" PRIu64 " failures)\n", fails ? "FAILED" : "ALL PASS", fails);
+  return fails ? 1 : 0;
+}
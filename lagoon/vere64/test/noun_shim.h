@@ -0,0 +1,400 @@
+// noun_shim.h -- just enough of the vere noun API to build lagoon.c's u3qi
+// kernels off-ship (-DLAGOON_JET_HARNESS), so they can run under perf,
+// valgrind or a sanitizer with no runtime.
+//
+// Nouns follow the 32-bit loom's encoding: an atom below 2^31 is direct,
+// anything else names a refcounted box (bit 31 set; bit 30 set for cells)
+// by index.  Boxes are malloc'd, so valgrind sees every leak and overrun.
+// An atom box is laid out as u3a_atom (len_w, then buf_w), which is what
+// _la_view_get reads.  Slabs are minted in place, as in vere, and a bail
+// aborts.  Words are 32 bits, which both lagoon.c copies accept; the
+// vere64 copy names its 32-bit lanes c3_h.
+//
+// The marshalling entry points (u3r_bytes, u3r_chub, u3i_bytes, u3i_chubs,
+// slab init/bare/mint) add their wall time to la_shim_mar_ns, so a caller can
+// split a kernel's time into marshalling and compute.
+
+#ifndef LA_NOUN_SHIM_H
+#define LA_NOUN_SHIM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+typedef char     c3_c;
+typedef bool     c3_t;
+typedef uint8_t  c3_b;
+typedef uint8_t  c3_y;
+typedef int8_t   c3_ys;
+typedef uint16_t c3_s;
+typedef int16_t  c3_ss;
+typedef uint32_t c3_w;
+typedef int32_t  c3_ws;
+typedef uint32_t c3_h;
+typedef uint64_t c3_d;
+typedef int64_t  c3_ds;
+typedef uint32_t c3_m;
+typedef uint8_t  c3_o;
+
+typedef c3_w u3_noun;
+typedef c3_w u3_atom;
+
+#define c3y  ((c3_o)0)
+#define c3n  ((c3_o)1)
+#define __(x)  ( (x) ? c3y : c3n )
+#define c3_min(x, y)  ( ((x) < (y)) ? (x) : (y) )
+#define c3_max(x, y)  ( ((x) > (y)) ? (x) : (y) )
+#define c3_malloc  malloc
+#define c3_free    free
+
+#define c3_s1(a)           ( (c3_w)(a) )
+#define c3_s2(a, b)        ( c3_s1(a) | ((c3_w)(b) << 8) )
+#define c3_s3(a, b, c)     ( c3_s2(a, b) | ((c3_w)(c) << 16) )
+#define c3_s4(a, b, c, d)  ( c3_s3(a, b, c) | ((c3_w)(d) << 24) )
+#define c3__a     c3_s1('a')
+#define c3__d     c3_s1('d')
+#define c3__n     c3_s1('n')
+#define c3__u     c3_s1('u')
+#define c3__z     c3_s1('z')
+#define c3__cplx  c3_s4('c','p','l','x')
+#define c3__exit  c3_s4('e','x','i','t')
+#define c3__fail  c3_s4('f','a','i','l')
+#define c3__fixp  c3_s4('f','i','x','p')
+#define c3__i754  c3_s4('i','7','5','4')
+#define c3__int2  c3_s4('i','n','t','2')
+#define c3__uint  c3_s4('u','i','n','t')
+#define c3__unum  c3_s4('u','n','u','m')
+
+#define u3_none  ((u3_noun)0xffffffff)
+#define u3_nul   ((u3_noun)0)
+
+typedef struct {
+  c3_w use_w;
+  c3_w len_w;
+  c3_w buf_w[];
+} u3a_atom;
+
+typedef struct {
+  c3_w    use_w;
+  c3_w    pad_w;      //  (cells and atoms share the use_w slot)
+  u3_noun hed;
+  u3_noun tel;
+} u3a_cell;
+
+typedef struct {
+  u3a_atom* vat_u;
+  c3_w      len_w;
+  union {
+    c3_y* buf_y;
+    c3_w* buf_w;
+  };
+} u3i_slab;
+
+//  ----  box table
+
+static void** la_shim_box;
+static c3_w*  la_shim_fre;
+static c3_w   la_shim_cap, la_shim_top, la_shim_nfr;
+static c3_d   la_shim_mar_ns;     //  ns spent in marshalling entry points
+
+static inline c3_d
+la_shim_now(void)
+{
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (c3_d)t.tv_sec * 1000000000ULL + (c3_d)t.tv_nsec;
+}
+
+static inline u3_noun
+u3m_bail(c3_m how_m)
+{
+  fprintf(stderr, "noun_shim: bail %.4s\r\n", (c3_c*)&how_m);
+  abort();
+  return u3_none;
+}
+
+static inline c3_w
+_sh_new(void* box)
+{
+  c3_w i;
+  if ( la_shim_nfr ) {
+    i = la_shim_fre[--la_shim_nfr];
+  }
+  else {
+    if ( la_shim_top == la_shim_cap ) {
+      la_shim_cap = la_shim_cap ? 2 * la_shim_cap : 1024;
+      if ( la_shim_cap > (1u << 30) ) u3m_bail(c3__fail);
+      la_shim_box = realloc(la_shim_box, la_shim_cap * sizeof(void*));
+      la_shim_fre = realloc(la_shim_fre, la_shim_cap * sizeof(c3_w));
+    }
+    i = la_shim_top++;
+  }
+  la_shim_box[i] = box;
+  return i;
+}
+
+#define u3a_is_cat(a)  ( ((a) >> 31) ? c3n : c3y )
+#define u3a_is_dog(a)  ( ((a) >> 31) ? c3y : c3n )
+#define u3a_is_pug(a)  ( (2 == ((a) >> 30)) ? c3y : c3n )
+#define u3a_is_pom(a)  ( (3 == ((a) >> 30)) ? c3y : c3n )
+#define u3a_is_atom(a) ( (3 == ((a) >> 30)) ? c3n : c3y )
+#define u3a_to_ptr(a)  ( la_shim_box[(a) & 0x3fffffff] )
+#define u3ud(a)        u3a_is_atom(a)
+#define u3du(a)        u3a_is_pom(a)
+
+static inline void* u3a_malloc(size_t len_i) { return malloc(len_i ? len_i : 1); }
+static inline void  u3a_free(void* tox_v)    { free(tox_v); }
+
+static inline u3_noun
+u3k(u3_noun som)
+{
+  if ( c3y == u3a_is_dog(som) && (u3_none != som) ) {
+    ((u3a_atom*)u3a_to_ptr(som))->use_w++;
+  }
+  return som;
+}
+
+static inline void
+u3z(u3_noun som)
+{
+  while ( c3y == u3a_is_dog(som) && (u3_none != som) ) {
+    c3_w  i   = som & 0x3fffffff;
+    void* box = la_shim_box[i];
+    if ( --((u3a_atom*)box)->use_w ) return;
+    la_shim_fre[la_shim_nfr++] = i;
+    if ( c3y == u3a_is_pom(som) ) {
+      u3a_cell* cel_u = box;
+      u3_noun   tel   = cel_u->tel;
+      u3z(cel_u->hed);
+      free(box);
+      som = tel;
+    }
+    else {
+      free(box);
+      return;
+    }
+  }
+}
+
+static inline u3_noun
+u3nc(u3_noun a, u3_noun b)
+{
+  u3a_cell* cel_u = malloc(sizeof(u3a_cell));
+  cel_u->use_w = 1;
+  cel_u->hed = a;
+  cel_u->tel = b;
+  return 0xc0000000 | _sh_new(cel_u);
+}
+#define u3nt(a, b, c)     u3nc(a, u3nc(b, c))
+#define u3nq(a, b, c, d)  u3nc(a, u3nt(b, c, d))
+
+static inline u3_noun
+u3h(u3_noun som)
+{
+  if ( c3n == u3a_is_pom(som) ) return u3m_bail(c3__exit);
+  return ((u3a_cell*)u3a_to_ptr(som))->hed;
+}
+
+static inline u3_noun
+u3t(u3_noun som)
+{
+  if ( c3n == u3a_is_pom(som) ) return u3m_bail(c3__exit);
+  return ((u3a_cell*)u3a_to_ptr(som))->tel;
+}
+
+static inline u3_noun
+u3x_atom(u3_noun som)
+{
+  return ( c3y == u3a_is_pom(som) ) ? u3m_bail(c3__exit) : som;
+}
+
+static inline c3_o
+u3r_cell(u3_noun som, u3_noun* a, u3_noun* b)
+{
+  if ( c3n == u3a_is_pom(som) ) return c3n;
+  if ( a ) *a = u3h(som);
+  if ( b ) *b = u3t(som);
+  return c3y;
+}
+
+//  ----  atoms
+
+//  atom words: *len_w of them at the returned pointer
+static inline const c3_w*
+_sh_words(u3_atom a, c3_w* len_w, c3_w* tmp_w)
+{
+  if ( c3y == u3a_is_cat(a) ) {
+    *tmp_w = a;
+    *len_w = a ? 1 : 0;
+    return tmp_w;
+  }
+  u3a_atom* vat_u = u3a_to_ptr(a);
+  *len_w = vat_u->len_w;
+  return vat_u->buf_w;
+}
+
+static inline c3_w
+u3r_met(c3_y bloq, u3_atom a)
+{
+  c3_w tmp_w, len_w;
+  const c3_w* buf_w = _sh_words(a, &len_w, &tmp_w);
+  if ( !len_w ) return 0;
+  c3_w top_w = buf_w[len_w - 1];
+  c3_d bit_d = (c3_d)(len_w - 1) * 32 + (32 - __builtin_clz(top_w));
+  return (c3_w)((bit_d + ((c3_d)1 << bloq) - 1) >> bloq);
+}
+
+static inline void
+u3r_bytes(c3_d a_d, c3_d b_d, c3_y* c_y, u3_atom d)
+{
+  c3_d t0 = la_shim_now();
+  c3_w tmp_w, len_w;
+  const c3_y* buf_y = (const c3_y*)_sh_words(d, &len_w, &tmp_w);
+  c3_d byt_d = (c3_d)len_w * 4;
+  c3_d cop_d = ( a_d >= byt_d ) ? 0 : c3_min(b_d, byt_d - a_d);
+  memcpy(c_y, buf_y + a_d, cop_d);
+  memset(c_y + cop_d, 0, b_d - cop_d);
+  la_shim_mar_ns += la_shim_now() - t0;
+}
+
+static inline c3_y
+u3r_byte(c3_d a_d, u3_atom b)
+{
+  c3_y c_y;
+  u3r_bytes(a_d, 1, &c_y, b);
+  return c_y;
+}
+
+static inline c3_d
+u3r_chub(c3_d a_d, u3_atom b)
+{
+  c3_d c_d;
+  u3r_bytes(a_d * 8, 8, (c3_y*)&c_d, b);
+  return c_d;
+}
+
+static inline c3_w
+u3r_word(c3_w a_w, u3_atom b)
+{
+  c3_w c_w;
+  u3r_bytes((c3_d)a_w * 4, 4, (c3_y*)&c_w, b);
+  return c_w;
+}
+
+static inline c3_o
+u3r_sing(u3_noun a, u3_noun b)
+{
+  if ( a == b ) return c3y;
+  if ( (c3y == u3a_is_pom(a)) && (c3y == u3a_is_pom(b)) ) {
+    return ( (c3y == u3r_sing(u3h(a), u3h(b))) &&
+             (c3y == u3r_sing(u3t(a), u3t(b))) ) ? c3y : c3n;
+  }
+  if ( (c3n == u3a_is_pug(a)) || (c3n == u3a_is_pug(b)) ) return c3n;
+  u3a_atom* a_u = u3a_to_ptr(a);
+  u3a_atom* b_u = u3a_to_ptr(b);
+  return __( (a_u->len_w == b_u->len_w) &&
+             !memcmp(a_u->buf_w, b_u->buf_w, a_u->len_w * 4) );
+}
+
+static inline void
+u3i_slab_init(u3i_slab* sab_u, c3_y bloq, c3_d len_d)
+{
+  c3_d t0 = la_shim_now();
+  c3_d byt_d = ((len_d << bloq) + 7) >> 3;
+  c3_w len_w = (c3_w)((byt_d + 3) >> 2);
+  sab_u->vat_u = calloc(1, sizeof(u3a_atom) + 4 * (c3_d)(len_w ? len_w : 1));
+  sab_u->vat_u->use_w = 1;
+  sab_u->len_w = len_w;
+  sab_u->buf_w = sab_u->vat_u->buf_w;
+  la_shim_mar_ns += la_shim_now() - t0;
+}
+
+static inline void
+u3i_slab_bare(u3i_slab* sab_u, c3_y bloq, c3_d len_d)
+{
+  c3_d t0 = la_shim_now();
+  c3_d byt_d = ((len_d << bloq) + 7) >> 3;
+  c3_w len_w = (c3_w)((byt_d + 3) >> 2);
+  sab_u->vat_u = malloc(sizeof(u3a_atom) + 4 * (c3_d)(len_w ? len_w : 1));
+  sab_u->vat_u->use_w = 1;
+  sab_u->len_w = len_w;
+  sab_u->buf_w = sab_u->vat_u->buf_w;
+  la_shim_mar_ns += la_shim_now() - t0;
+}
+
+static inline void
+u3i_slab_free(u3i_slab* sab_u)
+{
+  free(sab_u->vat_u);
+}
+
+static inline u3_atom
+u3i_slab_mint(u3i_slab* sab_u)
+{
+  c3_d t0 = la_shim_now();
+  u3a_atom* vat_u = sab_u->vat_u;
+  c3_w      len_w = sab_u->len_w;
+  u3_atom   pro;
+
+  while ( len_w && !vat_u->buf_w[len_w - 1] ) len_w--;
+  if ( (len_w <= 1) && !(len_w && (vat_u->buf_w[0] >> 31)) ) {
+    pro = len_w ? vat_u->buf_w[0] : 0;
+    free(vat_u);
+  }
+  else {
+    vat_u->len_w = len_w;
+    pro = 0x80000000 | _sh_new(vat_u);
+  }
+  la_shim_mar_ns += la_shim_now() - t0;
+  return pro;
+}
+
+static inline u3_atom
+u3i_bytes(c3_d a_d, const c3_y* b_y)
+{
+  u3i_slab sab_u;
+  u3i_slab_bare(&sab_u, 3, a_d);
+  c3_d t0 = la_shim_now();
+  sab_u.buf_w[sab_u.len_w ? sab_u.len_w - 1 : 0] = 0;
+  memcpy(sab_u.buf_y, b_y, a_d);
+  la_shim_mar_ns += la_shim_now() - t0;
+  return u3i_slab_mint(&sab_u);
+}
+
+static inline u3_atom
+u3i_chubs(c3_w a_w, const c3_d* b_d)
+{
+  return u3i_bytes((c3_d)a_w * 8, (const c3_y*)b_d);
+}
+
+static inline u3_atom u3i_chub(c3_d a_d) { return u3i_chubs(1, &a_d); }
+static inline u3_atom u3i_word(c3_w a_w) { return u3i_bytes(4, (c3_y*)&a_w); }
+static inline u3_atom u3i_half(c3_h a_h) { return u3i_bytes(4, (c3_y*)&a_h); }
+
+//  ----  the two hoon.hoon jets lagoon.c calls
+
+static inline u3_atom
+u3qb_lent(u3_noun a)
+{
+  c3_d len_d = 0;
+  while ( u3_nul != a ) { len_d++; a = u3t(a); }
+  return u3i_chub(len_d);
+}
+
+static inline u3_atom
+u3qa_dec(u3_atom a)
+{
+  if ( c3y == u3a_is_cat(a) ) return a ? a - 1 : u3m_bail(c3__exit);
+  c3_w met_w = u3r_met(3, a);
+  c3_y* buf_y = malloc(met_w);
+  u3r_bytes(0, met_w, buf_y, a);
+  for ( c3_w i = 0; i < met_w; i++ ) { if ( buf_y[i]-- ) break; }
+  u3_atom pro = u3i_bytes(met_w, buf_y);
+  free(buf_y);
+  return pro;
+}
+
+#endif  //  LA_NOUN_SHIM_H
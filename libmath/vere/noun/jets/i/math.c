@@ -20,9 +20,16 @@
 #include "jets/q.h"
 #include "jets/w.h"
 #include "noun.h"
+#include "jets/i/jstat.h"  // per-jet statistics (U3_JET_STATS)
 #endif
 #include "softfloat.h"
 
+#include <fenv.h>   // fegetround() (native @rh base ops)
+#include <float.h>  // FLT_EVAL_METHOD (native @rh/@rd base ops)
+#include <math.h>   // sqrtf, sqrt
+#include <stdlib.h> // malloc (@rh tables)
+#include <string.h> // memcpy, strcmp
+
 #ifdef MATH_JET_HARNESS
 #include <stdint.h>
 typedef uint64_t c3_d;
@@ -40,13 +47,64 @@ typedef int64_t  c3_ds;
 
   static inline union doub _rd_bits(c3_d b) { union doub u; u.c = b; return u; }
 
+/* @rd base ops.  With -DMATH_RD_NATIVE, every f64 add/sub/mul/div/sqrt in the
+** @rd cores runs as a host double op whenever SoftFloat is at near-even,
+** which covers every kernel body (the door's directed r only reaches the bare
+** composite ops, and those keep SoftFloat).  IEEE 754 ops are correctly
+** rounded, so each matches its f64_* bit-for-bit as long as it rounds once:
+** the build must evaluate double at double precision (FLT_EVAL_METHOD 0) and
+** must not fuse a*b+c (build with -ffp-contract=off; every result is also
+** tested against itself for NaN, which already keeps GCC and Clang from
+** contracting it into the next op).  The host FPU is assumed to be at
+** FE_TONEAREST without flush-to-zero, as vere leaves it.  NaN results go
+** back to SoftFloat for its payload rules.  Off by default.
+*/
+#ifdef MATH_RD_NATIVE
+#  if defined(__FAST_MATH__) || !defined(FLT_EVAL_METHOD) || (0 != FLT_EVAL_METHOD)
+#    error "MATH_RD_NATIVE needs FLT_EVAL_METHOD 0 and no -ffast-math"
+#  endif
+#  ifdef MATH_JET_HARNESS
+  static int _rd_soft = 0;            //  harness: force SoftFloat (reference run)
+#    define _RD_FPU() ( !_rd_soft && \
+                        (softfloat_roundingMode == softfloat_round_near_even) )
+#  else
+#    define _RD_FPU() ( softfloat_roundingMode == softfloat_round_near_even )
+#  endif
+  static inline double    _rd_nat(float64_t a) { double f; memcpy(&f, &a, 8); return f; }
+  static inline float64_t _rd_sof(double f)    { float64_t a; memcpy(&a, &f, 8); return a; }
+#  define _RD_OP2(nam, op, sf)                                             \
+  static inline float64_t nam(float64_t a, float64_t b) {                  \
+    if ( _RD_FPU() ) {                                                     \
+      double r = _rd_nat(a) op _rd_nat(b);                                 \
+      if ( r == r ) return _rd_sof(r);                                     \
+    }                                                                      \
+    return sf(a, b);                                                       \
+  }
+  _RD_OP2(_rd_fadd, +, f64_add)
+  _RD_OP2(_rd_fsub, -, f64_sub)
+  _RD_OP2(_rd_fmul, *, f64_mul)
+  _RD_OP2(_rd_fdiv, /, f64_div)
+  static inline float64_t _rd_fsqrt(float64_t a) {
+    if ( _RD_FPU() ) {
+      double r = sqrt(_rd_nat(a));
+      if ( r == r ) return _rd_sof(r);
+    }
+    return f64_sqrt(a);
+  }
+#else
+#  define _rd_fadd  f64_add
+#  define _rd_fsub  f64_sub
+#  define _rd_fmul  f64_mul
+#  define _rd_fdiv  f64_div
+#  define _rd_fsqrt f64_sqrt
+#endif
+
   //  The math doors carry a rounding mode r=?(%n %u %d %z) whose bunt is %z.
   //  The transcendental KERNELS force %n (correctly-rounded, no axis), but the
   //  composite arms (pow/atan2/tan/pow-n) round their BARE door ops per r.  The
-  //  wrapper sets _math_rnd from the door's r (axis 60 of the gate); cores
-  //  bracket bare ops with it and restore near-even around kernel calls.
-  //  Default = minMag (%z), matching the door bunt for the harness/cold path.
-  static int _math_rnd = softfloat_round_minMag;
+  //  composites take that mode as an explicit [rnd] argument (the wrapper reads
+  //  r at axis 60 of the gate); they bracket bare ops with it and restore
+  //  near-even around kernel calls.  No rounding state lives in a global.
   static inline int _rnd_of(c3_d r) {            // @tas 'n'/'u'/'d'/'z' -> SoftFloat
     switch ( r ) {
       case 'n': return softfloat_round_near_even;
@@ -75,12 +133,12 @@ typedef int64_t  c3_ds;
   _rd_scale2(float64_t p, c3_ds k)
   {
     if ( (k - 1024) >= 0 ) {                         // k>=1024
-      return f64_mul(f64_mul(p, _rd_pow2(1023)), _rd_pow2(k - 1023));
+      return _rd_fmul(_rd_fmul(p, _rd_pow2(1023)), _rd_pow2(k - 1023));
     }
     if ( !((k + 1022) >= 0) ) {                      // k<-1022
-      return f64_mul(f64_mul(p, _rd_pow2(k + 54)), _rd_pow2(-54));
+      return _rd_fmul(_rd_fmul(p, _rd_pow2(k + 54)), _rd_pow2(-54));
     }
-    return f64_mul(p, _rd_pow2(k));
+    return _rd_fmul(p, _rd_pow2(k));
   }
 
   static float64_t
@@ -106,18 +164,18 @@ typedef int64_t  c3_ds;
     ln2hi.c = 0x3fe62e42fee00000ULL;
     ln2lo.c = 0x3dea39ef35793c76ULL;
 
-    c3_ds k = (c3_ds)f64_to_i64(f64_mul(x, log2e.d), softfloat_round_near_even, 0);
+    c3_ds k = (c3_ds)f64_to_i64(_rd_fmul(x, log2e.d), softfloat_round_near_even, 0);
     if ( (k - 1025) >= 0 )    { r0.c = _RD_PINF; return r0.d; }   // overflow -> inf
     if ( !((k + 1075) >= 0) ) { r0.c = 0; return r0.d; }          // underflow -> 0
 
     ka.d = ui64_to_f64( (c3_d)(k < 0 ? -k : k) );
-    kf.d = (k >= 0) ? ka.d : f64_sub(zero.d, ka.d);
-    rr.d = f64_sub( f64_sub(x, f64_mul(kf.d, ln2hi.d)), f64_mul(kf.d, ln2lo.d) );
+    kf.d = (k >= 0) ? ka.d : _rd_fsub(zero.d, ka.d);
+    rr.d = _rd_fsub( _rd_fsub(x, _rd_fmul(kf.d, ln2hi.d)), _rd_fmul(kf.d, ln2lo.d) );
 
     p.c = 0;
     for ( int i = 12; i-- != 0; ) {        // Horner over flop(cs): c11..c0
       c.c = cs[i];
-      p.d = f64_add(f64_mul(p.d, rr.d), c.d);
+      p.d = _rd_fadd(_rd_fmul(p.d, rr.d), c.d);
     }
     return _rd_scale2(p.d, k);
   }
@@ -139,24 +197,24 @@ typedef int64_t  c3_ds;
     r0.d = x;
     int sub = ( ((r0.c >> 52) & 0x7ffULL) == 0 );
     xx = r0;
-    if ( sub ) xx.d = f64_mul(x, _rd_bits(0x4350000000000000ULL).d);   // x * 2^54
+    if ( sub ) xx.d = _rd_fmul(x, _rd_bits(0x4350000000000000ULL).d);   // x * 2^54
     c3_ds ae = sub ? -54 : 0;
     c3_d  b  = xx.c;
     c3_ds e  = (c3_ds)((b >> 52) & 0x7ffULL) - 1023;
     m.c = (b & 0xfffffffffffffULL) | 0x3ff0000000000000ULL;            // m in [1,2)
     if ( f64_le(_rd_bits(0x3ff6a09e667f3bcdULL).d, m.d) ) {            // m >= sqrt(2)
-      m.d = f64_mul(m.d, _rd_bits(0x3fe0000000000000ULL).d); e = e + 1;
+      m.d = _rd_fmul(m.d, _rd_bits(0x3fe0000000000000ULL).d); e = e + 1;
     }
     e = e + ae;
-    f.d = f64_sub(m.d, one.d);
-    s.d = f64_div(f.d, f64_add(m.d, one.d));
-    z.d = f64_mul(s.d, s.d);
+    f.d = _rd_fsub(m.d, one.d);
+    s.d = _rd_fdiv(f.d, _rd_fadd(m.d, one.d));
+    z.d = _rd_fmul(s.d, s.d);
     p.c = 0;
-    for ( int i = 10; i-- != 0; ) { c.c = cs[i]; p.d = f64_add(f64_mul(p.d, z.d), c.d); }
-    rr.d = f64_mul(f64_add(z.d, z.d), p.d);
-    l1.d = f64_sub(f.d, f64_mul(s.d, f64_sub(f.d, rr.d)));
+    for ( int i = 10; i-- != 0; ) { c.c = cs[i]; p.d = _rd_fadd(_rd_fmul(p.d, z.d), c.d); }
+    rr.d = _rd_fmul(_rd_fadd(z.d, z.d), p.d);
+    l1.d = _rd_fsub(f.d, _rd_fmul(s.d, _rd_fsub(f.d, rr.d)));
     efd.d = ui64_to_f64( (c3_d)(e < 0 ? -e : e) );
-    if ( e < 0 ) efd.d = f64_sub(zero.d, efd.d);
+    if ( e < 0 ) efd.d = _rd_fsub(zero.d, efd.d);
     *ef = efd.d; *lm = l1.d;
   }
   //  shared guard: 0 on NaN/+inf/+-0/x<0 returned via *out
@@ -172,25 +230,25 @@ typedef int64_t  c3_ds;
     float64_t g, ef, lm; union doub hi, lo;
     if ( _rd_log_guard(x, &g) ) return g;
     _rd_lr(x, &ef, &lm);
-    hi.d = f64_mul(ef, _rd_bits(0x3fe62e42fee00000ULL).d);            // e*ln2hi
-    lo.d = f64_mul(ef, _rd_bits(0x3dea39ef35793c76ULL).d);            // e*ln2lo
-    return f64_add(hi.d, f64_add(lm, lo.d));
+    hi.d = _rd_fmul(ef, _rd_bits(0x3fe62e42fee00000ULL).d);            // e*ln2hi
+    lo.d = _rd_fmul(ef, _rd_bits(0x3dea39ef35793c76ULL).d);            // e*ln2lo
+    return _rd_fadd(hi.d, _rd_fadd(lm, lo.d));
   }
   static float64_t _rd_log2(float64_t x) {
     float64_t g, ef, lm;
     if ( _rd_log_guard(x, &g) ) return g;
     _rd_lr(x, &ef, &lm);                                              // e + lm/ln2
-    return f64_add(ef, f64_mul(lm, _rd_bits(0x3ff71547652b82feULL).d));
+    return _rd_fadd(ef, _rd_fmul(lm, _rd_bits(0x3ff71547652b82feULL).d));
   }
   static float64_t _rd_log10(float64_t x) {
     float64_t g, ef, lm;
     if ( _rd_log_guard(x, &g) ) return g;
     _rd_lr(x, &ef, &lm);                                              // e*log10(2) + lm/ln10
-    return f64_add(f64_mul(ef, _rd_bits(0x3fd34413509f79ffULL).d),
-                   f64_mul(lm, _rd_bits(0x3fdbcb7b1526e50eULL).d));
+    return _rd_fadd(_rd_fmul(ef, _rd_bits(0x3fd34413509f79ffULL).d),
+                   _rd_fmul(lm, _rd_bits(0x3fdbcb7b1526e50eULL).d));
   }
 
-  static inline float64_t _rd_neg(float64_t a) { union doub z; z.c=0; return f64_sub(z.d, a); }
+  static inline float64_t _rd_neg(float64_t a) { union doub z; z.c=0; return _rd_fsub(z.d, a); }
 
 /* @rd sin/cos -- math.hoon ++rd ++sin/++cos/++rd-trig
 **   x = q*(pi/2) + (rhi+rlo) (2-part pi/2), fdlibm sin/cos kernels by q&3.
@@ -209,46 +267,48 @@ typedef int64_t  c3_ds;
   static float64_t _rd_ksin(float64_t xx, float64_t yy) {
     union doub z, r, v, aa, bb, dd, c, half;
     half.c = 0x3fe0000000000000ULL;
-    z.d = f64_mul(xx, xx);
+    z.d = _rd_fmul(xx, xx);
     r.c = 0;                            // Horner over flop(tail sc): sc[7..1]
-    for ( int i = 8; i-- != 1; ) { c.c = _RD_SC[i]; r.d = f64_add(f64_mul(r.d, z.d), c.d); }
-    v.d = f64_mul(z.d, xx);
-    aa.d = f64_sub(f64_mul(half.d, yy), f64_mul(v.d, r.d));
-    bb.d = f64_sub(f64_mul(z.d, aa.d), yy);
-    dd.d = f64_sub(bb.d, f64_mul(v.d, _rd_bits(_RD_SC[0]).d));
-    return f64_sub(xx, dd.d);
+    for ( int i = 8; i-- != 1; ) { c.c = _RD_SC[i]; r.d = _rd_fadd(_rd_fmul(r.d, z.d), c.d); }
+    v.d = _rd_fmul(z.d, xx);
+    aa.d = _rd_fsub(_rd_fmul(half.d, yy), _rd_fmul(v.d, r.d));
+    bb.d = _rd_fsub(_rd_fmul(z.d, aa.d), yy);
+    dd.d = _rd_fsub(bb.d, _rd_fmul(v.d, _rd_bits(_RD_SC[0]).d));
+    return _rd_fsub(xx, dd.d);
   }
   static float64_t _rd_kcos(float64_t xx, float64_t yy) {
     union doub z, rc, hz, w2, aa, bb, c, half, one;
     half.c = 0x3fe0000000000000ULL; one.c = 0x3ff0000000000000ULL;
-    z.d = f64_mul(xx, xx);
+    z.d = _rd_fmul(xx, xx);
     rc.c = 0;                          // Horner over flop(cc): cc[7..0]
-    for ( int i = 8; i-- != 0; ) { c.c = _RD_CC[i]; rc.d = f64_add(f64_mul(rc.d, z.d), c.d); }
-    hz.d = f64_mul(half.d, z.d);
-    w2.d = f64_sub(one.d, hz.d);
-    aa.d = f64_sub(f64_sub(one.d, w2.d), hz.d);
-    bb.d = f64_sub(f64_mul(f64_mul(z.d, z.d), rc.d), f64_mul(xx, yy));
-    return f64_add(w2.d, f64_add(aa.d, bb.d));
-  }
-  //  trig-fin: is_sin ? sin(x) : cos(x); ax=|x|, sb=sign bit (math.hoon:1643)
-  static float64_t _rd_trigfin(int is_sin, float64_t ax, c3_d sb) {
+    for ( int i = 8; i-- != 0; ) { c.c = _RD_CC[i]; rc.d = _rd_fadd(_rd_fmul(rc.d, z.d), c.d); }
+    hz.d = _rd_fmul(half.d, z.d);
+    w2.d = _rd_fsub(one.d, hz.d);
+    aa.d = _rd_fsub(_rd_fsub(one.d, w2.d), hz.d);
+    bb.d = _rd_fsub(_rd_fmul(_rd_fmul(z.d, z.d), rc.d), _rd_fmul(xx, yy));
+    return _rd_fadd(w2.d, _rd_fadd(aa.d, bb.d));
+  }
+  //  trig-sc: sin(x) -> *s, cos(x) -> *c off one reduction; ax=|x|, sb=sign bit (math.hoon:1643)
+  static void _rd_trigsc(float64_t ax, c3_d sb, float64_t* s, float64_t* c) {
     union doub qf, t, w, rhi, rlo, ks, kc, v;
-    c3_ds q = (c3_ds)f64_to_i64(f64_mul(ax, _rd_bits(0x3fe45f306dc9c883ULL).d),
+    c3_ds q = (c3_ds)f64_to_i64(_rd_fmul(ax, _rd_bits(0x3fe45f306dc9c883ULL).d),
                                 softfloat_round_near_even, 0);          // round(ax*2/pi)
     c3_d  aq = (c3_d)(q < 0 ? -q : q);
     qf.d = ui64_to_f64(aq);
-    t.d = f64_sub(ax, f64_mul(qf.d, _rd_bits(0x3ff921fb54400000ULL).d)); // ax - qf*pi/2_hi
-    w.d = f64_mul(qf.d, _rd_bits(0x3dd0b4611a626331ULL).d);             // qf*pi/2_lo
-    rhi.d = f64_sub(t.d, w.d);
-    rlo.d = f64_sub(f64_sub(t.d, rhi.d), w.d);
+    t.d = _rd_fsub(ax, _rd_fmul(qf.d, _rd_bits(0x3ff921fb54400000ULL).d)); // ax - qf*pi/2_hi
+    w.d = _rd_fmul(qf.d, _rd_bits(0x3dd0b4611a626331ULL).d);             // qf*pi/2_lo
+    rhi.d = _rd_fsub(t.d, w.d);
+    rlo.d = _rd_fsub(_rd_fsub(t.d, rhi.d), w.d);
     int m = (int)(aq & 3);
     ks.d = _rd_ksin(rhi.d, rlo.d);
     kc.d = _rd_kcos(rhi.d, rlo.d);
-    if ( is_sin ) {
-      v.d = (m==0) ? ks.d : (m==1) ? kc.d : (m==2) ? _rd_neg(ks.d) : _rd_neg(kc.d);
-      return (sb == 1) ? _rd_neg(v.d) : v.d;
-    }
-    return (m==0) ? kc.d : (m==1) ? _rd_neg(ks.d) : (m==2) ? _rd_neg(kc.d) : ks.d;
+    v.d = (m==0) ? ks.d : (m==1) ? kc.d : (m==2) ? _rd_neg(ks.d) : _rd_neg(kc.d);
+    *s = (sb == 1) ? _rd_neg(v.d) : v.d;
+    *c = (m==0) ? kc.d : (m==1) ? _rd_neg(ks.d) : (m==2) ? _rd_neg(kc.d) : ks.d;
+  }
+  //  trig-fin: is_sin ? sin(x) : cos(x)
+  static float64_t _rd_trigfin(int is_sin, float64_t ax, c3_d sb) {
+    float64_t s, c; _rd_trigsc(ax, sb, &s, &c); return is_sin ? s : c;
   }
   static float64_t _rd_sin(float64_t x) {
     union doub r0, ax;
@@ -267,6 +327,17 @@ typedef int64_t  c3_ds;
     ax.c = r0.c & 0x7fffffffffffffffULL;
     return _rd_trigfin(0, ax.d, 0);
   }
+  //  sincos: sin and cos off one reduction, bit-identical to the pair
+  static void _rd_sincos(float64_t x, float64_t* s, float64_t* c) {
+    union doub r0, ax;
+    r0.d = x;
+    if ( !f64_eq(x, x) || (r0.c == _RD_PINF)||(r0.c == _RD_NINF) ) {       // NaN, +-inf -> NaN
+      r0.c = _RD_QNAN; *s = *c = r0.d; return;
+    }
+    ax.c = r0.c & 0x7fffffffffffffffULL;
+    _rd_trigsc(ax.d, r0.c >> 63, s, c);
+    if ( (r0.c == 0)||(r0.c == 0x8000000000000000ULL) ) { *s = x; }        // sin +-0 -> +-0
+  }
 
 /* @rd tan -- math.hoon ++rd ++tan/++rd-tan (fdlibm __kernel_tan)
 **   q*pi/2 reduction; big |x|~pi/4 reduced; odd q -> -cot path.
@@ -289,37 +360,37 @@ typedef int64_t  c3_ds;
     xa.d = (hxneg == 1) ? _rd_neg(x) : x;
     ya.d = (hxneg == 1) ? _rd_neg(y) : y;
     if ( big ) {                       // pio4_hi - xa + (pio4_lo - ya)
-      xr.d = f64_add(f64_sub(_rd_bits(0x3fe921fb54442d18ULL).d, xa.d),
-                     f64_sub(_rd_bits(0x3c81a62633145c07ULL).d, ya.d));
+      xr.d = _rd_fadd(_rd_fsub(_rd_bits(0x3fe921fb54442d18ULL).d, xa.d),
+                     _rd_fsub(_rd_bits(0x3c81a62633145c07ULL).d, ya.d));
       yr.c = 0;
     } else { xr.d = x; yr.d = y; }
-    z.d = f64_mul(xr.d, xr.d);
-    w.d = f64_mul(z.d, z.d);
+    z.d = _rd_fmul(xr.d, xr.d);
+    w.d = _rd_fmul(z.d, z.d);
     rr.c = 0;
-    for ( int i = 6; i-- != 0; ) { c.c = rl[i]; rr.d = f64_add(f64_mul(rr.d, w.d), c.d); }
+    for ( int i = 6; i-- != 0; ) { c.c = rl[i]; rr.d = _rd_fadd(_rd_fmul(rr.d, w.d), c.d); }
     vp.c = 0;
-    for ( int i = 6; i-- != 0; ) { c.c = vl[i]; vp.d = f64_add(f64_mul(vp.d, w.d), c.d); }
-    vv.d = f64_mul(z.d, vp.d);
-    s.d = f64_mul(z.d, xr.d);
-    r.d = f64_add(yr.d, f64_mul(z.d, f64_add(f64_mul(s.d, f64_add(rr.d, vv.d)), yr.d)));
-    r.d = f64_add(r.d, f64_mul(third.d, s.d));
-    w2.d = f64_add(xr.d, r.d);
+    for ( int i = 6; i-- != 0; ) { c.c = vl[i]; vp.d = _rd_fadd(_rd_fmul(vp.d, w.d), c.d); }
+    vv.d = _rd_fmul(z.d, vp.d);
+    s.d = _rd_fmul(z.d, xr.d);
+    r.d = _rd_fadd(yr.d, _rd_fmul(z.d, _rd_fadd(_rd_fmul(s.d, _rd_fadd(rr.d, vv.d)), yr.d)));
+    r.d = _rd_fadd(r.d, _rd_fmul(third.d, s.d));
+    w2.d = _rd_fadd(xr.d, r.d);
     if ( big ) {
       union doub fac, v, t1;
       fac.d = (hxneg == 1) ? mone.d : one.d;
       v.d   = (iy == 1) ? one.d : mone.d;
-      t1.d = f64_sub(f64_div(f64_mul(w2.d, w2.d), f64_add(w2.d, v.d)), r.d);
-      t1.d = f64_mul(two.d, f64_sub(xr.d, t1.d));
-      return f64_mul(fac.d, f64_sub(v.d, t1.d));
+      t1.d = _rd_fsub(_rd_fdiv(_rd_fmul(w2.d, w2.d), _rd_fadd(w2.d, v.d)), r.d);
+      t1.d = _rd_fmul(two.d, _rd_fsub(xr.d, t1.d));
+      return _rd_fmul(fac.d, _rd_fsub(v.d, t1.d));
     }
     if ( iy == 1 ) return w2.d;
     { union doub zz, vv2, a, tt, ss;     // -cot path
       zz.c  = w2.c & 0xffffffff00000000ULL;
-      vv2.d = f64_sub(r.d, f64_sub(zz.d, xr.d));
-      a.d   = f64_div(mone.d, w2.d);
+      vv2.d = _rd_fsub(r.d, _rd_fsub(zz.d, xr.d));
+      a.d   = _rd_fdiv(mone.d, w2.d);
       tt.c  = a.c & 0xffffffff00000000ULL;
-      ss.d  = f64_add(one.d, f64_mul(tt.d, zz.d));
-      return f64_add(tt.d, f64_mul(a.d, f64_add(ss.d, f64_mul(tt.d, vv2.d))));
+      ss.d  = _rd_fadd(one.d, _rd_fmul(tt.d, zz.d));
+      return _rd_fadd(tt.d, _rd_fmul(a.d, _rd_fadd(ss.d, _rd_fmul(tt.d, vv2.d))));
     }
   }
   static float64_t _rd_tan(float64_t x) {
@@ -330,14 +401,14 @@ typedef int64_t  c3_ds;
     if ( (r0.c == 0)||(r0.c == 0x8000000000000000ULL) ) { return x; }
     c3_d neg = r0.c >> 63;
     ax.c = r0.c & 0x7fffffffffffffffULL;
-    c3_ds q = (c3_ds)f64_to_i64(f64_mul(ax.d, _rd_bits(0x3fe45f306dc9c883ULL).d),
+    c3_ds q = (c3_ds)f64_to_i64(_rd_fmul(ax.d, _rd_bits(0x3fe45f306dc9c883ULL).d),
                                 softfloat_round_near_even, 0);
     c3_d aq = (c3_d)(q < 0 ? -q : q);
     qf.d = ui64_to_f64(aq);
-    t.d = f64_sub(ax.d, f64_mul(qf.d, _rd_bits(0x3ff921fb54400000ULL).d));
-    w.d = f64_mul(qf.d, _rd_bits(0x3dd0b4611a626331ULL).d);
-    rhi.d = f64_sub(t.d, w.d);
-    rlo.d = f64_sub(f64_sub(t.d, rhi.d), w.d);
+    t.d = _rd_fsub(ax.d, _rd_fmul(qf.d, _rd_bits(0x3ff921fb54400000ULL).d));
+    w.d = _rd_fmul(qf.d, _rd_bits(0x3dd0b4611a626331ULL).d);
+    rhi.d = _rd_fsub(t.d, w.d);
+    rlo.d = _rd_fsub(_rd_fsub(t.d, rhi.d), w.d);
     c3_ds iy = ((aq & 1) == 0) ? 1 : -1;
     res.d = _rd_ktan(rhi.d, rlo.d, iy);
     return (neg == 1) ? _rd_neg(res.d) : res.d;
@@ -365,55 +436,55 @@ typedef int64_t  c3_ds;
     if ( f64_lt(ax.d, _rd_bits(0x3fdc000000000000ULL).d) ) {            // |x| < 7/16
       xr.d = ax.d; hi.c = 0; lo.c = 0; dir = 1;
     } else if ( f64_lt(ax.d, _rd_bits(0x3fe6000000000000ULL).d) ) {     // < 11/16
-      xr.d = f64_div(f64_sub(f64_add(ax.d, ax.d), one.d), f64_add(two.d, ax.d));
+      xr.d = _rd_fdiv(_rd_fsub(_rd_fadd(ax.d, ax.d), one.d), _rd_fadd(two.d, ax.d));
       hi.c = 0x3fddac670561bb4fULL; lo.c = 0x3c7a2b7f222f65e2ULL;       // atan(0.5)
     } else if ( f64_lt(ax.d, _rd_bits(0x3ff3000000000000ULL).d) ) {     // < 19/16
-      xr.d = f64_div(f64_sub(ax.d, one.d), f64_add(ax.d, one.d));
+      xr.d = _rd_fdiv(_rd_fsub(ax.d, one.d), _rd_fadd(ax.d, one.d));
       hi.c = 0x3fe921fb54442d18ULL; lo.c = 0x3c81a62633145c07ULL;       // atan(1)=pi/4
     } else if ( f64_lt(ax.d, _rd_bits(0x4003800000000000ULL).d) ) {     // < 39/16
-      xr.d = f64_div(f64_sub(ax.d, ohf.d), f64_add(one.d, f64_mul(ohf.d, ax.d)));
+      xr.d = _rd_fdiv(_rd_fsub(ax.d, ohf.d), _rd_fadd(one.d, _rd_fmul(ohf.d, ax.d)));
       hi.c = 0x3fef730bd281f69bULL; lo.c = 0x3c7007887af0cbbdULL;       // atan(1.5)
     } else {                                                            // -1/x
-      xr.d = f64_div(_rd_bits(0xbff0000000000000ULL).d, ax.d);
+      xr.d = _rd_fdiv(_rd_bits(0xbff0000000000000ULL).d, ax.d);
       hi.c = 0x3ff921fb54442d18ULL; lo.c = 0x3c91a62633145c07ULL;       // pi/2
     }
-    z.d = f64_mul(xr.d, xr.d);
+    z.d = _rd_fmul(xr.d, xr.d);
     sp.c = 0;
-    for ( int i = 11; i-- != 0; ) { c.c = at[i]; sp.d = f64_add(f64_mul(sp.d, z.d), c.d); }
-    s.d = f64_mul(z.d, sp.d);
-    if ( dir ) res.d = f64_sub(xr.d, f64_mul(xr.d, s.d));
-    else       res.d = f64_sub(hi.d, f64_sub(f64_sub(f64_mul(xr.d, s.d), lo.d), xr.d));
+    for ( int i = 11; i-- != 0; ) { c.c = at[i]; sp.d = _rd_fadd(_rd_fmul(sp.d, z.d), c.d); }
+    s.d = _rd_fmul(z.d, sp.d);
+    if ( dir ) res.d = _rd_fsub(xr.d, _rd_fmul(xr.d, s.d));
+    else       res.d = _rd_fsub(hi.d, _rd_fsub(_rd_fsub(_rd_fmul(xr.d, s.d), lo.d), xr.d));
     return (neg == 1) ? _rd_neg(res.d) : res.d;
   }
-  //  bare door ops (div/add/sub/mul) round per _math_rnd; atan kernel is %n.
-  static float64_t _rd_atan2(float64_t y, float64_t x) {
+  //  bare door ops (div/add/sub/mul) round per rnd; atan kernel is %n.
+  static float64_t _rd_atan2(float64_t y, float64_t x, int rnd) {
     union doub xb, pi, two, mone, zero, q, a, r;
     zero.c = 0; pi.c = 0x400921fb54442d18ULL;
     two.c = 0x4000000000000000ULL; mone.c = 0xbff0000000000000ULL;
     xb.d = x;
     if ( f64_lt(zero.d, x) ) {                                          // x>0: atan(div y x)
-      softfloat_roundingMode = _math_rnd; q.d = f64_div(y, x);
+      softfloat_roundingMode = rnd; q.d = _rd_fdiv(y, x);
       softfloat_roundingMode = softfloat_round_near_even; return _rd_atan(q.d);
     }
     if ( f64_lt(x, zero.d) && f64_le(zero.d, y) ) {                     // x<0,y>=0: add(atan,pi)
-      softfloat_roundingMode = _math_rnd; q.d = f64_div(y, x);
+      softfloat_roundingMode = rnd; q.d = _rd_fdiv(y, x);
       softfloat_roundingMode = softfloat_round_near_even; a.d = _rd_atan(q.d);
-      softfloat_roundingMode = _math_rnd; r.d = f64_add(a.d, pi.d);
+      softfloat_roundingMode = rnd; r.d = _rd_fadd(a.d, pi.d);
       softfloat_roundingMode = softfloat_round_near_even; return r.d;
     }
     if ( f64_lt(x, zero.d) && f64_lt(y, zero.d) ) {                     // x<0,y<0: sub(atan,pi)
-      softfloat_roundingMode = _math_rnd; q.d = f64_div(y, x);
+      softfloat_roundingMode = rnd; q.d = _rd_fdiv(y, x);
       softfloat_roundingMode = softfloat_round_near_even; a.d = _rd_atan(q.d);
-      softfloat_roundingMode = _math_rnd; r.d = f64_sub(a.d, pi.d);
+      softfloat_roundingMode = rnd; r.d = _rd_fsub(a.d, pi.d);
       softfloat_roundingMode = softfloat_round_near_even; return r.d;
     }
     if ( (xb.c == 0) && f64_lt(zero.d, y) ) {                           // x==+0,y>0: div(pi,2)
-      softfloat_roundingMode = _math_rnd; r.d = f64_div(pi.d, two.d);
+      softfloat_roundingMode = rnd; r.d = _rd_fdiv(pi.d, two.d);
       softfloat_roundingMode = softfloat_round_near_even; return r.d;
     }
     if ( (xb.c == 0) && f64_lt(y, zero.d) ) {                           // x==+0,y<0: mul(-1,div(pi,2))
-      softfloat_roundingMode = _math_rnd;
-      r.d = f64_mul(mone.d, f64_div(pi.d, two.d));
+      softfloat_roundingMode = rnd;
+      r.d = _rd_fmul(mone.d, _rd_fdiv(pi.d, two.d));
       softfloat_roundingMode = softfloat_round_near_even; return r.d;
     }
     return zero.d;
@@ -432,10 +503,10 @@ typedef int64_t  c3_ds;
     union doub pp, qq, c, one;
     one.c = 0x3ff0000000000000ULL;
     pp.c = 0;
-    for ( int i = 6; i-- != 0; ) { c.c = ps[i]; pp.d = f64_add(f64_mul(pp.d, t), c.d); }
+    for ( int i = 6; i-- != 0; ) { c.c = ps[i]; pp.d = _rd_fadd(_rd_fmul(pp.d, t), c.d); }
     qq.c = 0;
-    for ( int i = 4; i-- != 0; ) { c.c = qs[i]; qq.d = f64_add(f64_mul(qq.d, t), c.d); }
-    return f64_div(f64_mul(t, pp.d), f64_add(one.d, f64_mul(t, qq.d)));
+    for ( int i = 4; i-- != 0; ) { c.c = qs[i]; qq.d = _rd_fadd(_rd_fmul(qq.d, t), c.d); }
+    return _rd_fdiv(_rd_fmul(t, pp.d), _rd_fadd(one.d, _rd_fmul(t, qq.d)));
   }
   static float64_t _rd_asin(float64_t x) {
     union doub r0, ax, t, w, r, s, res, half, one, two, pio2h, pio2l, pio4;
@@ -447,26 +518,26 @@ typedef int64_t  c3_ds;
     ax.c = r0.c & 0x7fffffffffffffffULL;
     if ( f64_lt(one.d, ax.d) )      { r0.c = _RD_QNAN; return r0.d; }   // |x|>1 -> NaN
     if ( ax.c == one.c )                                               // |x|==1
-      return f64_add(f64_mul(x, pio2h.d), f64_mul(x, pio2l.d));
+      return _rd_fadd(_rd_fmul(x, pio2h.d), _rd_fmul(x, pio2l.d));
     if ( f64_lt(ax.d, half.d) ) {                                     // |x|<0.5
       if ( f64_lt(ax.d, _rd_bits(0x3e50000000000000ULL).d) ) return x; // tiny
-      t.d = f64_mul(x, x);
-      return f64_add(x, f64_mul(x, _rd_ainv_rr(t.d)));
+      t.d = _rd_fmul(x, x);
+      return _rd_fadd(x, _rd_fmul(x, _rd_ainv_rr(t.d)));
     }
-    w.d = f64_sub(one.d, ax.d);
-    t.d = f64_mul(w.d, half.d);
+    w.d = _rd_fsub(one.d, ax.d);
+    t.d = _rd_fmul(w.d, half.d);
     r.d = _rd_ainv_rr(t.d);
-    s.d = f64_sqrt(t.d);
+    s.d = _rd_fsqrt(t.d);
     if ( f64_le(_rd_bits(0x3fef333300000000ULL).d, ax.d) ) {           // near 1
-      res.d = f64_sub(pio2h.d, f64_sub(f64_mul(two.d, f64_add(s.d, f64_mul(s.d, r.d))), pio2l.d));
+      res.d = _rd_fsub(pio2h.d, _rd_fsub(_rd_fmul(two.d, _rd_fadd(s.d, _rd_fmul(s.d, r.d))), pio2l.d));
       return (sgn == 1) ? _rd_neg(res.d) : res.d;
     }
     { union doub df, cc, p2, q2;                                       // head/tail
       df.c = s.c & 0xffffffff00000000ULL;
-      cc.d = f64_div(f64_sub(t.d, f64_mul(df.d, df.d)), f64_add(s.d, df.d));
-      p2.d = f64_sub(f64_mul(two.d, f64_mul(s.d, r.d)), f64_sub(pio2l.d, f64_mul(two.d, cc.d)));
-      q2.d = f64_sub(pio4.d, f64_mul(two.d, df.d));
-      res.d = f64_sub(pio4.d, f64_sub(p2.d, q2.d));
+      cc.d = _rd_fdiv(_rd_fsub(t.d, _rd_fmul(df.d, df.d)), _rd_fadd(s.d, df.d));
+      p2.d = _rd_fsub(_rd_fmul(two.d, _rd_fmul(s.d, r.d)), _rd_fsub(pio2l.d, _rd_fmul(two.d, cc.d)));
+      q2.d = _rd_fsub(pio4.d, _rd_fmul(two.d, df.d));
+      res.d = _rd_fsub(pio4.d, _rd_fsub(p2.d, q2.d));
       return (sgn == 1) ? _rd_neg(res.d) : res.d;
     }
   }
@@ -481,29 +552,29 @@ typedef int64_t  c3_ds;
     if ( f64_lt(one.d, ax.d) )      { r0.c = _RD_QNAN; return r0.d; }   // |x|>1 -> NaN
     if ( ax.c == one.c ) {                                             // |x|==1
       if ( neg == 0 ) { union doub z0; z0.c = 0; return z0.d; }         // 1 -> 0
-      return f64_add(pi.d, f64_mul(two.d, pio2l.d));                    // -1 -> pi
+      return _rd_fadd(pi.d, _rd_fmul(two.d, pio2l.d));                    // -1 -> pi
     }
     if ( f64_lt(ax.d, half.d) ) {                                     // |x|<0.5
       if ( f64_lt(ax.d, _rd_bits(0x3c60000000000000ULL).d) ) return pio2h.d;  // tiny -> pi/2
-      z.d = f64_mul(x, x);
+      z.d = _rd_fmul(x, x);
       r.d = _rd_ainv_rr(z.d);
-      return f64_sub(pio2h.d, f64_sub(x, f64_sub(pio2l.d, f64_mul(x, r.d))));
+      return _rd_fsub(pio2h.d, _rd_fsub(x, _rd_fsub(pio2l.d, _rd_fmul(x, r.d))));
     }
     if ( neg == 1 ) {                                                 // x <= -0.5
-      z.d = f64_mul(f64_add(one.d, x), half.d);
-      s.d = f64_sqrt(z.d);
+      z.d = _rd_fmul(_rd_fadd(one.d, x), half.d);
+      s.d = _rd_fsqrt(z.d);
       r.d = _rd_ainv_rr(z.d);
-      w.d = f64_sub(f64_mul(r.d, s.d), pio2l.d);
-      return f64_sub(pi.d, f64_mul(two.d, f64_add(s.d, w.d)));
+      w.d = _rd_fsub(_rd_fmul(r.d, s.d), pio2l.d);
+      return _rd_fsub(pi.d, _rd_fmul(two.d, _rd_fadd(s.d, w.d)));
     }
     { union doub df, cc;                                              // x >= 0.5
-      z.d = f64_mul(f64_sub(one.d, x), half.d);
-      s.d = f64_sqrt(z.d);
+      z.d = _rd_fmul(_rd_fsub(one.d, x), half.d);
+      s.d = _rd_fsqrt(z.d);
       df.c = s.c & 0xffffffff00000000ULL;
-      cc.d = f64_div(f64_sub(z.d, f64_mul(df.d, df.d)), f64_add(s.d, df.d));
+      cc.d = _rd_fdiv(_rd_fsub(z.d, _rd_fmul(df.d, df.d)), _rd_fadd(s.d, df.d));
       r.d = _rd_ainv_rr(z.d);
-      w.d = f64_add(f64_mul(r.d, s.d), cc.d);
-      return f64_mul(two.d, f64_add(df.d, w.d));
+      w.d = _rd_fadd(_rd_fmul(r.d, s.d), cc.d);
+      return _rd_fmul(two.d, _rd_fadd(df.d, w.d));
     }
   }
 
@@ -517,7 +588,7 @@ typedef int64_t  c3_ds;
     if ( r0.c == _RD_PINF )                    { return x; }                      // +inf
     if ( (r0.c == 0)||(r0.c == 0x8000000000000000ULL) ) { return x; }             // +-0
     if ( (r0.c >> 63) == 1 )                   { r0.c = _RD_QNAN; return r0.d; }  // x<0 -> NaN
-    return f64_sqrt(x);
+    return _rd_fsqrt(x);
   }
   static float64_t _rd_cbt(float64_t x) {
     union doub r0, ax, r;
@@ -525,7 +596,7 @@ typedef int64_t  c3_ds;
     if ( !f64_eq(x, x) )                       { return x; }                      // NaN -> NaN
     if ( (r0.c == 0)||(r0.c == 0x8000000000000000ULL) ) { return x; }             // +-0
     ax.c = r0.c & 0x7fffffffffffffffULL;
-    r.d = _rd_exp(f64_mul(_rd_log(ax.d), _rd_bits(0x3fd5555555555555ULL).d));     // exp(log|x|/3)
+    r.d = _rd_exp(_rd_fmul(_rd_log(ax.d), _rd_bits(0x3fd5555555555555ULL).d));     // exp(log|x|/3)
     return ((r0.c >> 63) == 1) ? _rd_neg(r.d) : r.d;
   }
 
@@ -533,30 +604,30 @@ typedef int64_t  c3_ds;
 **   pow-n: x^n by repeated mul (n a positive integer as @rd).
 **   pow: positive-integer fast path -> pow-n, else exp(n*log x).
 */
-  static float64_t _rd_pow_n(float64_t x, float64_t n) {
+  static float64_t _rd_pow_n(float64_t x, float64_t n, int rnd) {
     union doub nn, p, one, two;
     one.c = 0x3ff0000000000000ULL; two.c = 0x4000000000000000ULL;
     nn.d = n;
     if ( nn.c == 0 ) return one.d;             // n == +0 -> 1
-    softfloat_roundingMode = _math_rnd;        // bare mul/sub round per door r
+    softfloat_roundingMode = rnd;        // bare mul/sub round per door r
     p.d = x;
     while ( !f64_lt(n, two.d) ) {              // while n >= 2: p *= x; n -= 1
-      p.d = f64_mul(p.d, x);
-      n = f64_sub(n, one.d);
+      p.d = _rd_fmul(p.d, x);
+      n = _rd_fsub(n, one.d);
     }
     softfloat_roundingMode = softfloat_round_near_even;
     return p.d;
   }
-  static float64_t _rd_pow(float64_t x, float64_t n) {
+  static float64_t _rd_pow(float64_t x, float64_t n, int rnd) {
     union doub nn, ni, zero, lg, prod;
     zero.c = 0; nn.d = n;
     //  integer detection is rounding-mode-independent (exact for true integers)
     ni.d = i64_to_f64(f64_to_i64(n, softfloat_round_near_even, 0));   // san (need (toi n))
     if ( (nn.c == ni.c) && f64_lt(zero.d, n) )                        // positive integer
-      return _rd_pow_n(x, ni.d);
+      return _rd_pow_n(x, ni.d, rnd);
     lg.d = _rd_log(x);                                                // %n kernel
-    softfloat_roundingMode = _math_rnd;                              // bare mul per door r
-    prod.d = f64_mul(n, lg.d);
+    softfloat_roundingMode = rnd;                              // bare mul per door r
+    prod.d = _rd_fmul(n, lg.d);
     softfloat_roundingMode = softfloat_round_near_even;
     return _rd_exp(prod.d);                                           // %n kernel: exp(n*log x)
   }
@@ -669,8 +740,8 @@ typedef int64_t  c3_ds;
     bb.s = f32_sub(f32_mul(f32_mul(z.s, z.s), rc.s), f32_mul(xx, yy));
     return f32_add(w2.s, f32_add(aa.s, bb.s));
   }
-  //  trig-fin: is_sin ? sin(x) : cos(x); ax=|x|, sb=sign bit
-  static float32_t _rs_trigfin(int is_sin, float32_t ax, uint32_t sb) {
+  //  trig-sc: sin(x) -> *s, cos(x) -> *c off one reduction; ax=|x|, sb=sign bit
+  static void _rs_trigsc(float32_t ax, uint32_t sb, float32_t* s, float32_t* c) {
     union sing qf, r1, r2, w, rhi, rlo, ks, kc, v;
     c3_ds q = (c3_ds)f32_to_i32(f32_mul(ax, _rs_bits(0x3f22f983U).s),
                                 softfloat_round_near_even, 0);          // round(ax*2/pi)
@@ -684,11 +755,13 @@ typedef int64_t  c3_ds;
     int m = (int)(aq & 3);
     ks.s = _rs_ksin(rhi.s, rlo.s);
     kc.s = _rs_kcos(rhi.s, rlo.s);
-    if ( is_sin ) {
-      v.s = (m==0) ? ks.s : (m==1) ? kc.s : (m==2) ? _rs_neg(ks.s) : _rs_neg(kc.s);
-      return (sb == 1) ? _rs_neg(v.s) : v.s;
-    }
-    return (m==0) ? kc.s : (m==1) ? _rs_neg(ks.s) : (m==2) ? _rs_neg(kc.s) : ks.s;
+    v.s = (m==0) ? ks.s : (m==1) ? kc.s : (m==2) ? _rs_neg(ks.s) : _rs_neg(kc.s);
+    *s = (sb == 1) ? _rs_neg(v.s) : v.s;
+    *c = (m==0) ? kc.s : (m==1) ? _rs_neg(ks.s) : (m==2) ? _rs_neg(kc.s) : ks.s;
+  }
+  //  trig-fin: is_sin ? sin(x) : cos(x)
+  static float32_t _rs_trigfin(int is_sin, float32_t ax, uint32_t sb) {
+    float32_t s, c; _rs_trigsc(ax, sb, &s, &c); return is_sin ? s : c;
   }
   static float32_t _rs_sin(float32_t x) {
     union sing r0, ax;
@@ -707,10 +780,21 @@ typedef int64_t  c3_ds;
     ax.c = r0.c & 0x7fffffffU;
     return _rs_trigfin(0, ax.s, 0);
   }
+  //  sincos: sin and cos off one reduction, bit-identical to the pair
+  static void _rs_sincos(float32_t x, float32_t* s, float32_t* c) {
+    union sing r0, ax;
+    r0.s = x;
+    if ( !f32_eq(x, x) || (r0.c == _RS_PINF)||(r0.c == _RS_NINF) ) {       // NaN, +-inf -> NaN
+      r0.c = _RS_QNAN; *s = *c = r0.s; return;
+    }
+    ax.c = r0.c & 0x7fffffffU;
+    _rs_trigsc(ax.s, r0.c >> 31, s, c);
+    if ( (r0.c == 0)||(r0.c == 0x80000000U) ) { *s = x; }                  // sin +-0 -> +-0
+  }
   //  tan = (div (sin x) (cos x)): sin/cos kernels %n, the bare div per door r
-  static float32_t _rs_tan(float32_t x) {
+  static float32_t _rs_tan(float32_t x, int rnd) {
     float32_t s = _rs_sin(x), c = _rs_cos(x);
-    softfloat_roundingMode = _math_rnd;
+    softfloat_roundingMode = rnd;
     float32_t r = f32_div(s, c);
     softfloat_roundingMode = softfloat_round_near_even;
     return r;
@@ -908,33 +992,33 @@ typedef int64_t  c3_ds;
     else       res.s = f32_sub(hi.s, f32_sub(f32_sub(f32_mul(xr.s, s.s), lo.s), xr.s));
     return (neg == 1) ? _rs_neg(res.s) : res.s;
   }
-  //  bare door ops (div/add/sub/mul) round per _math_rnd; atan kernel is %n.
-  static float32_t _rs_atan2(float32_t y, float32_t x) {
+  //  bare door ops (div/add/sub/mul) round per rnd; atan kernel is %n.
+  static float32_t _rs_atan2(float32_t y, float32_t x, int rnd) {
     union sing xb, pi, two, zero, mone, q, a, r;
     zero.c = 0; pi.c = 0x40490fdbU; two.c = 0x40000000U; mone.c = 0xbf800000U;
     xb.s = x;
     if ( f32_lt(zero.s, x) ) {                                     // x>0: atan(div y x)
-      softfloat_roundingMode = _math_rnd; q.s = f32_div(y, x);
+      softfloat_roundingMode = rnd; q.s = f32_div(y, x);
       softfloat_roundingMode = softfloat_round_near_even; return _rs_atan(q.s);
     }
     if ( f32_lt(x, zero.s) && f32_le(zero.s, y) ) {                // x<0,y>=0: add(atan,pi)
-      softfloat_roundingMode = _math_rnd; q.s = f32_div(y, x);
+      softfloat_roundingMode = rnd; q.s = f32_div(y, x);
       softfloat_roundingMode = softfloat_round_near_even; a.s = _rs_atan(q.s);
-      softfloat_roundingMode = _math_rnd; r.s = f32_add(a.s, pi.s);
+      softfloat_roundingMode = rnd; r.s = f32_add(a.s, pi.s);
       softfloat_roundingMode = softfloat_round_near_even; return r.s;
     }
     if ( f32_lt(x, zero.s) && f32_lt(y, zero.s) ) {                // x<0,y<0: sub(atan,pi)
-      softfloat_roundingMode = _math_rnd; q.s = f32_div(y, x);
+      softfloat_roundingMode = rnd; q.s = f32_div(y, x);
       softfloat_roundingMode = softfloat_round_near_even; a.s = _rs_atan(q.s);
-      softfloat_roundingMode = _math_rnd; r.s = f32_sub(a.s, pi.s);
+      softfloat_roundingMode = rnd; r.s = f32_sub(a.s, pi.s);
       softfloat_roundingMode = softfloat_round_near_even; return r.s;
     }
     if ( (xb.c == 0) && f32_lt(zero.s, y) ) {                      // x==+0,y>0: div(pi,2)
-      softfloat_roundingMode = _math_rnd; r.s = f32_div(pi.s, two.s);
+      softfloat_roundingMode = rnd; r.s = f32_div(pi.s, two.s);
       softfloat_roundingMode = softfloat_round_near_even; return r.s;
     }
     if ( (xb.c == 0) && f32_lt(y, zero.s) ) {                      // x==+0,y<0: mul(-1,div(pi,2))
-      softfloat_roundingMode = _math_rnd;
+      softfloat_roundingMode = rnd;
       r.s = f32_mul(mone.s, f32_div(pi.s, two.s));
       softfloat_roundingMode = softfloat_round_near_even; return r.s;
     }
@@ -942,25 +1026,25 @@ typedef int64_t  c3_ds;
   }
 
 /* @rs pow/pow-n -- math.hoon ++rs ++pow/++pow-n */
-  static float32_t _rs_pow_n(float32_t x, float32_t n) {
+  static float32_t _rs_pow_n(float32_t x, float32_t n, int rnd) {
     union sing nn, p, one, two;
     one.c = 0x3f800000U; two.c = 0x40000000U;
     nn.s = n;
     if ( nn.c == 0 ) return one.s;                 // n == +0 -> 1
-    softfloat_roundingMode = _math_rnd;            // bare mul/sub round per door r
+    softfloat_roundingMode = rnd;            // bare mul/sub round per door r
     p.s = x;
     while ( !f32_lt(n, two.s) ) { p.s = f32_mul(p.s, x); n = f32_sub(n, one.s); }
     softfloat_roundingMode = softfloat_round_near_even;
     return p.s;
   }
-  static float32_t _rs_pow(float32_t x, float32_t n) {
+  static float32_t _rs_pow(float32_t x, float32_t n, int rnd) {
     union sing nn, ni, zero, lg, prod;
     zero.c = 0; nn.s = n;
     ni.s = i32_to_f32(f32_to_i32(n, softfloat_round_near_even, 0));   // san (need (toi n)) (mode-indep)
     if ( (nn.c == ni.c) && f32_lt(zero.s, n) )                        // positive integer
-      return _rs_pow_n(x, ni.s);
+      return _rs_pow_n(x, ni.s, rnd);
     lg.s = _rs_log(x);                                               // %n kernel
-    softfloat_roundingMode = _math_rnd;                             // bare mul per door r
+    softfloat_roundingMode = rnd;                             // bare mul per door r
     prod.s = f32_mul(n, lg.s);
     softfloat_roundingMode = softfloat_round_near_even;
     return _rs_exp(prod.s);                                          // %n kernel: exp(n*log x)
@@ -968,13 +1052,14 @@ typedef int64_t  c3_ds;
 
 /* ===================================================================
 ** @rh (half-precision) cores -- math.hoon ++rh.  NATIVE f16: each core
-** computes entirely in half-precision (SoftFloat f16 ops), mirroring the
-** native Hoon arms op-for-op -- NOT widen-to-f32-and-narrow.  Same reductions
+** computes entirely in half-precision, rounding to f16 after every op and
+** mirroring the native Hoon arms op-for-op -- NOT widen-to-f32-and-narrow
+** across a whole kernel (single base ops may go via f32, see _rh_fadd).  Same reductions
 ** and Horner order as @rd/@rs but with the f16 minimax coeffs read from the
 ** Hoon (lower polynomial degrees: sin/cos/atan/ainv are shorter, ainv has no
 ** denominator, acos has no tiny branch).  Marshalling is chub-based (low 16
 ** bits), so word-size-agnostic like @rd/@rs.  Kernels round near-even; the
-** composites (tan/atan2/pow/pow-n) honor the door's r via _math_rnd.
+** composites (tan/atan2/pow/pow-n) honor the door's r, passed as rnd.
 ** =================================================================== */
 
   union half {
@@ -987,8 +1072,78 @@ typedef int64_t  c3_ds;
   static const uint16_t _RH_NINF = 0xfc00U;
 
   static inline union half _rh_bits(uint16_t b) { union half u; u.c = b; return u; }
+
+/* @rh base ops.  Where the build evaluates float at its own precision, each
+** f16 add/sub/mul/div/sqrt is done in binary32 and narrowed once: 24 bits is
+** at least 2*11+2, so the double rounding is harmless and, at near-even, the
+** bits equal SoftFloat's f16 op (the cores still round to f16 after every
+** op, exactly as the Hoon does).  Widening is exact and narrowing is an
+** integer RNE.  Directed modes (a composite's door op at rnd), a host FPU not
+** at nearest, and NaN results (payloads are specialization-defined) use
+** SoftFloat.  -DMATH_NO_NATIVE compiles the path out.
+*/
+#if !defined(MATH_NO_NATIVE) && !defined(__FAST_MATH__) && \
+    defined(FLT_EVAL_METHOD) && (0 == FLT_EVAL_METHOD)
+#  define _RH_NATIVE
+#endif
+
+#ifdef _RH_NATIVE
+  static inline float _rh_widen(float16_t a) {
+    union half h; h.h = a;
+    uint32_t s = (uint32_t)(h.c & 0x8000) << 16, e = (h.c >> 10) & 0x1f, m = h.c & 0x3ff, u;
+    float f;
+    if ( e == 0x1f )    u = s | 0x7f800000 | (m << 13);                  // inf/NaN
+    else if ( e != 0 )  u = s | ((e + 112) << 23) | (m << 13);           // normal
+    else { f = (float)m * 0x1p-24f; memcpy(&u, &f, 4); u |= s; }         // subnormal, exact
+    memcpy(&f, &u, 4);
+    return f;
+  }
+  //  f (not NaN) -> nearest-even f16
+  static inline float16_t _rh_narrow(float f) {
+    uint32_t u, a; memcpy(&u, &f, 4);
+    union half h;
+    uint16_t s = (u >> 16) & 0x8000;
+    a = u & 0x7fffffff;
+    if ( a >= 0x477ff000 )      h.c = s | 0x7c00;                        // >= 65520 -> inf
+    else if ( a >= 0x38800000 ) h.c = s | ((a + 0xfff + ((a >> 13) & 1) - 0x38000000) >> 13);
+    else {                                                               // subnormal: FPU rounds
+      memcpy(&f, &a, 4); f += 0.5f; memcpy(&a, &f, 4);                   // onto the 2^-24 grid
+      h.c = s | (uint16_t)(a - 0x3f000000);
+    }
+    return h.h;
+  }
+  static inline int _rh_fpu(void) {
+    return (softfloat_roundingMode == softfloat_round_near_even) &&
+           (FE_TONEAREST == fegetround());
+  }
+#  define _RH_OP2(nam, op, sf)                                             \
+  static inline float16_t nam(float16_t a, float16_t b) {                  \
+    if ( _rh_fpu() ) {                                                     \
+      float r = _rh_widen(a) op _rh_widen(b);                              \
+      if ( r == r ) return _rh_narrow(r);                                  \
+    }                                                                      \
+    return sf(a, b);                                                       \
+  }
+  _RH_OP2(_rh_fadd, +, f16_add)
+  _RH_OP2(_rh_fsub, -, f16_sub)
+  _RH_OP2(_rh_fmul, *, f16_mul)
+  _RH_OP2(_rh_fdiv, /, f16_div)
+  static inline float16_t _rh_fsqrt(float16_t a) {
+    if ( _rh_fpu() ) {
+      float r = sqrtf(_rh_widen(a));
+      if ( r == r ) return _rh_narrow(r);
+    }
+    return f16_sqrt(a);
+  }
+#else
+#  define _rh_fadd  f16_add
+#  define _rh_fsub  f16_sub
+#  define _rh_fmul  f16_mul
+#  define _rh_fdiv  f16_div
+#  define _rh_fsqrt f16_sqrt
+#endif
   static inline float16_t  _rh_neg(float16_t a) {            // (sub .0 a)
-    union half z; z.c = 0; return f16_sub(z.h, a);
+    union half z; z.c = 0; return _rh_fsub(z.h, a);
   }
 
 /* @rh exp -- math.hoon ++rh ++exp
@@ -1002,12 +1157,12 @@ typedef int64_t  c3_ds;
   //  scale2: ldexp with overflow/subnormal tails (math.hoon ++rh ++exp)
   static inline float16_t _rh_scale2(float16_t p, c3_ds k) {
     if ( (k - 16) >= 0 ) {                             // k>=16
-      return f16_mul(f16_mul(p, _rh_pow2(15)), _rh_pow2(k - 15));
+      return _rh_fmul(_rh_fmul(p, _rh_pow2(15)), _rh_pow2(k - 15));
     }
     if ( !((k + 14) >= 0) ) {                          // k<-14
-      return f16_mul(f16_mul(p, _rh_pow2(k + 11)), _rh_pow2(-11));
+      return _rh_fmul(_rh_fmul(p, _rh_pow2(k + 11)), _rh_pow2(-11));
     }
-    return f16_mul(p, _rh_pow2(k));
+    return _rh_fmul(p, _rh_pow2(k));
   }
   static float16_t _rh_exp(float16_t x) {
     union half r0;
@@ -1021,18 +1176,18 @@ typedef int64_t  c3_ds;
 
     log2e.c = 0x3dc5; ln2hi.c = 0x3980; ln2lo.c = 0x1dc8;
 
-    c3_ds k = (c3_ds)f16_to_i32(f16_mul(x, log2e.h), softfloat_round_near_even, 0);
+    c3_ds k = (c3_ds)f16_to_i32(_rh_fmul(x, log2e.h), softfloat_round_near_even, 0);
     if ( (k - 17) >= 0 )    { r0.c = _RH_PINF; return r0.h; }   // overflow -> inf
     if ( !((k + 24) >= 0) ) { r0.c = 0; return r0.h; }          // underflow -> 0
 
     ka.h = ui32_to_f16( (uint32_t)(k < 0 ? -k : k) );
-    kf.h = (k >= 0) ? ka.h : f16_sub(zero.h, ka.h);
-    rr.h = f16_sub( f16_sub(x, f16_mul(kf.h, ln2hi.h)), f16_mul(kf.h, ln2lo.h) );
+    kf.h = (k >= 0) ? ka.h : _rh_fsub(zero.h, ka.h);
+    rr.h = _rh_fsub( _rh_fsub(x, _rh_fmul(kf.h, ln2hi.h)), _rh_fmul(kf.h, ln2lo.h) );
 
     p.c = 0;
     for ( int i = 5; i-- != 0; ) {        // Horner over flop(cs): c4..c0
       c.c = cs[i];
-      p.h = f16_add(f16_mul(p.h, rr.h), c.h);
+      p.h = _rh_fadd(_rh_fmul(p.h, rr.h), c.h);
     }
     return _rh_scale2(p.h, k);
   }
@@ -1046,47 +1201,49 @@ typedef int64_t  c3_ds;
   static float16_t _rh_ksin(float16_t xx, float16_t yy) {
     union half z, r, v, aa, bb, dd, c, half;
     half.c = 0x3800;
-    z.h = f16_mul(xx, xx);
+    z.h = _rh_fmul(xx, xx);
     r.c = 0;                            // Horner over flop(tail sc): sc[1]
-    for ( int i = 2; i-- != 1; ) { c.c = _RH_SC[i]; r.h = f16_add(f16_mul(r.h, z.h), c.h); }
-    v.h = f16_mul(z.h, xx);
-    aa.h = f16_sub(f16_mul(half.h, yy), f16_mul(v.h, r.h));
-    bb.h = f16_sub(f16_mul(z.h, aa.h), yy);
-    dd.h = f16_sub(bb.h, f16_mul(v.h, _rh_bits(_RH_SC[0]).h));
-    return f16_sub(xx, dd.h);
+    for ( int i = 2; i-- != 1; ) { c.c = _RH_SC[i]; r.h = _rh_fadd(_rh_fmul(r.h, z.h), c.h); }
+    v.h = _rh_fmul(z.h, xx);
+    aa.h = _rh_fsub(_rh_fmul(half.h, yy), _rh_fmul(v.h, r.h));
+    bb.h = _rh_fsub(_rh_fmul(z.h, aa.h), yy);
+    dd.h = _rh_fsub(bb.h, _rh_fmul(v.h, _rh_bits(_RH_SC[0]).h));
+    return _rh_fsub(xx, dd.h);
   }
   static float16_t _rh_kcos(float16_t xx, float16_t yy) {
     union half z, rc, hz, w2, aa, bb, c, half, one;
     half.c = 0x3800; one.c = 0x3c00;
-    z.h = f16_mul(xx, xx);
+    z.h = _rh_fmul(xx, xx);
     rc.c = 0;                          // Horner over flop(cc): cc[1..0]
-    for ( int i = 2; i-- != 0; ) { c.c = _RH_CC[i]; rc.h = f16_add(f16_mul(rc.h, z.h), c.h); }
-    hz.h = f16_mul(half.h, z.h);
-    w2.h = f16_sub(one.h, hz.h);
-    aa.h = f16_sub(f16_sub(one.h, w2.h), hz.h);
-    bb.h = f16_sub(f16_mul(f16_mul(z.h, z.h), rc.h), f16_mul(xx, yy));
-    return f16_add(w2.h, f16_add(aa.h, bb.h));
-  }
-  //  trig-fin: is_sin ? sin(x) : cos(x); ax=|x|, sb=sign bit
-  static float16_t _rh_trigfin(int is_sin, float16_t ax, uint16_t sb) {
+    for ( int i = 2; i-- != 0; ) { c.c = _RH_CC[i]; rc.h = _rh_fadd(_rh_fmul(rc.h, z.h), c.h); }
+    hz.h = _rh_fmul(half.h, z.h);
+    w2.h = _rh_fsub(one.h, hz.h);
+    aa.h = _rh_fsub(_rh_fsub(one.h, w2.h), hz.h);
+    bb.h = _rh_fsub(_rh_fmul(_rh_fmul(z.h, z.h), rc.h), _rh_fmul(xx, yy));
+    return _rh_fadd(w2.h, _rh_fadd(aa.h, bb.h));
+  }
+  //  trig-sc: sin(x) -> *s, cos(x) -> *c off one reduction; ax=|x|, sb=sign bit
+  static void _rh_trigsc(float16_t ax, uint16_t sb, float16_t* s, float16_t* c) {
     union half qf, r1, r2, w, rhi, rlo, ks, kc, v;
-    c3_ds q = (c3_ds)f16_to_i32(f16_mul(ax, _rh_bits(0x3918).h),
+    c3_ds q = (c3_ds)f16_to_i32(_rh_fmul(ax, _rh_bits(0x3918).h),
                                 softfloat_round_near_even, 0);          // round(ax*2/pi)
     c3_d  aq = (c3_d)(q < 0 ? -q : q);
     qf.h = ui32_to_f16((uint32_t)aq);
-    r1.h = f16_sub(ax, f16_mul(qf.h, _rh_bits(0x3e00).h));             // ax - qf*pio2_1
-    r2.h = f16_sub(r1.h, f16_mul(qf.h, _rh_bits(0x2c80).h));           // r1 - qf*pio2_2
-    w.h = f16_mul(qf.h, _rh_bits(0x0fed).h);                           // qf*pio2_3
-    rhi.h = f16_sub(r2.h, w.h);
-    rlo.h = f16_sub(f16_sub(r2.h, rhi.h), w.h);
+    r1.h = _rh_fsub(ax, _rh_fmul(qf.h, _rh_bits(0x3e00).h));             // ax - qf*pio2_1
+    r2.h = _rh_fsub(r1.h, _rh_fmul(qf.h, _rh_bits(0x2c80).h));           // r1 - qf*pio2_2
+    w.h = _rh_fmul(qf.h, _rh_bits(0x0fed).h);                           // qf*pio2_3
+    rhi.h = _rh_fsub(r2.h, w.h);
+    rlo.h = _rh_fsub(_rh_fsub(r2.h, rhi.h), w.h);
     int m = (int)(aq & 3);
     ks.h = _rh_ksin(rhi.h, rlo.h);
     kc.h = _rh_kcos(rhi.h, rlo.h);
-    if ( is_sin ) {
-      v.h = (m==0) ? ks.h : (m==1) ? kc.h : (m==2) ? _rh_neg(ks.h) : _rh_neg(kc.h);
-      return (sb == 1) ? _rh_neg(v.h) : v.h;
-    }
-    return (m==0) ? kc.h : (m==1) ? _rh_neg(ks.h) : (m==2) ? _rh_neg(kc.h) : ks.h;
+    v.h = (m==0) ? ks.h : (m==1) ? kc.h : (m==2) ? _rh_neg(ks.h) : _rh_neg(kc.h);
+    *s = (sb == 1) ? _rh_neg(v.h) : v.h;
+    *c = (m==0) ? kc.h : (m==1) ? _rh_neg(ks.h) : (m==2) ? _rh_neg(kc.h) : ks.h;
+  }
+  //  trig-fin: is_sin ? sin(x) : cos(x)
+  static float16_t _rh_trigfin(int is_sin, float16_t ax, uint16_t sb) {
+    float16_t s, c; _rh_trigsc(ax, sb, &s, &c); return is_sin ? s : c;
   }
   static float16_t _rh_sin(float16_t x) {
     union half r0, ax;
@@ -1105,18 +1262,29 @@ typedef int64_t  c3_ds;
     ax.c = r0.c & 0x7fffU;
     return _rh_trigfin(0, ax.h, 0);
   }
+  //  sincos: sin and cos off one reduction, bit-identical to the pair
+  static void _rh_sincos(float16_t x, float16_t* s, float16_t* c) {
+    union half r0, ax;
+    r0.h = x;
+    if ( !f16_eq(x, x) || (r0.c == _RH_PINF)||(r0.c == _RH_NINF) ) {       // NaN, +-inf -> NaN
+      r0.c = _RH_QNAN; *s = *c = r0.h; return;
+    }
+    ax.c = r0.c & 0x7fffU;
+    _rh_trigsc(ax.h, r0.c >> 15, s, c);
+    if ( (r0.c == 0)||(r0.c == 0x8000U) ) { *s = x; }                      // sin +-0 -> +-0
+  }
   //  tan = (div (sin x) (cos x)): sin/cos kernels %n, the bare div per door r
-  static float16_t _rh_tan(float16_t x) {
+  static float16_t _rh_tan(float16_t x, int rnd) {
     float16_t s = _rh_sin(x), c = _rh_cos(x);
-    softfloat_roundingMode = _math_rnd;
-    float16_t r = f16_div(s, c);
+    softfloat_roundingMode = rnd;
+    float16_t r = _rh_fdiv(s, c);
     softfloat_roundingMode = softfloat_round_near_even;
     return r;
   }
 
 /* @rh sqt -- math.hoon ++rh ++sqt = (sqt:^rh x): correctly-rounded f16 sqrt. */
   static float16_t _rh_sqt(float16_t x) {
-    union half r; r.h = f16_sqrt(x);
+    union half r; r.h = _rh_fsqrt(x);
     if ( !f16_eq(r.h, r.h) ) r.c = _RH_QNAN;        // _nan_unify
     return r.h;
   }
@@ -1131,20 +1299,20 @@ typedef int64_t  c3_ds;
     one.c = 0x3c00; half.c = 0x3800;
     xb.h = x;
     int sub = (((xb.c >> 10) & 0x1fU) == 0);
-    if ( sub ) xb.h = f16_mul(x, _rh_bits(0x6400).h);         // *2^10
+    if ( sub ) xb.h = _rh_fmul(x, _rh_bits(0x6400).h);         // *2^10
     int32_t ae = sub ? -10 : 0;
     int32_t e = (int32_t)((xb.c >> 10) & 0x1fU) - 15;
     m.c = (xb.c & 0x3ffU) | 0x3c00U;
     if ( !f16_lt(m.h, _rh_bits(0x3da8).h) ) {                // m >= sqrt(2)
-      m.h = f16_mul(m.h, half.h); e += 1;
+      m.h = _rh_fmul(m.h, half.h); e += 1;
     }
     e += ae;
-    f.h = f16_sub(m.h, one.h);
-    s.h = f16_div(f.h, f16_add(m.h, one.h));
-    z.h = f16_mul(s.h, s.h);
-    p2.c = 0; for ( int i = 2; i-- != 0; ) { c.c = cs[i]; p2.h = f16_add(f16_mul(p2.h, z.h), c.h); }
-    r.h = f16_mul(f16_add(z.h, z.h), p2.h);
-    ll.h = f16_sub(f.h, f16_mul(s.h, f16_sub(f.h, r.h)));
+    f.h = _rh_fsub(m.h, one.h);
+    s.h = _rh_fdiv(f.h, _rh_fadd(m.h, one.h));
+    z.h = _rh_fmul(s.h, s.h);
+    p2.c = 0; for ( int i = 2; i-- != 0; ) { c.c = cs[i]; p2.h = _rh_fadd(_rh_fmul(p2.h, z.h), c.h); }
+    r.h = _rh_fmul(_rh_fadd(z.h, z.h), p2.h);
+    ll.h = _rh_fsub(f.h, _rh_fmul(s.h, _rh_fsub(f.h, r.h)));
     efa.h = ui32_to_f16((uint32_t)(e < 0 ? -e : e));
     *ef = (e >= 0) ? efa.h : _rh_neg(efa.h);
     *l1 = ll.h;
@@ -1162,22 +1330,22 @@ typedef int64_t  c3_ds;
     union half g, ef, l1, hi, lo;
     if ( _rh_log_guard(x, &g.h) ) return g.h;
     _rh_lr(x, &ef.h, &l1.h);
-    hi.h = f16_mul(ef.h, _rh_bits(0x3980).h);                // e*ln2hi
-    lo.h = f16_mul(ef.h, _rh_bits(0x1dc8).h);                // e*ln2lo
-    return f16_add(hi.h, f16_add(l1.h, lo.h));
+    hi.h = _rh_fmul(ef.h, _rh_bits(0x3980).h);                // e*ln2hi
+    lo.h = _rh_fmul(ef.h, _rh_bits(0x1dc8).h);                // e*ln2lo
+    return _rh_fadd(hi.h, _rh_fadd(l1.h, lo.h));
   }
   static float16_t _rh_log2(float16_t x) {
     union half g, ef, l1;
     if ( _rh_log_guard(x, &g.h) ) return g.h;
     _rh_lr(x, &ef.h, &l1.h);
-    return f16_add(ef.h, f16_mul(l1.h, _rh_bits(0x3dc5).h));  // e + lm/ln2
+    return _rh_fadd(ef.h, _rh_fmul(l1.h, _rh_bits(0x3dc5).h));  // e + lm/ln2
   }
   static float16_t _rh_log10(float16_t x) {
     union half g, ef, l1;
     if ( _rh_log_guard(x, &g.h) ) return g.h;
     _rh_lr(x, &ef.h, &l1.h);
-    return f16_add(f16_mul(ef.h, _rh_bits(0x34d1).h),         // e*log10(2)
-                   f16_mul(l1.h, _rh_bits(0x36f3).h));        // + lm/ln10
+    return _rh_fadd(_rh_fmul(ef.h, _rh_bits(0x34d1).h),         // e*log10(2)
+                   _rh_fmul(l1.h, _rh_bits(0x36f3).h));        // + lm/ln10
   }
 
 /* @rh cbt -- math.hoon ++rh ++cbt = sign(x) * exp(log|x| / 3). */
@@ -1187,7 +1355,7 @@ typedef int64_t  c3_ds;
     if ( !f16_eq(x, x) )                   { return x; }                          // NaN
     if ( (r0.c == 0)||(r0.c == 0x8000U) )  { return x; }                          // +-0
     ax.c = r0.c & 0x7fffU;
-    r.h = _rh_exp(f16_mul(_rh_log(ax.h), _rh_bits(0x3555).h));                    // exp(log|x|/3)
+    r.h = _rh_exp(_rh_fmul(_rh_log(ax.h), _rh_bits(0x3555).h));                    // exp(log|x|/3)
     return ((r0.c >> 15) == 1) ? _rh_neg(r.h) : r.h;
   }
 
@@ -1198,8 +1366,8 @@ typedef int64_t  c3_ds;
   static float16_t _rh_ainv_rr(float16_t t) {
     static const uint16_t ps[4] = { 0x3155, 0x2cea, 0x2729, 0x2ccc };
     union half pp, c;
-    pp.c = 0; for ( int i = 4; i-- != 0; ) { c.c = ps[i]; pp.h = f16_add(f16_mul(pp.h, t), c.h); }
-    return f16_mul(t, pp.h);
+    pp.c = 0; for ( int i = 4; i-- != 0; ) { c.c = ps[i]; pp.h = _rh_fadd(_rh_fmul(pp.h, t), c.h); }
+    return _rh_fmul(t, pp.h);
   }
   static float16_t _rh_asin(float16_t x) {
     union half r0, ax, t, w, r, s, res, half, one, two, pio2h, pio2l, pio4, nr1;
@@ -1211,26 +1379,26 @@ typedef int64_t  c3_ds;
     ax.c = r0.c & 0x7fffU;
     if ( f16_lt(one.h, ax.h) ) { r0.c = _RH_QNAN; return r0.h; }   // |x|>1 -> NaN
     if ( ax.c == one.c )                                          // |x|==1
-      return f16_add(f16_mul(x, pio2h.h), f16_mul(x, pio2l.h));
+      return _rh_fadd(_rh_fmul(x, pio2h.h), _rh_fmul(x, pio2l.h));
     if ( f16_lt(ax.h, half.h) ) {                                // |x|<0.5
       if ( f16_lt(ax.h, _rh_bits(0x0c00).h) ) return x;           // |x|<2^-12 -> x
-      t.h = f16_mul(x, x);
-      return f16_add(x, f16_mul(x, _rh_ainv_rr(t.h)));
+      t.h = _rh_fmul(x, x);
+      return _rh_fadd(x, _rh_fmul(x, _rh_ainv_rr(t.h)));
     }
-    w.h = f16_sub(one.h, ax.h);
-    t.h = f16_mul(w.h, half.h);
+    w.h = _rh_fsub(one.h, ax.h);
+    t.h = _rh_fmul(w.h, half.h);
     r.h = _rh_ainv_rr(t.h);
-    s.h = f16_sqrt(t.h);
+    s.h = _rh_fsqrt(t.h);
     if ( f16_le(nr1.h, ax.h) ) {                                // |x|>=0.975
-      res.h = f16_sub(pio2h.h, f16_mul(two.h, f16_add(s.h, f16_mul(s.h, r.h))));
+      res.h = _rh_fsub(pio2h.h, _rh_fmul(two.h, _rh_fadd(s.h, _rh_fmul(s.h, r.h))));
       return (sgn == 1) ? _rh_neg(res.h) : res.h;
     }
     { union half df, cc, p2, q2;
       df.c = s.c & 0xfff0U;
-      cc.h = f16_div(f16_sub(t.h, f16_mul(df.h, df.h)), f16_add(s.h, df.h));
-      p2.h = f16_sub(f16_mul(two.h, f16_mul(s.h, r.h)), f16_sub(pio2l.h, f16_mul(two.h, cc.h)));
-      q2.h = f16_sub(pio4.h, f16_mul(two.h, df.h));
-      res.h = f16_sub(pio4.h, f16_sub(p2.h, q2.h));
+      cc.h = _rh_fdiv(_rh_fsub(t.h, _rh_fmul(df.h, df.h)), _rh_fadd(s.h, df.h));
+      p2.h = _rh_fsub(_rh_fmul(two.h, _rh_fmul(s.h, r.h)), _rh_fsub(pio2l.h, _rh_fmul(two.h, cc.h)));
+      q2.h = _rh_fsub(pio4.h, _rh_fmul(two.h, df.h));
+      res.h = _rh_fsub(pio4.h, _rh_fsub(p2.h, q2.h));
       return (sgn == 1) ? _rh_neg(res.h) : res.h;
     }
   }
@@ -1245,24 +1413,24 @@ typedef int64_t  c3_ds;
     if ( f16_lt(one.h, ax.h) ) { r0.c = _RH_QNAN; return r0.h; }   // |x|>1 -> NaN
     if ( ax.c == one.c ) {                                        // |x|==1
       if ( neg == 0 ) { union half z0; z0.c = 0; return z0.h; }    // 1 -> 0
-      return f16_add(pih.h, f16_mul(two.h, pio2l.h));              // -1 -> pi
+      return _rh_fadd(pih.h, _rh_fmul(two.h, pio2l.h));              // -1 -> pi
     }
     if ( f16_lt(ax.h, half.h) ) {                                // |x|<0.5
-      z.h = f16_mul(x, x);
+      z.h = _rh_fmul(x, x);
       r.h = _rh_ainv_rr(z.h);
-      return f16_sub(pio2h.h, f16_sub(x, f16_sub(pio2l.h, f16_mul(x, r.h))));
+      return _rh_fsub(pio2h.h, _rh_fsub(x, _rh_fsub(pio2l.h, _rh_fmul(x, r.h))));
     }
     if ( neg == 1 ) {                                            // x <= -0.5
-      z.h = f16_mul(f16_add(one.h, x), half.h);
-      s.h = f16_sqrt(z.h);
+      z.h = _rh_fmul(_rh_fadd(one.h, x), half.h);
+      s.h = _rh_fsqrt(z.h);
       r.h = _rh_ainv_rr(z.h);
-      w.h = f16_sub(f16_mul(r.h, s.h), pio2l.h);
-      return f16_sub(pih.h, f16_mul(two.h, f16_add(s.h, w.h)));
+      w.h = _rh_fsub(_rh_fmul(r.h, s.h), pio2l.h);
+      return _rh_fsub(pih.h, _rh_fmul(two.h, _rh_fadd(s.h, w.h)));
     }
-    z.h = f16_mul(f16_sub(one.h, x), half.h);                    // x >= 0.5
-    s.h = f16_sqrt(z.h);
+    z.h = _rh_fmul(_rh_fsub(one.h, x), half.h);                    // x >= 0.5
+    s.h = _rh_fsqrt(z.h);
     r.h = _rh_ainv_rr(z.h);
-    return f16_mul(two.h, f16_add(s.h, f16_mul(s.h, r.h)));
+    return _rh_fmul(two.h, _rh_fadd(s.h, _rh_fmul(s.h, r.h)));
   }
 
 /* @rh atan/atan2 -- math.hoon ++rh ++atan/++rh-atan/++atan2
@@ -1283,89 +1451,162 @@ typedef int64_t  c3_ds;
     if ( f16_lt(ax.h, _rh_bits(0x3700).h) ) {                     // |x| < 7/16
       xr.h = ax.h; hi.c = 0; lo.c = 0; dir = 1;
     } else if ( f16_lt(ax.h, _rh_bits(0x3980).h) ) {              // < 11/16
-      xr.h = f16_div(f16_sub(f16_add(ax.h, ax.h), one.h), f16_add(two.h, ax.h));
+      xr.h = _rh_fdiv(_rh_fsub(_rh_fadd(ax.h, ax.h), one.h), _rh_fadd(two.h, ax.h));
       hi.c = 0x376b; lo.c = 0x019c;                               // atan(0.5)
     } else if ( f16_lt(ax.h, _rh_bits(0x3cc0).h) ) {              // < 19/16
-      xr.h = f16_div(f16_sub(ax.h, one.h), f16_add(ax.h, one.h));
+      xr.h = _rh_fdiv(_rh_fsub(ax.h, one.h), _rh_fadd(ax.h, one.h));
       hi.c = 0x3a48; lo.c = 0x0bed;                               // pi/4
     } else if ( f16_lt(ax.h, _rh_bits(0x40e0).h) ) {              // < 39/16
-      xr.h = f16_div(f16_sub(ax.h, ohf.h), f16_add(one.h, f16_mul(ohf.h, ax.h)));
+      xr.h = _rh_fdiv(_rh_fsub(ax.h, ohf.h), _rh_fadd(one.h, _rh_fmul(ohf.h, ax.h)));
       hi.c = 0x3bdd; lo.c = 0x87a1;                               // atan(1.5)
     } else {                                                       // -1/x
-      xr.h = f16_div(_rh_bits(0xbc00).h, ax.h);
+      xr.h = _rh_fdiv(_rh_bits(0xbc00).h, ax.h);
       hi.c = 0x3e48; lo.c = 0x0fed;                               // pi/2
     }
-    z.h = f16_mul(xr.h, xr.h);
-    sp.c = 0; for ( int i = 3; i-- != 0; ) { c.c = at[i]; sp.h = f16_add(f16_mul(sp.h, z.h), c.h); }
-    s.h = f16_mul(z.h, sp.h);
-    if ( dir ) res.h = f16_sub(xr.h, f16_mul(xr.h, s.h));
-    else       res.h = f16_sub(hi.h, f16_sub(f16_sub(f16_mul(xr.h, s.h), lo.h), xr.h));
+    z.h = _rh_fmul(xr.h, xr.h);
+    sp.c = 0; for ( int i = 3; i-- != 0; ) { c.c = at[i]; sp.h = _rh_fadd(_rh_fmul(sp.h, z.h), c.h); }
+    s.h = _rh_fmul(z.h, sp.h);
+    if ( dir ) res.h = _rh_fsub(xr.h, _rh_fmul(xr.h, s.h));
+    else       res.h = _rh_fsub(hi.h, _rh_fsub(_rh_fsub(_rh_fmul(xr.h, s.h), lo.h), xr.h));
     return (neg == 1) ? _rh_neg(res.h) : res.h;
   }
-  //  bare door ops (div/add/sub/mul) round per _math_rnd; atan kernel is %n.
-  static float16_t _rh_atan2(float16_t y, float16_t x) {
+  //  bare door ops (div/add/sub/mul) round per rnd; atan kernel is %n.
+  static float16_t _rh_atan2(float16_t y, float16_t x, int rnd) {
     union half xb, pi, two, zero, mone, q, a, r;
     zero.c = 0; pi.c = 0x4248; two.c = 0x4000; mone.c = 0xbc00;
     xb.h = x;
     if ( f16_lt(zero.h, x) ) {                                     // x>0: atan(div y x)
-      softfloat_roundingMode = _math_rnd; q.h = f16_div(y, x);
+      softfloat_roundingMode = rnd; q.h = _rh_fdiv(y, x);
       softfloat_roundingMode = softfloat_round_near_even; return _rh_atan(q.h);
     }
     if ( f16_lt(x, zero.h) && f16_le(zero.h, y) ) {                // x<0,y>=0: add(atan,pi)
-      softfloat_roundingMode = _math_rnd; q.h = f16_div(y, x);
+      softfloat_roundingMode = rnd; q.h = _rh_fdiv(y, x);
       softfloat_roundingMode = softfloat_round_near_even; a.h = _rh_atan(q.h);
-      softfloat_roundingMode = _math_rnd; r.h = f16_add(a.h, pi.h);
+      softfloat_roundingMode = rnd; r.h = _rh_fadd(a.h, pi.h);
       softfloat_roundingMode = softfloat_round_near_even; return r.h;
     }
     if ( f16_lt(x, zero.h) && f16_lt(y, zero.h) ) {                // x<0,y<0: sub(atan,pi)
-      softfloat_roundingMode = _math_rnd; q.h = f16_div(y, x);
+      softfloat_roundingMode = rnd; q.h = _rh_fdiv(y, x);
       softfloat_roundingMode = softfloat_round_near_even; a.h = _rh_atan(q.h);
-      softfloat_roundingMode = _math_rnd; r.h = f16_sub(a.h, pi.h);
+      softfloat_roundingMode = rnd; r.h = _rh_fsub(a.h, pi.h);
       softfloat_roundingMode = softfloat_round_near_even; return r.h;
     }
     if ( (xb.c == 0) && f16_lt(zero.h, y) ) {                      // x==+0,y>0: div(pi,2)
-      softfloat_roundingMode = _math_rnd; r.h = f16_div(pi.h, two.h);
+      softfloat_roundingMode = rnd; r.h = _rh_fdiv(pi.h, two.h);
       softfloat_roundingMode = softfloat_round_near_even; return r.h;
     }
     if ( (xb.c == 0) && f16_lt(y, zero.h) ) {                      // x==+0,y<0: mul(-1,div(pi,2))
-      softfloat_roundingMode = _math_rnd;
-      r.h = f16_mul(mone.h, f16_div(pi.h, two.h));
+      softfloat_roundingMode = rnd;
+      r.h = _rh_fmul(mone.h, _rh_fdiv(pi.h, two.h));
       softfloat_roundingMode = softfloat_round_near_even; return r.h;
     }
     return zero.h;
   }
 
 /* @rh pow/pow-n -- math.hoon ++rh ++pow/++pow-n */
-  static float16_t _rh_pow_n(float16_t x, float16_t n) {
+  static float16_t _rh_pow_n(float16_t x, float16_t n, int rnd) {
     union half nn, p, one, two;
     one.c = 0x3c00; two.c = 0x4000;
     nn.h = n;
     if ( nn.c == 0 ) return one.h;                 // n == +0 -> 1
-    softfloat_roundingMode = _math_rnd;            // bare mul/sub round per door r
+    softfloat_roundingMode = rnd;            // bare mul/sub round per door r
     p.h = x;
-    while ( !f16_lt(n, two.h) ) { p.h = f16_mul(p.h, x); n = f16_sub(n, one.h); }
+    while ( !f16_lt(n, two.h) ) { p.h = _rh_fmul(p.h, x); n = _rh_fsub(n, one.h); }
     softfloat_roundingMode = softfloat_round_near_even;
     return p.h;
   }
-  static float16_t _rh_pow(float16_t x, float16_t n) {
+  static float16_t _rh_pow(float16_t x, float16_t n, int rnd) {
     union half nn, ni, zero, lg, prod;
     zero.c = 0; nn.h = n;
     ni.h = i32_to_f16(f16_to_i32(n, softfloat_round_near_even, 0));   // san (need (toi n))
     if ( (nn.c == ni.c) && f16_lt(zero.h, n) )                        // positive integer
-      return _rh_pow_n(x, ni.h);
+      return _rh_pow_n(x, ni.h, rnd);
     lg.h = _rh_log(x);                                               // %n kernel
-    softfloat_roundingMode = _math_rnd;                             // bare mul per door r
-    prod.h = f16_mul(n, lg.h);
+    softfloat_roundingMode = rnd;                             // bare mul per door r
+    prod.h = _rh_fmul(n, lg.h);
     softfloat_roundingMode = softfloat_round_near_even;
     return _rh_exp(prod.h);                                          // %n kernel: exp(n*log x)
   }
 
+/* @rh lookup tables.  @rh has only 2^16 inputs, so each unary arm is
+** tabulated whole (128 KiB) the first time it is called, from the kernel
+** above at near-even; after that a call is one load.  tan rounds its bare
+** div per the door's r, so it gets a table per mode.  The kernels stay the
+** reference: rh_check diffs every table against them over the full domain.
+** If a table can't be allocated the kernel runs instead.  Tables are
+** published with a compare-and-swap, so two threads racing to build the
+** same one just waste a build.  -DMATH_NO_RH_TABLES compiles them out.
+*/
+  static float16_t _rh_tan_n(float16_t x) { return _rh_tan(x, softfloat_round_near_even); }
+  static float16_t _rh_tan_u(float16_t x) { return _rh_tan(x, softfloat_round_max); }
+  static float16_t _rh_tan_d(float16_t x) { return _rh_tan(x, softfloat_round_min); }
+  static float16_t _rh_tan_z(float16_t x) { return _rh_tan(x, softfloat_round_minMag); }
+
+  typedef enum {
+    _rh_t_exp,   _rh_t_log,   _rh_t_log2,  _rh_t_log10,
+    _rh_t_sin,   _rh_t_cos,   _rh_t_atan,  _rh_t_asin,
+    _rh_t_acos,  _rh_t_sqt,   _rh_t_cbt,
+    _rh_t_tan_n, _rh_t_tan_u, _rh_t_tan_d, _rh_t_tan_z,
+    _rh_t_max
+  } _rh_t;
+
+  static float16_t (* const _rh_t_fun[_rh_t_max])(float16_t) = {
+    _rh_exp,   _rh_log,   _rh_log2,  _rh_log10,
+    _rh_sin,   _rh_cos,   _rh_atan,  _rh_asin,
+    _rh_acos,  _rh_sqt,   _rh_cbt,
+    _rh_tan_n, _rh_tan_u, _rh_tan_d, _rh_tan_z
+  };
+
+  //  tan table for a SoftFloat rounding mode (as from _rnd_of)
+  static inline _rh_t _rh_t_tan(int rnd) {
+    switch ( rnd ) {
+      case softfloat_round_near_even: return _rh_t_tan_n;
+      case softfloat_round_max:       return _rh_t_tan_u;
+      case softfloat_round_min:       return _rh_t_tan_d;
+      default:                        return _rh_t_tan_z;
+    }
+  }
+
+#ifndef MATH_NO_RH_TABLES
+  static uint16_t* _rh_t_tab[_rh_t_max];
+
+  //  the table for [t], built on first use; 0 if it can't be allocated
+  static const uint16_t* _rh_table(_rh_t t) {
+    uint16_t* tab = __atomic_load_n(&_rh_t_tab[t], __ATOMIC_ACQUIRE);
+    if ( 0 == tab ) {
+      uint16_t* neu = malloc(sizeof(uint16_t) << 16);
+      if ( 0 == neu ) return 0;
+      int old = softfloat_roundingMode;
+      softfloat_roundingMode = softfloat_round_near_even;
+      for ( uint32_t b = 0; b < 0x10000; b++ ) {
+        union half u; u.h = _rh_t_fun[t](_rh_bits((uint16_t)b).h); neu[b] = u.c;
+      }
+      softfloat_roundingMode = old;
+      if ( __atomic_compare_exchange_n(&_rh_t_tab[t], &tab, neu, 0,
+                                       __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) ) {
+        tab = neu;
+      }
+      else free(neu);                  // lost the race; tab is the winner's
+    }
+    return tab;
+  }
+#endif
+
+  //  [t] at [x]: one load from its table, or the kernel (at near-even)
+  static inline float16_t _rh_look(_rh_t t, float16_t x) {
+#ifndef MATH_NO_RH_TABLES
+    const uint16_t* tab = _rh_table(t);
+    if ( tab ) { union half u; u.h = x; return _rh_bits(tab[u.c]).h; }
+#endif
+    return _rh_t_fun[t](x);
+  }
+
 /* ===================================================================
 ** @rq (quad, 128-bit) cores -- math.hoon ++rq.  Native f128 algorithms (the
 ** widest type, no delegation): same reductions as @rd, higher-degree minimax
 ** in float128_t.  Marshalling reads TWO chubs into float128_t.v[0..1], so it is
 ** word-size-agnostic -- the chub ABI sidesteps the c3_w*[n=2|4] divergence of
-** the old rq.c.  Composite arms honor the door's r via _math_rnd.
+** the old rq.c.  Composite arms honor the door's r, passed as rnd.
 ** =================================================================== */
 
   union quad {
@@ -1375,12 +1616,149 @@ typedef int64_t  c3_ds;
   static inline float128_t _rq_bits(c3_d hi, c3_d lo) {
     union quad u; u.w[0] = lo; u.w[1] = hi; return u.q;
   }
+/* @rq base ops.  SoftFloat's f128M_* pass every operand and result through
+** memory, so each Horner step of the @rq cores costs a store and a reload.
+** Where the compiler has unsigned __int128, add/sub/mul/div at near-even
+** instead work on the 113-bit significands by value, in registers, and round
+** the exact result once to nearest even: the same bits f128M_* produce.
+** Exception flags are not raised (nothing here reads them).  Directed modes
+** (a composite's door op at rnd), infinities and NaNs, and zero operands go
+** to SoftFloat: _rq_sig gives a zero e = 1, above any normalized subnormal,
+** so _rq_nadd would take it for the larger operand.  -DMATH_NO_NATIVE
+** compiles the path out.
+*/
+#if !defined(MATH_NO_NATIVE) && defined(__SIZEOF_INT128__)
+#  define _RQ_NATIVE
+#endif
+
+#ifdef _RQ_NATIVE
+#  ifdef MATH_JET_HARNESS
+  static int _rq_soft = 0;            //  harness: force SoftFloat (reference run)
+#    define _RQ_INT() ( !_rq_soft && \
+                        (softfloat_roundingMode == softfloat_round_near_even) )
+#  else
+#    define _RQ_INT() ( softfloat_roundingMode == softfloat_round_near_even )
+#  endif
+  typedef unsigned __int128 _rq_u;
+#  define _RQ_SGN  ((_rq_u)1 << 127)
+#  define _RQ_HID  ((_rq_u)1 << 112)
+#  define _RQ_EXP(x)  ((int)((x) >> 112) & 0x7fff)
+
+  static inline _rq_u _rq_raw(float128_t a) {
+    union quad u; u.q = a; return ((_rq_u)u.w[1] << 64) | u.w[0];
+  }
+  static inline float128_t _rq_pk(_rq_u x) {
+    union quad u; u.w[0] = (c3_d)x; u.w[1] = (c3_d)(x >> 64); return u.q;
+  }
+  //  finite (not inf/NaN) and, for [z], also nonzero
+  static inline int _rq_ok(_rq_u x, int z) {
+    return ( 0x7fff != _RQ_EXP(x) ) && ( !z || (x << 1) );
+  }
+  //  a >> n, OR-ing every bit shifted out into bit 0
+  static inline _rq_u _rq_jam(_rq_u a, int n) {
+    if ( n >= 128 ) return ( 0 != a );
+    return n ? ((a >> n) | (0 != (a << (128 - n)))) : a;
+  }
+  static inline int _rq_clz(_rq_u a) {           //  a != 0
+    c3_d hi = (c3_d)(a >> 64);
+    return hi ? __builtin_clzll(hi) : 64 + __builtin_clzll((c3_d)a);
+  }
+  //  significand of x with its hidden bit at 112 (a nonzero subnormal is
+  //  normalized, lowering *e); *e is the biased exponent
+  static inline _rq_u _rq_sig(_rq_u x, int* e) {
+    _rq_u s = x & (_RQ_HID - 1);
+    if ( (*e = _RQ_EXP(x)) ) return s | _RQ_HID;
+    *e = 1;
+    if ( s ) { int n = _rq_clz(s) - 15; s <<= n; *e -= n; }
+    return s;
+  }
+  //  round sig * 2^(e - 16383 - 122) to nearest even and pack; sig has its top
+  //  bit at 122 unless e is 1 (subnormal range), the low 10 bits are round
+  //  bits and bit 0 is sticky
+  static inline float128_t _rq_rpk(_rq_u sg, int e, _rq_u sig) {
+    if ( e < 1 ) { sig = _rq_jam(sig, 1 - e); e = 1; }
+    c3_d rb = (c3_d)sig & 0x3ff;
+    sig = (sig + 0x200) >> 10;
+    if ( 0x200 == rb ) sig &= ~(_rq_u)1;
+    _rq_u r = ((_rq_u)(e - 1) << 112) + sig;     // a carry bumps the exponent
+    if ( r >= ((_rq_u)0x7fff << 112) ) r = (_rq_u)0x7fff << 112;
+    return _rq_pk(sg | r);
+  }
+  static float128_t _rq_nadd(_rq_u a, _rq_u b) {
+    int ea, eb;
+    _rq_u sa = _rq_sig(a, &ea) << 10, sb = _rq_sig(b, &eb) << 10, t;
+    _rq_u sg = a & _RQ_SGN;
+    if ( (ea < eb) || ((ea == eb) && (sa < sb)) ) {
+      int n = ea; ea = eb; eb = n;
+      t = sa; sa = sb; sb = t;
+      sg = b & _RQ_SGN;
+    }
+    sb = _rq_jam(sb, ea - eb);
+    if ( !((a ^ b) & _RQ_SGN) ) {
+      sa += sb;
+      if ( sa >> 123 ) { sa = _rq_jam(sa, 1); ea++; }
+      return _rq_rpk(sg, ea, sa);
+    }
+    if ( sa == sb ) return _rq_pk(0);            //  x - x = +0 at near-even
+    sa -= sb;
+    int n = _rq_clz(sa) - 5;
+    if ( n > ea - 1 ) n = ea - 1;
+    if ( n > 0 ) { sa <<= n; ea -= n; }
+    return _rq_rpk(sg, ea, sa);
+  }
+  static float128_t _rq_nmul(_rq_u a, _rq_u b) {
+    int ea, eb;
+    _rq_u sa = _rq_sig(a, &ea), sb = _rq_sig(b, &eb);
+    c3_d a1 = (c3_d)(sa >> 64), a0 = (c3_d)sa, b1 = (c3_d)(sb >> 64), b0 = (c3_d)sb;
+    _rq_u p00 = (_rq_u)a0 * b0, p01 = (_rq_u)a0 * b1, p10 = (_rq_u)a1 * b0;
+    _rq_u mid = (p00 >> 64) + (c3_d)p01 + (c3_d)p10;
+    _rq_u lo  = (mid << 64) | (c3_d)p00;
+    _rq_u hi  = (_rq_u)a1 * b1 + (p01 >> 64) + (p10 >> 64) + (mid >> 64);
+    //  the 226-bit product has its top bit at 224 or 225; keep 123 bits
+    _rq_u sig = (hi << 26) | (lo >> 102) | (0 != (lo << 26));
+    int e = ea + eb - 16383;
+    if ( sig >> 123 ) { sig = _rq_jam(sig, 1); e++; }
+    return _rq_rpk((a ^ b) & _RQ_SGN, e, sig);
+  }
+  static float128_t _rq_ndiv(_rq_u a, _rq_u b) {
+    int ea, eb;
+    _rq_u sa = _rq_sig(a, &ea), sb = _rq_sig(b, &eb);
+    int e = ea - eb + 16383;
+    if ( sa < sb ) { sa <<= 1; e--; }
+    //  long division, 15 quotient bits a step (r < sb < 2^113)
+    _rq_u q = 1, r = sa - sb;
+    for ( int i = 0; i < 8; i++ ) { r <<= 15; q = (q << 15) | (r / sb); r %= sb; }
+    r <<= 2; q = (q << 2) | (r / sb); r %= sb;
+    return _rq_rpk((a ^ b) & _RQ_SGN, e, q | (0 != r));
+  }
+  static inline float128_t _rqa(float128_t a, float128_t b) {
+    _rq_u x = _rq_raw(a), y = _rq_raw(b);
+    if ( _RQ_INT() && _rq_ok(x, 1) && _rq_ok(y, 1) ) return _rq_nadd(x, y);
+    float128_t r; f128M_add(&a,&b,&r); return r;
+  }
+  static inline float128_t _rqs(float128_t a, float128_t b) {
+    _rq_u x = _rq_raw(a), y = _rq_raw(b);
+    if ( _RQ_INT() && _rq_ok(x, 1) && _rq_ok(y, 1) ) return _rq_nadd(x, y ^ _RQ_SGN);
+    float128_t r; f128M_sub(&a,&b,&r); return r;
+  }
+  static inline float128_t _rqm(float128_t a, float128_t b) {
+    _rq_u x = _rq_raw(a), y = _rq_raw(b);
+    if ( _RQ_INT() && _rq_ok(x, 1) && _rq_ok(y, 1) ) return _rq_nmul(x, y);
+    float128_t r; f128M_mul(&a,&b,&r); return r;
+  }
+  static inline float128_t _rqd(float128_t a, float128_t b) {
+    _rq_u x = _rq_raw(a), y = _rq_raw(b);
+    if ( _RQ_INT() && _rq_ok(x, 1) && _rq_ok(y, 1) ) return _rq_ndiv(x, y);
+    float128_t r; f128M_div(&a,&b,&r); return r;
+  }
+#else
   //  by-value wrappers over the pointer-based f128M_* ops (this SoftFloat build
   //  has no by-value f128_*).  Compiler inlines these; keeps the cores readable.
   static inline float128_t _rqm(float128_t a, float128_t b) { float128_t r; f128M_mul(&a,&b,&r); return r; }
   static inline float128_t _rqa(float128_t a, float128_t b) { float128_t r; f128M_add(&a,&b,&r); return r; }
   static inline float128_t _rqs(float128_t a, float128_t b) { float128_t r; f128M_sub(&a,&b,&r); return r; }
   static inline float128_t _rqd(float128_t a, float128_t b) { float128_t r; f128M_div(&a,&b,&r); return r; }
+#endif
   static inline float128_t _rqq(float128_t a)               { float128_t r; f128M_sqrt(&a,&r);  return r; }
   static inline int _rqeq(float128_t a, float128_t b) { return f128M_eq(&a,&b); }
   static inline int _rqlt(float128_t a, float128_t b) { return f128M_lt(&a,&b); }
@@ -1568,7 +1946,7 @@ typedef int64_t  c3_ds;
     float128_t bb = _rqs(_rqm(_rqm(z, z), rc), _rqm(xx, yy));
     return _rqa(w2, _rqa(aa, bb));
   }
-  static float128_t _rq_trigfin(int is_sin, float128_t ax, c3_d sb) {
+  static void _rq_trigsc(float128_t ax, c3_d sb, float128_t* s, float128_t* c) {
     c3_ds q = _rqtoi(_rqm(ax, _rq_bits(0x3ffe45f306dc9c88ULL, 0x2a53f84eafa3ea6aULL)),
                      softfloat_round_near_even);                       // round(ax*2/pi)
     c3_d aq = (c3_d)(q < 0 ? -q : q);
@@ -1580,11 +1958,13 @@ typedef int64_t  c3_ds;
     int mm = (int)(aq & 3);
     float128_t ks = _rq_ksin(rhi, rlo);
     float128_t kc = _rq_kcos(rhi, rlo);
-    if ( is_sin ) {
-      float128_t v = (mm==0) ? ks : (mm==1) ? kc : (mm==2) ? _rq_neg(ks) : _rq_neg(kc);
-      return (sb == 1) ? _rq_neg(v) : v;
-    }
-    return (mm==0) ? kc : (mm==1) ? _rq_neg(ks) : (mm==2) ? _rq_neg(kc) : ks;
+    float128_t v = (mm==0) ? ks : (mm==1) ? kc : (mm==2) ? _rq_neg(ks) : _rq_neg(kc);
+    *s = (sb == 1) ? _rq_neg(v) : v;
+    *c = (mm==0) ? kc : (mm==1) ? _rq_neg(ks) : (mm==2) ? _rq_neg(kc) : ks;
+  }
+  //  trig-fin: is_sin ? sin(x) : cos(x)
+  static float128_t _rq_trigfin(int is_sin, float128_t ax, c3_d sb) {
+    float128_t s, c; _rq_trigsc(ax, sb, &s, &c); return is_sin ? s : c;
   }
   static float128_t _rq_sin(float128_t x) {
     union quad r0, ax; r0.q = x;
@@ -1601,10 +1981,21 @@ typedef int64_t  c3_ds;
     ax.w[0] = r0.w[0]; ax.w[1] = r0.w[1] & 0x7fffffffffffffffULL;
     return _rq_trigfin(0, ax.q, 0);
   }
+  //  sincos: sin and cos off one reduction, bit-identical to the pair
+  static void _rq_sincos(float128_t x, float128_t* s, float128_t* c) {
+    union quad r0, ax; r0.q = x;
+    if ( !_rqeq(x, x) ||
+         ((r0.w[1]==_RQ_PINF_HI||r0.w[1]==_RQ_NINF_HI) && r0.w[0]==0) ) {  // NaN, +-inf -> NaN
+      *s = *c = _rq_bits(_RQ_QNAN_HI, 0); return;
+    }
+    ax.w[0] = r0.w[0]; ax.w[1] = r0.w[1] & 0x7fffffffffffffffULL;
+    _rq_trigsc(ax.q, r0.w[1] >> 63, s, c);
+    if ( (r0.w[1]==0||r0.w[1]==0x8000000000000000ULL) && r0.w[0]==0 ) { *s = x; }  // sin +-0 -> +-0
+  }
   //  tan = (div (sin x) (cos x)): sin/cos kernels %n, the bare div per door r
-  static float128_t _rq_tan(float128_t x) {
+  static float128_t _rq_tan(float128_t x, int rnd) {
     float128_t s = _rq_sin(x), c = _rq_cos(x);
-    softfloat_roundingMode = _math_rnd;
+    softfloat_roundingMode = rnd;
     float128_t r = _rqd(s, c);
     softfloat_roundingMode = softfloat_round_near_even;
     return r;
@@ -1669,33 +2060,33 @@ typedef int64_t  c3_ds;
                          : _rqs(hi.q, _rqs(_rqs(_rqm(xr.q, s), lo.q), xr.q));
     return (neg == 1) ? _rq_neg(res) : res;
   }
-  static float128_t _rq_atan2(float128_t y, float128_t x) {
+  static float128_t _rq_atan2(float128_t y, float128_t x, int rnd) {
     union quad xb; xb.q = x;
     float128_t zero = _rq_bits(0,0);
     float128_t pi = _rq_bits(0x4000921fb54442d1ULL, 0x8469898cc51701b8ULL);
     float128_t two = _rq_bits(0x4000000000000000ULL, 0), mone = _rq_bits(0xbfff000000000000ULL, 0);
     if ( _rqlt(zero, x) ) {                                              // x>0: atan(div y x)
-      softfloat_roundingMode = _math_rnd; float128_t q = _rqd(y, x);
+      softfloat_roundingMode = rnd; float128_t q = _rqd(y, x);
       softfloat_roundingMode = softfloat_round_near_even; return _rq_atan(q);
     }
     if ( _rqlt(x, zero) && _rqle(zero, y) ) {                            // x<0,y>=0: add(atan,pi)
-      softfloat_roundingMode = _math_rnd; float128_t q = _rqd(y, x);
+      softfloat_roundingMode = rnd; float128_t q = _rqd(y, x);
       softfloat_roundingMode = softfloat_round_near_even; float128_t a = _rq_atan(q);
-      softfloat_roundingMode = _math_rnd; float128_t r = _rqa(a, pi);
+      softfloat_roundingMode = rnd; float128_t r = _rqa(a, pi);
       softfloat_roundingMode = softfloat_round_near_even; return r;
     }
     if ( _rqlt(x, zero) && _rqlt(y, zero) ) {                            // x<0,y<0: sub(atan,pi)
-      softfloat_roundingMode = _math_rnd; float128_t q = _rqd(y, x);
+      softfloat_roundingMode = rnd; float128_t q = _rqd(y, x);
       softfloat_roundingMode = softfloat_round_near_even; float128_t a = _rq_atan(q);
-      softfloat_roundingMode = _math_rnd; float128_t r = _rqs(a, pi);
+      softfloat_roundingMode = rnd; float128_t r = _rqs(a, pi);
       softfloat_roundingMode = softfloat_round_near_even; return r;
     }
     if ( (xb.w[1]==0 && xb.w[0]==0) && _rqlt(zero, y) ) {                // x==+0,y>0: div(pi,2)
-      softfloat_roundingMode = _math_rnd; float128_t r = _rqd(pi, two);
+      softfloat_roundingMode = rnd; float128_t r = _rqd(pi, two);
       softfloat_roundingMode = softfloat_round_near_even; return r;
     }
     if ( (xb.w[1]==0 && xb.w[0]==0) && _rqlt(y, zero) ) {                // x==+0,y<0: mul(-1,div(pi,2))
-      softfloat_roundingMode = _math_rnd; float128_t r = _rqm(mone, _rqd(pi, two));
+      softfloat_roundingMode = rnd; float128_t r = _rqm(mone, _rqd(pi, two));
       softfloat_roundingMode = softfloat_round_near_even; return r;
     }
     return zero;
@@ -1818,197 +2209,194 @@ typedef int64_t  c3_ds;
   }
 
 /* @rq pow/pow-n -- math.hoon ++rq ++pow/++pow-n */
-  static float128_t _rq_pow_n(float128_t x, float128_t n) {
+  static float128_t _rq_pow_n(float128_t x, float128_t n, int rnd) {
     union quad nn; nn.q = n;
     float128_t one = _rq_bits(0x3fff000000000000ULL, 0), two = _rq_bits(0x4000000000000000ULL, 0);
     if ( nn.w[1]==0 && nn.w[0]==0 ) return one;    // n == +0 -> 1
-    softfloat_roundingMode = _math_rnd;            // bare mul/sub round per door r
+    softfloat_roundingMode = rnd;            // bare mul/sub round per door r
     float128_t p = x;
     while ( !_rqlt(n, two) ) { p = _rqm(p, x); n = _rqs(n, one); }
     softfloat_roundingMode = softfloat_round_near_even;
     return p;
   }
-  static float128_t _rq_pow(float128_t x, float128_t n) {
+  static float128_t _rq_pow(float128_t x, float128_t n, int rnd) {
     union quad nn, ni; nn.q = n;
     float128_t zero = _rq_bits(0,0);
     ni.q = _rqi64(_rqtoi(n, softfloat_round_near_even));               // san (need (toi n))
     if ( (nn.w[1]==ni.w[1] && nn.w[0]==ni.w[0]) && _rqlt(zero, n) )    // positive integer
-      return _rq_pow_n(x, ni.q);
+      return _rq_pow_n(x, ni.q, rnd);
     float128_t lg = _rq_log(x);                                       // %n kernel
-    softfloat_roundingMode = _math_rnd;                              // bare mul per door r
+    softfloat_roundingMode = rnd;                              // bare mul per door r
     float128_t prod = _rqm(n, lg);
     softfloat_roundingMode = softfloat_round_near_even;
     return _rq_exp(prod);                                             // %n kernel: exp(n*log x)
   }
 
-#ifndef MATH_JET_HARNESS
-
-/* u3 ABI wrappers.  Each transcendental forces round-near-even; the @rd door's
-** rounding axis is ignored (the Hoon does the same).  Sample is the single @rd
-** at u3x_sam.
+/* Batch drivers.  One kernel over n packed elements, for the ray entry
+** (u3qi_math_ray) that Saloon's ray arms jet onto: _r?_map runs a unary
+** kernel, _r?_map_r one that takes the door's rounding (tan), _r?_map2 a
+** composite over two arrays, lane for lane, and _r?_map_sc sin and cos
+** into two arrays off one reduction.  They are the scalar wrappers'
+** loop bodies with the noun I/O hoisted out, so the caller sets near-even
+** once, as _r?_run does per call.  r may alias x.  @rh's unary arms go
+** through _rh_map_t, which fetches the arm's table once per array.
 */
-  static u3_noun
-  _rd_jet(u3_noun cor, float64_t (*fun)(float64_t))
+#define _MATH_MAP(w, T)                                                       \
+  static inline void                                                          \
+  _##w##_map(T (*fun)(T), const T* x, T* r, c3_d n)                           \
+  { for ( c3_d i = 0; i < n; i++ ) r[i] = fun(x[i]); }                        \
+  static inline void                                                          \
+  _##w##_map_r(T (*fun)(T, int), const T* x, T* r, c3_d n, int rnd)           \
+  { for ( c3_d i = 0; i < n; i++ ) r[i] = fun(x[i], rnd); }                   \
+  static inline void                                                          \
+  _##w##_map2(T (*fun)(T, T, int), const T* x, const T* y, T* r, c3_d n,      \
+              int rnd)                                                        \
+  { for ( c3_d i = 0; i < n; i++ ) r[i] = fun(x[i], y[i], rnd); }             \
+  static inline void                                                          \
+  _##w##_map_sc(const T* x, T* s, T* c, c3_d n)                               \
+  { for ( c3_d i = 0; i < n; i++ ) _##w##_sincos(x[i], &s[i], &c[i]); }
+
+  _MATH_MAP(rd, float64_t)
+  _MATH_MAP(rs, float32_t)
+  _MATH_MAP(rh, float16_t)
+  _MATH_MAP(rq, float128_t)
+
+  static void
+  _rh_map_t(_rh_t t, const float16_t* x, float16_t* r, c3_d n)
   {
-    u3_noun x = u3r_at(u3x_sam, cor);
-    if ( u3_none == x || c3n == u3ud(x) ) {
-      return u3m_bail(c3__exit);
-    }
-    {
-      union doub c, e;
-      softfloat_roundingMode = softfloat_round_near_even;
-      _math_rnd = _rnd_of(u3r_at(60, cor));      // door rounding r (for composite arms)
-      c.c = u3r_chub(0, x);
-      e.d = fun(c.d);
-      return u3i_chubs(1, &e.c);
+#ifndef MATH_NO_RH_TABLES
+    const uint16_t* tab = _rh_table(t);
+    if ( tab ) {
+      for ( c3_d i = 0; i < n; i++ ) {
+        union half u; u.h = x[i]; r[i] = _rh_bits(tab[u.c]).h;
+      }
+      return;
     }
+#endif
+    for ( c3_d i = 0; i < n; i++ ) r[i] = _rh_t_fun[t](x[i]);
   }
 
-  u3_noun u3qi_rd_exp(u3_atom a)
-  {
-    union doub c, e;
-    softfloat_roundingMode = softfloat_round_near_even;
-    c.c = u3r_chub(0, a);
-    e.d = _rd_exp(c.d);
-    return u3i_chubs(1, &e.c);
-  }
-  u3_noun u3wi_rd_exp(u3_noun cor) { return _rd_jet(cor, _rd_exp); }
+  //  arm names the batch drivers cover; the first eleven unary arms are in
+  //  _rh_t order, so an index here is also @rh's table
+  static const char* const _math_un_c[12] = {
+    "exp",  "log",  "log-2", "log-10", "sin", "cos",
+    "atan", "asin", "acos",  "sqt",    "cbt", "tan"
+  };
+  static const char* const _math_bi_c[3] = { "atan2", "pow", "pow-n" };
 
-  u3_noun u3qi_rd_log(u3_atom a)
-  {
-    union doub c, e;
-    softfloat_roundingMode = softfloat_round_near_even;
-    c.c = u3r_chub(0, a);
-    e.d = _rd_log(c.d);
-    return u3i_chubs(1, &e.c);
-  }
-  u3_noun u3wi_rd_log(u3_noun cor) { return _rd_jet(cor, _rd_log); }
+  static float64_t (* const _rd_un[12])(float64_t) = {
+    _rd_exp,  _rd_log,  _rd_log2, _rd_log10, _rd_sin, _rd_cos,
+    _rd_atan, _rd_asin, _rd_acos, _rd_sqt,   _rd_cbt, _rd_tan
+  };
+  static float32_t (* const _rs_un[11])(float32_t) = {
+    _rs_exp,  _rs_log,  _rs_log2, _rs_log10, _rs_sin, _rs_cos,
+    _rs_atan, _rs_asin, _rs_acos, _rs_sqt,   _rs_cbt
+  };
+  static float128_t (* const _rq_un[11])(float128_t) = {
+    _rq_exp,  _rq_log,  _rq_log2, _rq_log10, _rq_sin, _rq_cos,
+    _rq_atan, _rq_asin, _rq_acos, _rq_sqt,   _rq_cbt
+  };
+  static float64_t (* const _rd_bi[3])(float64_t, float64_t, int) =
+    { _rd_atan2, _rd_pow, _rd_pow_n };
+  static float32_t (* const _rs_bi[3])(float32_t, float32_t, int) =
+    { _rs_atan2, _rs_pow, _rs_pow_n };
+  static float16_t (* const _rh_bi[3])(float16_t, float16_t, int) =
+    { _rh_atan2, _rh_pow, _rh_pow_n };
+  static float128_t (* const _rq_bi[3])(float128_t, float128_t, int) =
+    { _rq_atan2, _rq_pow, _rq_pow_n };
 
-  u3_noun u3qi_rd_sin(u3_atom a)
-  {
-    union doub c, e;
-    softfloat_roundingMode = softfloat_round_near_even;
-    c.c = u3r_chub(0, a);
-    e.d = _rd_sin(c.d);
-    return u3i_chubs(1, &e.c);
-  }
-  u3_noun u3wi_rd_sin(u3_noun cor) { return _rd_jet(cor, _rd_sin); }
+#ifndef MATH_JET_HARNESS
 
-  u3_noun u3qi_rd_cos(u3_atom a)
-  {
-    union doub c, e;
-    softfloat_roundingMode = softfloat_round_near_even;
-    c.c = u3r_chub(0, a);
-    e.d = _rd_cos(c.d);
-    return u3i_chubs(1, &e.c);
+/* u3 ABI wrappers.  Each transcendental forces round-near-even; the door's
+** rounding axis is ignored (the Hoon does the same) except by the composite
+** arms, which are handed it as rnd.  Every entry point saves the caller's
+** SoftFloat mode and restores it on the way out, so a jet never leaks its
+** mode into whatever runs next.  Sample is the single float at u3x_sam, or
+** [x n] / [y x] for the two-argument arms.
+*/
+  static inline int _math_push(int rnd) {
+    int old = softfloat_roundingMode; softfloat_roundingMode = rnd; return old;
   }
-  u3_noun u3wi_rd_cos(u3_noun cor) { return _rd_jet(cor, _rd_cos); }
 
-  u3_noun u3qi_rd_tan(u3_atom a)
-  {
-    union doub c, e;
-    softfloat_roundingMode = softfloat_round_near_even;
-    c.c = u3r_chub(0, a);
-    e.d = _rd_tan(c.d);
-    return u3i_chubs(1, &e.c);
+  static inline float64_t _rd_in(u3_atom a) {
+    union doub c; c.c = u3r_chub(0, a); return c.d;
   }
-  u3_noun u3wi_rd_tan(u3_noun cor) { return _rd_jet(cor, _rd_tan); }
-
-  u3_noun u3qi_rd_atan(u3_atom a)
-  {
-    union doub c, e;
-    softfloat_roundingMode = softfloat_round_near_even;
-    c.c = u3r_chub(0, a);
-    e.d = _rd_atan(c.d);
-    return u3i_chubs(1, &e.c);
+  static inline u3_noun _rd_out(float64_t v) {
+    union doub e; e.d = v; return u3i_chubs(1, &e.c);
   }
-  u3_noun u3wi_rd_atan(u3_noun cor) { return _rd_jet(cor, _rd_atan); }
-
-  u3_noun u3qi_rd_atan2(u3_atom y, u3_atom x)
-  {
-    union doub yy, xx, e;
-    softfloat_roundingMode = softfloat_round_near_even;
-    yy.c = u3r_chub(0, y);
-    xx.c = u3r_chub(0, x);
-    e.d = _rd_atan2(yy.d, xx.d);
-    return u3i_chubs(1, &e.c);
+  static u3_noun _rd_run(float64_t (*fun)(float64_t), u3_atom a) {
+    int old = _math_push(softfloat_round_near_even);
+    float64_t r = fun(_rd_in(a));
+    softfloat_roundingMode = old;
+    return _rd_out(r);
   }
-  u3_noun u3wi_rd_atan2(u3_noun cor)
-  {
-    u3_noun y, x;
-    if ( c3n == u3r_mean(cor, u3x_sam_2, &y, u3x_sam_3, &x, 0) ||
-         c3n == u3ud(y) || c3n == u3ud(x) ) {
-      return u3m_bail(c3__exit);
-    }
-    _math_rnd = _rnd_of(u3r_at(60, cor));         // door rounding r
-    return u3qi_rd_atan2(y, x);
+  static u3_noun _rd_run2(float64_t (*fun)(float64_t, float64_t, int),
+                          u3_atom x, u3_atom n, int rnd) {
+    int old = _math_push(softfloat_round_near_even);
+    float64_t r = fun(_rd_in(x), _rd_in(n), rnd);
+    softfloat_roundingMode = old;
+    return _rd_out(r);
   }
-
-  u3_noun u3qi_rd_asin(u3_atom a)
-  {
-    union doub c, e;
-    softfloat_roundingMode = softfloat_round_near_even;
-    c.c = u3r_chub(0, a);
-    e.d = _rd_asin(c.d);
-    return u3i_chubs(1, &e.c);
+  static u3_noun _rd_jet(u3_noun cor, const c3_c* arm_c, float64_t (*fun)(float64_t)) {
+    u3_noun x = u3r_at(u3x_sam, cor);
+    if ( u3_none == x || c3n == u3ud(x) ) return u3m_bail(c3__exit);
+    return U3QI_JST("rd", arm_c, c3__i754, 6, _rd_run(fun, x));
   }
-  u3_noun u3wi_rd_asin(u3_noun cor) { return _rd_jet(cor, _rd_asin); }
-
-  u3_noun u3qi_rd_acos(u3_atom a)
-  {
-    union doub c, e;
-    softfloat_roundingMode = softfloat_round_near_even;
-    c.c = u3r_chub(0, a);
-    e.d = _rd_acos(c.d);
-    return u3i_chubs(1, &e.c);
-  }
-  u3_noun u3wi_rd_acos(u3_noun cor) { return _rd_jet(cor, _rd_acos); }
-
-  u3_noun u3qi_rd_log2(u3_atom a)
-  { union doub c,e; softfloat_roundingMode=softfloat_round_near_even;
-    c.c=u3r_chub(0,a); e.d=_rd_log2(c.d); return u3i_chubs(1,&e.c); }
-  u3_noun u3wi_rd_log2(u3_noun cor) { return _rd_jet(cor, _rd_log2); }
-
-  u3_noun u3qi_rd_log10(u3_atom a)
-  { union doub c,e; softfloat_roundingMode=softfloat_round_near_even;
-    c.c=u3r_chub(0,a); e.d=_rd_log10(c.d); return u3i_chubs(1,&e.c); }
-  u3_noun u3wi_rd_log10(u3_noun cor) { return _rd_jet(cor, _rd_log10); }
-
-  u3_noun u3qi_rd_sqt(u3_atom a)
-  { union doub c,e; softfloat_roundingMode=softfloat_round_near_even;
-    c.c=u3r_chub(0,a); e.d=_rd_sqt(c.d); return u3i_chubs(1,&e.c); }
-  u3_noun u3wi_rd_sqt(u3_noun cor) { return _rd_jet(cor, _rd_sqt); }
-
-  u3_noun u3qi_rd_cbt(u3_atom a)
-  { union doub c,e; softfloat_roundingMode=softfloat_round_near_even;
-    c.c=u3r_chub(0,a); e.d=_rd_cbt(c.d); return u3i_chubs(1,&e.c); }
-  u3_noun u3wi_rd_cbt(u3_noun cor) { return _rd_jet(cor, _rd_cbt); }
-
-  //  pow / pow-n: sample is [x=@rd n=@rd]
-  static u3_noun _rd_jet2(u3_noun cor, float64_t (*fun)(float64_t, float64_t))
-  {
+  static u3_noun _rd_jet2(u3_noun cor, const c3_c* arm_c, float64_t (*fun)(float64_t, float64_t, int)) {
     u3_noun x, n;
     if ( c3n == u3r_mean(cor, u3x_sam_2, &x, u3x_sam_3, &n, 0) ||
          c3n == u3ud(x) || c3n == u3ud(n) ) {
       return u3m_bail(c3__exit);
     }
-    { union doub xx, nn, e;
-      softfloat_roundingMode = softfloat_round_near_even;
-      _math_rnd = _rnd_of(u3r_at(60, cor));      // door rounding r
-      xx.c = u3r_chub(0, x); nn.c = u3r_chub(0, n);
-      e.d = fun(xx.d, nn.d);
-      return u3i_chubs(1, &e.c);
-    }
+    return U3QI_JST("rd", arm_c, c3__i754, 6, _rd_run2(fun, x, n, _rnd_of(u3r_at(60, cor))));  // door rounding r
+  }
+
+  //  sincos: [sin cos] off one reduction
+  static u3_noun _rd_run_sc(u3_atom a) {
+    int old = _math_push(softfloat_round_near_even);
+    float64_t s, c; _rd_sincos(_rd_in(a), &s, &c);
+    softfloat_roundingMode = old;
+    return u3nc(_rd_out(s), _rd_out(c));
+  }
+
+  u3_noun u3qi_rd_exp(u3_atom a)                   { return _rd_run(_rd_exp, a); }
+  u3_noun u3wi_rd_exp(u3_noun cor)                 { return _rd_jet(cor, "exp", _rd_exp); }
+  u3_noun u3qi_rd_log(u3_atom a)                   { return _rd_run(_rd_log, a); }
+  u3_noun u3wi_rd_log(u3_noun cor)                 { return _rd_jet(cor, "log", _rd_log); }
+  u3_noun u3qi_rd_sin(u3_atom a)                   { return _rd_run(_rd_sin, a); }
+  u3_noun u3wi_rd_sin(u3_noun cor)                 { return _rd_jet(cor, "sin", _rd_sin); }
+  u3_noun u3qi_rd_cos(u3_atom a)                   { return _rd_run(_rd_cos, a); }
+  u3_noun u3wi_rd_cos(u3_noun cor)                 { return _rd_jet(cor, "cos", _rd_cos); }
+  u3_noun u3qi_rd_tan(u3_atom a)                   { return _rd_run(_rd_tan, a); }
+  u3_noun u3wi_rd_tan(u3_noun cor)                 { return _rd_jet(cor, "tan", _rd_tan); }
+  u3_noun u3qi_rd_atan(u3_atom a)                  { return _rd_run(_rd_atan, a); }
+  u3_noun u3wi_rd_atan(u3_noun cor)                { return _rd_jet(cor, "atan", _rd_atan); }
+  u3_noun u3qi_rd_asin(u3_atom a)                  { return _rd_run(_rd_asin, a); }
+  u3_noun u3wi_rd_asin(u3_noun cor)                { return _rd_jet(cor, "asin", _rd_asin); }
+  u3_noun u3qi_rd_acos(u3_atom a)                  { return _rd_run(_rd_acos, a); }
+  u3_noun u3wi_rd_acos(u3_noun cor)                { return _rd_jet(cor, "acos", _rd_acos); }
+  u3_noun u3qi_rd_sqt(u3_atom a)                   { return _rd_run(_rd_sqt, a); }
+  u3_noun u3wi_rd_sqt(u3_noun cor)                 { return _rd_jet(cor, "sqt", _rd_sqt); }
+  u3_noun u3qi_rd_cbt(u3_atom a)                   { return _rd_run(_rd_cbt, a); }
+  u3_noun u3wi_rd_cbt(u3_noun cor)                 { return _rd_jet(cor, "cbt", _rd_cbt); }
+  u3_noun u3qi_rd_log2(u3_atom a)                  { return _rd_run(_rd_log2, a); }
+  u3_noun u3wi_rd_log2(u3_noun cor)                { return _rd_jet(cor, "log2", _rd_log2); }
+  u3_noun u3qi_rd_log10(u3_atom a)                 { return _rd_run(_rd_log10, a); }
+  u3_noun u3wi_rd_log10(u3_noun cor)               { return _rd_jet(cor, "log10", _rd_log10); }
+  u3_noun u3qi_rd_sincos(u3_atom a)                { return _rd_run_sc(a); }
+  u3_noun u3wi_rd_sincos(u3_noun cor)
+  {
+    u3_noun x = u3r_at(u3x_sam, cor);
+    if ( u3_none == x || c3n == u3ud(x) ) return u3m_bail(c3__exit);
+    return U3QI_JST("rd", "sincos", c3__i754, 6, _rd_run_sc(x));
   }
-  u3_noun u3qi_rd_pow(u3_atom x, u3_atom n)
-  { union doub xx,nn,e; softfloat_roundingMode=softfloat_round_near_even;
-    xx.c=u3r_chub(0,x); nn.c=u3r_chub(0,n); e.d=_rd_pow(xx.d,nn.d); return u3i_chubs(1,&e.c); }
-  u3_noun u3wi_rd_pow(u3_noun cor) { return _rd_jet2(cor, _rd_pow); }
 
-  u3_noun u3qi_rd_pow_n(u3_atom x, u3_atom n)
-  { union doub xx,nn,e; softfloat_roundingMode=softfloat_round_near_even;
-    xx.c=u3r_chub(0,x); nn.c=u3r_chub(0,n); e.d=_rd_pow_n(xx.d,nn.d); return u3i_chubs(1,&e.c); }
-  u3_noun u3wi_rd_pow_n(u3_noun cor) { return _rd_jet2(cor, _rd_pow_n); }
+  u3_noun u3qi_rd_atan2(u3_atom y, u3_atom x, c3_y rnd) { return _rd_run2(_rd_atan2, y, x, _rnd_of(rnd)); }
+  u3_noun u3wi_rd_atan2(u3_noun cor)               { return _rd_jet2(cor, "atan2", _rd_atan2); }
+  u3_noun u3qi_rd_pow(u3_atom x, u3_atom n, c3_y rnd) { return _rd_run2(_rd_pow, x, n, _rnd_of(rnd)); }
+  u3_noun u3wi_rd_pow(u3_noun cor)                 { return _rd_jet2(cor, "pow", _rd_pow); }
+  u3_noun u3qi_rd_pow_n(u3_atom x, u3_atom n, c3_y rnd) { return _rd_run2(_rd_pow_n, x, n, _rnd_of(rnd)); }
+  u3_noun u3wi_rd_pow_n(u3_noun cor)               { return _rd_jet2(cor, "pow_n", _rd_pow_n); }
 
 /* @rs ABI wrappers.  @rs is a 32-bit atom: read the low 32 bits of the chub,
 ** write the 32-bit result as a chub (high bits zero -> normalizes to a 32-bit
@@ -2020,60 +2408,96 @@ typedef int64_t  c3_ds;
   static inline u3_noun _rs_out(float32_t v) {
     union sing s; s.s = v; { c3_d out = (c3_d)s.c; return u3i_chubs(1, &out); }
   }
-  static u3_noun _rs_jet(u3_noun cor, float32_t (*fun)(float32_t)) {
+  static u3_noun _rs_run(float32_t (*fun)(float32_t), u3_atom a) {
+    int old = _math_push(softfloat_round_near_even);
+    float32_t r = fun(_rs_in(a));
+    softfloat_roundingMode = old;
+    return _rs_out(r);
+  }
+  static u3_noun _rs_run_r(float32_t (*fun)(float32_t, int), u3_atom a, int rnd) {
+    int old = _math_push(softfloat_round_near_even);
+    float32_t r = fun(_rs_in(a), rnd);
+    softfloat_roundingMode = old;
+    return _rs_out(r);
+  }
+  static u3_noun _rs_run2(float32_t (*fun)(float32_t, float32_t, int),
+                          u3_atom x, u3_atom n, int rnd) {
+    int old = _math_push(softfloat_round_near_even);
+    float32_t r = fun(_rs_in(x), _rs_in(n), rnd);
+    softfloat_roundingMode = old;
+    return _rs_out(r);
+  }
+  static u3_noun _rs_jet(u3_noun cor, const c3_c* arm_c, float32_t (*fun)(float32_t)) {
     u3_noun x = u3r_at(u3x_sam, cor);
     if ( u3_none == x || c3n == u3ud(x) ) return u3m_bail(c3__exit);
-    softfloat_roundingMode = softfloat_round_near_even;
-    _math_rnd = _rnd_of(u3r_at(60, cor));        // door rounding r (for @rs tan)
-    return _rs_out(fun(_rs_in(x)));
+    return U3QI_JST("rs", arm_c, c3__i754, 5, _rs_run(fun, x));
+  }
+  static u3_noun _rs_jet_r(u3_noun cor, const c3_c* arm_c, float32_t (*fun)(float32_t, int)) {
+    u3_noun x = u3r_at(u3x_sam, cor);
+    if ( u3_none == x || c3n == u3ud(x) ) return u3m_bail(c3__exit);
+    return U3QI_JST("rs", arm_c, c3__i754, 5, _rs_run_r(fun, x, _rnd_of(u3r_at(60, cor))));   // door rounding r
   }
-  static u3_noun _rs_jet2(u3_noun cor, float32_t (*fun)(float32_t, float32_t)) {
+  static u3_noun _rs_jet2(u3_noun cor, const c3_c* arm_c, float32_t (*fun)(float32_t, float32_t, int)) {
     u3_noun x, n;
     if ( c3n == u3r_mean(cor, u3x_sam_2, &x, u3x_sam_3, &n, 0) ||
          c3n == u3ud(x) || c3n == u3ud(n) ) {
       return u3m_bail(c3__exit);
     }
-    softfloat_roundingMode = softfloat_round_near_even;
-    _math_rnd = _rnd_of(u3r_at(60, cor));        // door rounding r
-    return _rs_out(fun(_rs_in(x), _rs_in(n)));
-  }
-
-  u3_noun u3qi_rs_exp(u3_atom a)   { softfloat_roundingMode=softfloat_round_near_even; return _rs_out(_rs_exp(_rs_in(a))); }
-  u3_noun u3wi_rs_exp(u3_noun cor) { return _rs_jet(cor, _rs_exp); }
-  u3_noun u3qi_rs_log(u3_atom a)   { softfloat_roundingMode=softfloat_round_near_even; return _rs_out(_rs_log(_rs_in(a))); }
-  u3_noun u3wi_rs_log(u3_noun cor) { return _rs_jet(cor, _rs_log); }
-  u3_noun u3qi_rs_sin(u3_atom a)   { softfloat_roundingMode=softfloat_round_near_even; return _rs_out(_rs_sin(_rs_in(a))); }
-  u3_noun u3wi_rs_sin(u3_noun cor) { return _rs_jet(cor, _rs_sin); }
-  u3_noun u3qi_rs_cos(u3_atom a)   { softfloat_roundingMode=softfloat_round_near_even; return _rs_out(_rs_cos(_rs_in(a))); }
-  u3_noun u3wi_rs_cos(u3_noun cor) { return _rs_jet(cor, _rs_cos); }
-  u3_noun u3qi_rs_tan(u3_atom a)   { softfloat_roundingMode=softfloat_round_near_even; return _rs_out(_rs_tan(_rs_in(a))); }
-  u3_noun u3wi_rs_tan(u3_noun cor) { return _rs_jet(cor, _rs_tan); }
-  u3_noun u3qi_rs_atan(u3_atom a)  { softfloat_roundingMode=softfloat_round_near_even; return _rs_out(_rs_atan(_rs_in(a))); }
-  u3_noun u3wi_rs_atan(u3_noun cor){ return _rs_jet(cor, _rs_atan); }
-  u3_noun u3qi_rs_asin(u3_atom a)  { softfloat_roundingMode=softfloat_round_near_even; return _rs_out(_rs_asin(_rs_in(a))); }
-  u3_noun u3wi_rs_asin(u3_noun cor){ return _rs_jet(cor, _rs_asin); }
-  u3_noun u3qi_rs_acos(u3_atom a)  { softfloat_roundingMode=softfloat_round_near_even; return _rs_out(_rs_acos(_rs_in(a))); }
-  u3_noun u3wi_rs_acos(u3_noun cor){ return _rs_jet(cor, _rs_acos); }
-  u3_noun u3qi_rs_sqt(u3_atom a)   { softfloat_roundingMode=softfloat_round_near_even; return _rs_out(_rs_sqt(_rs_in(a))); }
-  u3_noun u3wi_rs_sqt(u3_noun cor) { return _rs_jet(cor, _rs_sqt); }
-  u3_noun u3qi_rs_cbt(u3_atom a)   { softfloat_roundingMode=softfloat_round_near_even; return _rs_out(_rs_cbt(_rs_in(a))); }
-  u3_noun u3wi_rs_cbt(u3_noun cor) { return _rs_jet(cor, _rs_cbt); }
-  u3_noun u3qi_rs_log2(u3_atom a)  { softfloat_roundingMode=softfloat_round_near_even; return _rs_out(_rs_log2(_rs_in(a))); }
-  u3_noun u3wi_rs_log2(u3_noun cor){ return _rs_jet(cor, _rs_log2); }
-  u3_noun u3qi_rs_log10(u3_atom a) { softfloat_roundingMode=softfloat_round_near_even; return _rs_out(_rs_log10(_rs_in(a))); }
-  u3_noun u3wi_rs_log10(u3_noun cor){ return _rs_jet(cor, _rs_log10); }
-
-  u3_noun u3qi_rs_atan2(u3_atom y, u3_atom x) { softfloat_roundingMode=softfloat_round_near_even; return _rs_out(_rs_atan2(_rs_in(y), _rs_in(x))); }
-  u3_noun u3wi_rs_atan2(u3_noun cor){ return _rs_jet2(cor, _rs_atan2); }
-  u3_noun u3qi_rs_pow(u3_atom x, u3_atom n)   { softfloat_roundingMode=softfloat_round_near_even; return _rs_out(_rs_pow(_rs_in(x), _rs_in(n))); }
-  u3_noun u3wi_rs_pow(u3_noun cor) { return _rs_jet2(cor, _rs_pow); }
-  u3_noun u3qi_rs_pow_n(u3_atom x, u3_atom n) { softfloat_roundingMode=softfloat_round_near_even; return _rs_out(_rs_pow_n(_rs_in(x), _rs_in(n))); }
-  u3_noun u3wi_rs_pow_n(u3_noun cor){ return _rs_jet2(cor, _rs_pow_n); }
+    return U3QI_JST("rs", arm_c, c3__i754, 5, _rs_run2(fun, x, n, _rnd_of(u3r_at(60, cor))));  // door rounding r
+  }
+
+  //  sincos: [sin cos] off one reduction
+  static u3_noun _rs_run_sc(u3_atom a) {
+    int old = _math_push(softfloat_round_near_even);
+    float32_t s, c; _rs_sincos(_rs_in(a), &s, &c);
+    softfloat_roundingMode = old;
+    return u3nc(_rs_out(s), _rs_out(c));
+  }
+
+  u3_noun u3qi_rs_exp(u3_atom a)                   { return _rs_run(_rs_exp, a); }
+  u3_noun u3wi_rs_exp(u3_noun cor)                 { return _rs_jet(cor, "exp", _rs_exp); }
+  u3_noun u3qi_rs_log(u3_atom a)                   { return _rs_run(_rs_log, a); }
+  u3_noun u3wi_rs_log(u3_noun cor)                 { return _rs_jet(cor, "log", _rs_log); }
+  u3_noun u3qi_rs_sin(u3_atom a)                   { return _rs_run(_rs_sin, a); }
+  u3_noun u3wi_rs_sin(u3_noun cor)                 { return _rs_jet(cor, "sin", _rs_sin); }
+  u3_noun u3qi_rs_cos(u3_atom a)                   { return _rs_run(_rs_cos, a); }
+  u3_noun u3wi_rs_cos(u3_noun cor)                 { return _rs_jet(cor, "cos", _rs_cos); }
+  u3_noun u3qi_rs_tan(u3_atom a, c3_y rnd)         { return _rs_run_r(_rs_tan, a, _rnd_of(rnd)); }
+  u3_noun u3wi_rs_tan(u3_noun cor)                 { return _rs_jet_r(cor, "tan", _rs_tan); }
+  u3_noun u3qi_rs_atan(u3_atom a)                  { return _rs_run(_rs_atan, a); }
+  u3_noun u3wi_rs_atan(u3_noun cor)                { return _rs_jet(cor, "atan", _rs_atan); }
+  u3_noun u3qi_rs_asin(u3_atom a)                  { return _rs_run(_rs_asin, a); }
+  u3_noun u3wi_rs_asin(u3_noun cor)                { return _rs_jet(cor, "asin", _rs_asin); }
+  u3_noun u3qi_rs_acos(u3_atom a)                  { return _rs_run(_rs_acos, a); }
+  u3_noun u3wi_rs_acos(u3_noun cor)                { return _rs_jet(cor, "acos", _rs_acos); }
+  u3_noun u3qi_rs_sqt(u3_atom a)                   { return _rs_run(_rs_sqt, a); }
+  u3_noun u3wi_rs_sqt(u3_noun cor)                 { return _rs_jet(cor, "sqt", _rs_sqt); }
+  u3_noun u3qi_rs_cbt(u3_atom a)                   { return _rs_run(_rs_cbt, a); }
+  u3_noun u3wi_rs_cbt(u3_noun cor)                 { return _rs_jet(cor, "cbt", _rs_cbt); }
+  u3_noun u3qi_rs_log2(u3_atom a)                  { return _rs_run(_rs_log2, a); }
+  u3_noun u3wi_rs_log2(u3_noun cor)                { return _rs_jet(cor, "log2", _rs_log2); }
+  u3_noun u3qi_rs_log10(u3_atom a)                 { return _rs_run(_rs_log10, a); }
+  u3_noun u3wi_rs_log10(u3_noun cor)               { return _rs_jet(cor, "log10", _rs_log10); }
+  u3_noun u3qi_rs_sincos(u3_atom a)                { return _rs_run_sc(a); }
+  u3_noun u3wi_rs_sincos(u3_noun cor)
+  {
+    u3_noun x = u3r_at(u3x_sam, cor);
+    if ( u3_none == x || c3n == u3ud(x) ) return u3m_bail(c3__exit);
+    return U3QI_JST("rs", "sincos", c3__i754, 5, _rs_run_sc(x));
+  }
+
+  u3_noun u3qi_rs_atan2(u3_atom y, u3_atom x, c3_y rnd) { return _rs_run2(_rs_atan2, y, x, _rnd_of(rnd)); }
+  u3_noun u3wi_rs_atan2(u3_noun cor)               { return _rs_jet2(cor, "atan2", _rs_atan2); }
+  u3_noun u3qi_rs_pow(u3_atom x, u3_atom n, c3_y rnd) { return _rs_run2(_rs_pow, x, n, _rnd_of(rnd)); }
+  u3_noun u3wi_rs_pow(u3_noun cor)                 { return _rs_jet2(cor, "pow", _rs_pow); }
+  u3_noun u3qi_rs_pow_n(u3_atom x, u3_atom n, c3_y rnd) { return _rs_run2(_rs_pow_n, x, n, _rnd_of(rnd)); }
+  u3_noun u3wi_rs_pow_n(u3_noun cor)               { return _rs_jet2(cor, "pow_n", _rs_pow_n); }
 
 /* @rh ABI wrappers.  @rh is a 16-bit atom: read the low 16 bits of the chub,
 ** write the 16-bit result via chub (high bits zero -> normalizes).  Same
-** word-agnostic chub I/O as @rd/@rs.  Wrappers set _math_rnd from the door's r
-** (axis 60); the cores apply it to the rs composite ops and the f16 narrow.
+** word-agnostic chub I/O as @rd/@rs.  Wrappers pass the door's r (axis 60)
+** as rnd; the composites apply it to their bare ops.  Unary arms are served
+** from the _rh_look tables.
 */
   static inline float16_t _rh_in(u3_atom a) {
     union half s; s.c = (uint16_t)u3r_chub(0, a); return s.h;
@@ -2081,60 +2505,86 @@ typedef int64_t  c3_ds;
   static inline u3_noun _rh_out(float16_t v) {
     union half s; s.h = v; { c3_d out = (c3_d)s.c; return u3i_chubs(1, &out); }
   }
-  static u3_noun _rh_jet(u3_noun cor, float16_t (*fun)(float16_t)) {
+  static u3_noun _rh_run_t(_rh_t t, u3_atom a) {
+    int old = _math_push(softfloat_round_near_even);
+    float16_t r = _rh_look(t, _rh_in(a));
+    softfloat_roundingMode = old;
+    return _rh_out(r);
+  }
+  static u3_noun _rh_run2(float16_t (*fun)(float16_t, float16_t, int),
+                          u3_atom x, u3_atom n, int rnd) {
+    int old = _math_push(softfloat_round_near_even);
+    float16_t r = fun(_rh_in(x), _rh_in(n), rnd);
+    softfloat_roundingMode = old;
+    return _rh_out(r);
+  }
+  static u3_noun _rh_jet_t(u3_noun cor, const c3_c* arm_c, _rh_t t) {
     u3_noun x = u3r_at(u3x_sam, cor);
     if ( u3_none == x || c3n == u3ud(x) ) return u3m_bail(c3__exit);
-    softfloat_roundingMode = softfloat_round_near_even;   // kernels run near-even
-    _math_rnd = _rnd_of(u3r_at(60, cor));        // door rounding r (for @rh tan/cbt/log-2/log-10)
-    return _rh_out(fun(_rh_in(x)));
+    return U3QI_JST("rh", arm_c, c3__i754, 4, _rh_run_t(t, x));
   }
-  static u3_noun _rh_jet2(u3_noun cor, float16_t (*fun)(float16_t, float16_t)) {
+  static u3_noun _rh_jet2(u3_noun cor, const c3_c* arm_c, float16_t (*fun)(float16_t, float16_t, int)) {
     u3_noun x, n;
     if ( c3n == u3r_mean(cor, u3x_sam_2, &x, u3x_sam_3, &n, 0) ||
          c3n == u3ud(x) || c3n == u3ud(n) ) {
       return u3m_bail(c3__exit);
     }
-    softfloat_roundingMode = softfloat_round_near_even;   // kernels run near-even
-    _math_rnd = _rnd_of(u3r_at(60, cor));        // door rounding r (composites)
-    return _rh_out(fun(_rh_in(x), _rh_in(n)));
-  }
-
-  u3_noun u3qi_rh_exp(u3_atom a)   { softfloat_roundingMode=softfloat_round_near_even; return _rh_out(_rh_exp(_rh_in(a))); }
-  u3_noun u3wi_rh_exp(u3_noun cor) { return _rh_jet(cor, _rh_exp); }
-  u3_noun u3qi_rh_log(u3_atom a)   { softfloat_roundingMode=softfloat_round_near_even; return _rh_out(_rh_log(_rh_in(a))); }
-  u3_noun u3wi_rh_log(u3_noun cor) { return _rh_jet(cor, _rh_log); }
-  u3_noun u3qi_rh_sin(u3_atom a)   { softfloat_roundingMode=softfloat_round_near_even; return _rh_out(_rh_sin(_rh_in(a))); }
-  u3_noun u3wi_rh_sin(u3_noun cor) { return _rh_jet(cor, _rh_sin); }
-  u3_noun u3qi_rh_cos(u3_atom a)   { softfloat_roundingMode=softfloat_round_near_even; return _rh_out(_rh_cos(_rh_in(a))); }
-  u3_noun u3wi_rh_cos(u3_noun cor) { return _rh_jet(cor, _rh_cos); }
-  u3_noun u3qi_rh_tan(u3_atom a)   { softfloat_roundingMode=softfloat_round_near_even; return _rh_out(_rh_tan(_rh_in(a))); }
-  u3_noun u3wi_rh_tan(u3_noun cor) { return _rh_jet(cor, _rh_tan); }
-  u3_noun u3qi_rh_atan(u3_atom a)  { softfloat_roundingMode=softfloat_round_near_even; return _rh_out(_rh_atan(_rh_in(a))); }
-  u3_noun u3wi_rh_atan(u3_noun cor){ return _rh_jet(cor, _rh_atan); }
-  u3_noun u3qi_rh_asin(u3_atom a)  { softfloat_roundingMode=softfloat_round_near_even; return _rh_out(_rh_asin(_rh_in(a))); }
-  u3_noun u3wi_rh_asin(u3_noun cor){ return _rh_jet(cor, _rh_asin); }
-  u3_noun u3qi_rh_acos(u3_atom a)  { softfloat_roundingMode=softfloat_round_near_even; return _rh_out(_rh_acos(_rh_in(a))); }
-  u3_noun u3wi_rh_acos(u3_noun cor){ return _rh_jet(cor, _rh_acos); }
-  u3_noun u3qi_rh_sqt(u3_atom a)   { softfloat_roundingMode=softfloat_round_near_even; return _rh_out(_rh_sqt(_rh_in(a))); }
-  u3_noun u3wi_rh_sqt(u3_noun cor) { return _rh_jet(cor, _rh_sqt); }
-  u3_noun u3qi_rh_cbt(u3_atom a)   { softfloat_roundingMode=softfloat_round_near_even; return _rh_out(_rh_cbt(_rh_in(a))); }
-  u3_noun u3wi_rh_cbt(u3_noun cor) { return _rh_jet(cor, _rh_cbt); }
-  u3_noun u3qi_rh_log2(u3_atom a)  { softfloat_roundingMode=softfloat_round_near_even; return _rh_out(_rh_log2(_rh_in(a))); }
-  u3_noun u3wi_rh_log2(u3_noun cor){ return _rh_jet(cor, _rh_log2); }
-  u3_noun u3qi_rh_log10(u3_atom a) { softfloat_roundingMode=softfloat_round_near_even; return _rh_out(_rh_log10(_rh_in(a))); }
-  u3_noun u3wi_rh_log10(u3_noun cor){ return _rh_jet(cor, _rh_log10); }
-
-  u3_noun u3qi_rh_atan2(u3_atom y, u3_atom x) { softfloat_roundingMode=softfloat_round_near_even; return _rh_out(_rh_atan2(_rh_in(y), _rh_in(x))); }
-  u3_noun u3wi_rh_atan2(u3_noun cor){ return _rh_jet2(cor, _rh_atan2); }
-  u3_noun u3qi_rh_pow(u3_atom x, u3_atom n)   { softfloat_roundingMode=softfloat_round_near_even; return _rh_out(_rh_pow(_rh_in(x), _rh_in(n))); }
-  u3_noun u3wi_rh_pow(u3_noun cor) { return _rh_jet2(cor, _rh_pow); }
-  u3_noun u3qi_rh_pow_n(u3_atom x, u3_atom n) { softfloat_roundingMode=softfloat_round_near_even; return _rh_out(_rh_pow_n(_rh_in(x), _rh_in(n))); }
-  u3_noun u3wi_rh_pow_n(u3_noun cor){ return _rh_jet2(cor, _rh_pow_n); }
+    return U3QI_JST("rh", arm_c, c3__i754, 4, _rh_run2(fun, x, n, _rnd_of(u3r_at(60, cor))));  // door rounding r
+  }
+
+  //  sincos: [sin cos] off one reduction
+  static u3_noun _rh_run_sc(u3_atom a) {
+    int old = _math_push(softfloat_round_near_even);
+    float16_t s = _rh_look(_rh_t_sin, _rh_in(a)),
+              c = _rh_look(_rh_t_cos, _rh_in(a));
+    softfloat_roundingMode = old;
+    return u3nc(_rh_out(s), _rh_out(c));
+  }
+
+  u3_noun u3qi_rh_exp(u3_atom a)                   { return _rh_run_t(_rh_t_exp, a); }
+  u3_noun u3wi_rh_exp(u3_noun cor)                 { return _rh_jet_t(cor, "exp", _rh_t_exp); }
+  u3_noun u3qi_rh_log(u3_atom a)                   { return _rh_run_t(_rh_t_log, a); }
+  u3_noun u3wi_rh_log(u3_noun cor)                 { return _rh_jet_t(cor, "log", _rh_t_log); }
+  u3_noun u3qi_rh_sin(u3_atom a)                   { return _rh_run_t(_rh_t_sin, a); }
+  u3_noun u3wi_rh_sin(u3_noun cor)                 { return _rh_jet_t(cor, "sin", _rh_t_sin); }
+  u3_noun u3qi_rh_cos(u3_atom a)                   { return _rh_run_t(_rh_t_cos, a); }
+  u3_noun u3wi_rh_cos(u3_noun cor)                 { return _rh_jet_t(cor, "cos", _rh_t_cos); }
+  u3_noun u3qi_rh_tan(u3_atom a, c3_y rnd)         { return _rh_run_t(_rh_t_tan(_rnd_of(rnd)), a); }
+  u3_noun u3wi_rh_tan(u3_noun cor)
+  { return _rh_jet_t(cor, "tan", _rh_t_tan(_rnd_of(u3r_at(60, cor)))); }
+  u3_noun u3qi_rh_atan(u3_atom a)                  { return _rh_run_t(_rh_t_atan, a); }
+  u3_noun u3wi_rh_atan(u3_noun cor)                { return _rh_jet_t(cor, "atan", _rh_t_atan); }
+  u3_noun u3qi_rh_asin(u3_atom a)                  { return _rh_run_t(_rh_t_asin, a); }
+  u3_noun u3wi_rh_asin(u3_noun cor)                { return _rh_jet_t(cor, "asin", _rh_t_asin); }
+  u3_noun u3qi_rh_acos(u3_atom a)                  { return _rh_run_t(_rh_t_acos, a); }
+  u3_noun u3wi_rh_acos(u3_noun cor)                { return _rh_jet_t(cor, "acos", _rh_t_acos); }
+  u3_noun u3qi_rh_sqt(u3_atom a)                   { return _rh_run_t(_rh_t_sqt, a); }
+  u3_noun u3wi_rh_sqt(u3_noun cor)                 { return _rh_jet_t(cor, "sqt", _rh_t_sqt); }
+  u3_noun u3qi_rh_cbt(u3_atom a)                   { return _rh_run_t(_rh_t_cbt, a); }
+  u3_noun u3wi_rh_cbt(u3_noun cor)                 { return _rh_jet_t(cor, "cbt", _rh_t_cbt); }
+  u3_noun u3qi_rh_log2(u3_atom a)                  { return _rh_run_t(_rh_t_log2, a); }
+  u3_noun u3wi_rh_log2(u3_noun cor)                { return _rh_jet_t(cor, "log2", _rh_t_log2); }
+  u3_noun u3qi_rh_log10(u3_atom a)                 { return _rh_run_t(_rh_t_log10, a); }
+  u3_noun u3wi_rh_log10(u3_noun cor)               { return _rh_jet_t(cor, "log10", _rh_t_log10); }
+  u3_noun u3qi_rh_sincos(u3_atom a)                { return _rh_run_sc(a); }
+  u3_noun u3wi_rh_sincos(u3_noun cor)
+  {
+    u3_noun x = u3r_at(u3x_sam, cor);
+    if ( u3_none == x || c3n == u3ud(x) ) return u3m_bail(c3__exit);
+    return U3QI_JST("rh", "sincos", c3__i754, 4, _rh_run_sc(x));
+  }
+
+  u3_noun u3qi_rh_atan2(u3_atom y, u3_atom x, c3_y rnd) { return _rh_run2(_rh_atan2, y, x, _rnd_of(rnd)); }
+  u3_noun u3wi_rh_atan2(u3_noun cor)               { return _rh_jet2(cor, "atan2", _rh_atan2); }
+  u3_noun u3qi_rh_pow(u3_atom x, u3_atom n, c3_y rnd) { return _rh_run2(_rh_pow, x, n, _rnd_of(rnd)); }
+  u3_noun u3wi_rh_pow(u3_noun cor)                 { return _rh_jet2(cor, "pow", _rh_pow); }
+  u3_noun u3qi_rh_pow_n(u3_atom x, u3_atom n, c3_y rnd) { return _rh_run2(_rh_pow_n, x, n, _rnd_of(rnd)); }
+  u3_noun u3wi_rh_pow_n(u3_noun cor)               { return _rh_jet2(cor, "pow_n", _rh_pow_n); }
 
 /* @rq ABI wrappers.  @rq is a 128-bit atom: read/write TWO chubs (v[0]=low 64,
-** v[1]=high 64).  Wrappers set softfloat_roundingMode=near-even (kernels) and
-** _math_rnd from the door's r (axis 60) for the composites (tan/atan2/pow/
-** pow-n).  Word-agnostic chub I/O, same as @rd/@rs/@rh.
+** v[1]=high 64).  Wrappers run the kernels at near-even and pass the door's
+** r (axis 60) to the composites (tan/atan2/pow/pow-n) as rnd.  Word-agnostic
+** chub I/O, same as @rd/@rs/@rh.
 */
   static inline float128_t _rq_in(u3_atom a) {
     union quad s; s.w[0] = u3r_chub(0, a); s.w[1] = u3r_chub(1, a); return s.q;
@@ -2142,54 +2592,204 @@ typedef int64_t  c3_ds;
   static inline u3_noun _rq_out(float128_t v) {
     union quad s; s.q = v; return u3i_chubs(2, &s.w[0]);
   }
-  static u3_noun _rq_jet(u3_noun cor, float128_t (*fun)(float128_t)) {
+  static u3_noun _rq_run(float128_t (*fun)(float128_t), u3_atom a) {
+    int old = _math_push(softfloat_round_near_even);
+    float128_t r = fun(_rq_in(a));
+    softfloat_roundingMode = old;
+    return _rq_out(r);
+  }
+  static u3_noun _rq_run_r(float128_t (*fun)(float128_t, int), u3_atom a, int rnd) {
+    int old = _math_push(softfloat_round_near_even);
+    float128_t r = fun(_rq_in(a), rnd);
+    softfloat_roundingMode = old;
+    return _rq_out(r);
+  }
+  static u3_noun _rq_run2(float128_t (*fun)(float128_t, float128_t, int),
+                          u3_atom x, u3_atom n, int rnd) {
+    int old = _math_push(softfloat_round_near_even);
+    float128_t r = fun(_rq_in(x), _rq_in(n), rnd);
+    softfloat_roundingMode = old;
+    return _rq_out(r);
+  }
+  static u3_noun _rq_jet(u3_noun cor, const c3_c* arm_c, float128_t (*fun)(float128_t)) {
     u3_noun x = u3r_at(u3x_sam, cor);
     if ( u3_none == x || c3n == u3ud(x) ) return u3m_bail(c3__exit);
-    softfloat_roundingMode = softfloat_round_near_even;   // kernels run near-even
-    _math_rnd = _rnd_of(u3r_at(60, cor));        // door rounding r (for tan/cbt/log-2/log-10)
-    return _rq_out(fun(_rq_in(x)));
+    return U3QI_JST("rq", arm_c, c3__i754, 7, _rq_run(fun, x));
   }
-  static u3_noun _rq_jet2(u3_noun cor, float128_t (*fun)(float128_t, float128_t)) {
+  static u3_noun _rq_jet_r(u3_noun cor, const c3_c* arm_c, float128_t (*fun)(float128_t, int)) {
+    u3_noun x = u3r_at(u3x_sam, cor);
+    if ( u3_none == x || c3n == u3ud(x) ) return u3m_bail(c3__exit);
+    return U3QI_JST("rq", arm_c, c3__i754, 7, _rq_run_r(fun, x, _rnd_of(u3r_at(60, cor))));   // door rounding r
+  }
+  static u3_noun _rq_jet2(u3_noun cor, const c3_c* arm_c, float128_t (*fun)(float128_t, float128_t, int)) {
     u3_noun x, n;
     if ( c3n == u3r_mean(cor, u3x_sam_2, &x, u3x_sam_3, &n, 0) ||
          c3n == u3ud(x) || c3n == u3ud(n) ) {
       return u3m_bail(c3__exit);
     }
-    softfloat_roundingMode = softfloat_round_near_even;   // kernels run near-even
-    _math_rnd = _rnd_of(u3r_at(60, cor));        // door rounding r (composites)
-    return _rq_out(fun(_rq_in(x), _rq_in(n)));
-  }
-
-  u3_noun u3qi_rq_exp(u3_atom a)   { softfloat_roundingMode=softfloat_round_near_even; return _rq_out(_rq_exp(_rq_in(a))); }
-  u3_noun u3wi_rq_exp(u3_noun cor) { return _rq_jet(cor, _rq_exp); }
-  u3_noun u3qi_rq_log(u3_atom a)   { softfloat_roundingMode=softfloat_round_near_even; return _rq_out(_rq_log(_rq_in(a))); }
-  u3_noun u3wi_rq_log(u3_noun cor) { return _rq_jet(cor, _rq_log); }
-  u3_noun u3qi_rq_sin(u3_atom a)   { softfloat_roundingMode=softfloat_round_near_even; return _rq_out(_rq_sin(_rq_in(a))); }
-  u3_noun u3wi_rq_sin(u3_noun cor) { return _rq_jet(cor, _rq_sin); }
-  u3_noun u3qi_rq_cos(u3_atom a)   { softfloat_roundingMode=softfloat_round_near_even; return _rq_out(_rq_cos(_rq_in(a))); }
-  u3_noun u3wi_rq_cos(u3_noun cor) { return _rq_jet(cor, _rq_cos); }
-  u3_noun u3qi_rq_tan(u3_atom a)   { softfloat_roundingMode=softfloat_round_near_even; return _rq_out(_rq_tan(_rq_in(a))); }
-  u3_noun u3wi_rq_tan(u3_noun cor) { return _rq_jet(cor, _rq_tan); }
-  u3_noun u3qi_rq_atan(u3_atom a)  { softfloat_roundingMode=softfloat_round_near_even; return _rq_out(_rq_atan(_rq_in(a))); }
-  u3_noun u3wi_rq_atan(u3_noun cor){ return _rq_jet(cor, _rq_atan); }
-  u3_noun u3qi_rq_asin(u3_atom a)  { softfloat_roundingMode=softfloat_round_near_even; return _rq_out(_rq_asin(_rq_in(a))); }
-  u3_noun u3wi_rq_asin(u3_noun cor){ return _rq_jet(cor, _rq_asin); }
-  u3_noun u3qi_rq_acos(u3_atom a)  { softfloat_roundingMode=softfloat_round_near_even; return _rq_out(_rq_acos(_rq_in(a))); }
-  u3_noun u3wi_rq_acos(u3_noun cor){ return _rq_jet(cor, _rq_acos); }
-  u3_noun u3qi_rq_sqt(u3_atom a)   { softfloat_roundingMode=softfloat_round_near_even; return _rq_out(_rq_sqt(_rq_in(a))); }
-  u3_noun u3wi_rq_sqt(u3_noun cor) { return _rq_jet(cor, _rq_sqt); }
-  u3_noun u3qi_rq_cbt(u3_atom a)   { softfloat_roundingMode=softfloat_round_near_even; return _rq_out(_rq_cbt(_rq_in(a))); }
-  u3_noun u3wi_rq_cbt(u3_noun cor) { return _rq_jet(cor, _rq_cbt); }
-  u3_noun u3qi_rq_log2(u3_atom a)  { softfloat_roundingMode=softfloat_round_near_even; return _rq_out(_rq_log2(_rq_in(a))); }
-  u3_noun u3wi_rq_log2(u3_noun cor){ return _rq_jet(cor, _rq_log2); }
-  u3_noun u3qi_rq_log10(u3_atom a) { softfloat_roundingMode=softfloat_round_near_even; return _rq_out(_rq_log10(_rq_in(a))); }
-  u3_noun u3wi_rq_log10(u3_noun cor){ return _rq_jet(cor, _rq_log10); }
-
-  u3_noun u3qi_rq_atan2(u3_atom y, u3_atom x) { softfloat_roundingMode=softfloat_round_near_even; return _rq_out(_rq_atan2(_rq_in(y), _rq_in(x))); }
-  u3_noun u3wi_rq_atan2(u3_noun cor){ return _rq_jet2(cor, _rq_atan2); }
-  u3_noun u3qi_rq_pow(u3_atom x, u3_atom n)   { softfloat_roundingMode=softfloat_round_near_even; return _rq_out(_rq_pow(_rq_in(x), _rq_in(n))); }
-  u3_noun u3wi_rq_pow(u3_noun cor) { return _rq_jet2(cor, _rq_pow); }
-  u3_noun u3qi_rq_pow_n(u3_atom x, u3_atom n) { softfloat_roundingMode=softfloat_round_near_even; return _rq_out(_rq_pow_n(_rq_in(x), _rq_in(n))); }
-  u3_noun u3wi_rq_pow_n(u3_noun cor){ return _rq_jet2(cor, _rq_pow_n); }
+    return U3QI_JST("rq", arm_c, c3__i754, 7, _rq_run2(fun, x, n, _rnd_of(u3r_at(60, cor))));  // door rounding r
+  }
+
+  //  sincos: [sin cos] off one reduction
+  static u3_noun _rq_run_sc(u3_atom a) {
+    int old = _math_push(softfloat_round_near_even);
+    float128_t s, c; _rq_sincos(_rq_in(a), &s, &c);
+    softfloat_roundingMode = old;
+    return u3nc(_rq_out(s), _rq_out(c));
+  }
+
+  u3_noun u3qi_rq_exp(u3_atom a)                   { return _rq_run(_rq_exp, a); }
+  u3_noun u3wi_rq_exp(u3_noun cor)                 { return _rq_jet(cor, "exp", _rq_exp); }
+  u3_noun u3qi_rq_log(u3_atom a)                   { return _rq_run(_rq_log, a); }
+  u3_noun u3wi_rq_log(u3_noun cor)                 { return _rq_jet(cor, "log", _rq_log); }
+  u3_noun u3qi_rq_sin(u3_atom a)                   { return _rq_run(_rq_sin, a); }
+  u3_noun u3wi_rq_sin(u3_noun cor)                 { return _rq_jet(cor, "sin", _rq_sin); }
+  u3_noun u3qi_rq_cos(u3_atom a)                   { return _rq_run(_rq_cos, a); }
+  u3_noun u3wi_rq_cos(u3_noun cor)                 { return _rq_jet(cor, "cos", _rq_cos); }
+  u3_noun u3qi_rq_tan(u3_atom a, c3_y rnd)         { return _rq_run_r(_rq_tan, a, _rnd_of(rnd)); }
+  u3_noun u3wi_rq_tan(u3_noun cor)                 { return _rq_jet_r(cor, "tan", _rq_tan); }
+  u3_noun u3qi_rq_atan(u3_atom a)                  { return _rq_run(_rq_atan, a); }
+  u3_noun u3wi_rq_atan(u3_noun cor)                { return _rq_jet(cor, "atan", _rq_atan); }
+  u3_noun u3qi_rq_asin(u3_atom a)                  { return _rq_run(_rq_asin, a); }
+  u3_noun u3wi_rq_asin(u3_noun cor)                { return _rq_jet(cor, "asin", _rq_asin); }
+  u3_noun u3qi_rq_acos(u3_atom a)                  { return _rq_run(_rq_acos, a); }
+  u3_noun u3wi_rq_acos(u3_noun cor)                { return _rq_jet(cor, "acos", _rq_acos); }
+  u3_noun u3qi_rq_sqt(u3_atom a)                   { return _rq_run(_rq_sqt, a); }
+  u3_noun u3wi_rq_sqt(u3_noun cor)                 { return _rq_jet(cor, "sqt", _rq_sqt); }
+  u3_noun u3qi_rq_cbt(u3_atom a)                   { return _rq_run(_rq_cbt, a); }
+  u3_noun u3wi_rq_cbt(u3_noun cor)                 { return _rq_jet(cor, "cbt", _rq_cbt); }
+  u3_noun u3qi_rq_log2(u3_atom a)                  { return _rq_run(_rq_log2, a); }
+  u3_noun u3wi_rq_log2(u3_noun cor)                { return _rq_jet(cor, "log2", _rq_log2); }
+  u3_noun u3qi_rq_log10(u3_atom a)                 { return _rq_run(_rq_log10, a); }
+  u3_noun u3wi_rq_log10(u3_noun cor)               { return _rq_jet(cor, "log10", _rq_log10); }
+  u3_noun u3qi_rq_sincos(u3_atom a)                { return _rq_run_sc(a); }
+  u3_noun u3wi_rq_sincos(u3_noun cor)
+  {
+    u3_noun x = u3r_at(u3x_sam, cor);
+    if ( u3_none == x || c3n == u3ud(x) ) return u3m_bail(c3__exit);
+    return U3QI_JST("rq", "sincos", c3__i754, 7, _rq_run_sc(x));
+  }
+
+  u3_noun u3qi_rq_atan2(u3_atom y, u3_atom x, c3_y rnd) { return _rq_run2(_rq_atan2, y, x, _rnd_of(rnd)); }
+  u3_noun u3wi_rq_atan2(u3_noun cor)               { return _rq_jet2(cor, "atan2", _rq_atan2); }
+  u3_noun u3qi_rq_pow(u3_atom x, u3_atom n, c3_y rnd) { return _rq_run2(_rq_pow, x, n, _rnd_of(rnd)); }
+  u3_noun u3wi_rq_pow(u3_noun cor)                 { return _rq_jet2(cor, "pow", _rq_pow); }
+  u3_noun u3qi_rq_pow_n(u3_atom x, u3_atom n, c3_y rnd) { return _rq_run2(_rq_pow_n, x, n, _rnd_of(rnd)); }
+  u3_noun u3wi_rq_pow_n(u3_noun cor)               { return _rq_jet2(cor, "pow_n", _rq_pow_n); }
+
+/* Ray entry.  Runs the math arm named [fun_c] (a _math_un_c/_math_bi_c
+** name) over the [len] bloq-[bloq] lanes of ray data [x], and of [y] lane
+** for lane for the two-argument arms, in one pass: x's lanes are copied
+** once into the result slab, mapped in place by a batch driver, and minted
+** under the ray's 0x1 pin.  Same kernels, same rnd handling, so each lane
+** is bit-exact to the scalar jet.  u3_none for an arm or bloq it doesn't
+** cover.  Sizes are trusted; the caller checks the data against its shape.
+*/
+  u3_noun
+  u3qi_math_ray(const c3_c* fun_c,
+                c3_y        bloq,
+                c3_d        len,
+                u3_atom     x,
+                u3_atom     y,
+                c3_y        rnd)
+  {
+    c3_d un, bi;
+    for ( un = 0; (un < 12) && strcmp(fun_c, _math_un_c[un]); un++ ) {}
+    for ( bi = 0; (bi < 3) && strcmp(fun_c, _math_bi_c[bi]); bi++ ) {}
+
+    if ( (bloq < 4) || (bloq > 7) || ((12 == un) && (3 == bi)) ||
+         ((bi < 3) && (u3_none == y)) )
+    {
+      return u3_none;
+    }
+
+    c3_d     syz = len << (bloq - 3);
+    int      mod = _rnd_of(rnd);
+    u3i_slab sab_u;
+    u3i_slab_bare(&sab_u, 3, syz + 1);
+    sab_u.buf_w[sab_u.len_w - 1] = 0;
+    sab_u.buf_y[syz] = 0x1;
+    u3r_bytes(0, syz, sab_u.buf_y, x);
+
+    c3_y* y_y = 0;
+    if ( bi < 3 ) {
+      y_y = (c3_y*)u3a_malloc(syz);
+      u3r_bytes(0, syz, y_y, y);
+    }
+
+    int old = _math_push(softfloat_round_near_even);
+    switch ( bloq ) {
+      case 4: {
+        float16_t* r = (float16_t*)sab_u.buf_y;
+        if ( bi < 3 )        _rh_map2(_rh_bi[bi], r, (float16_t*)y_y, r, len, mod);
+        else if ( 11 == un ) _rh_map_t(_rh_t_tan(mod), r, r, len);
+        else                 _rh_map_t((_rh_t)un, r, r, len);
+      } break;
+
+      case 5: {
+        float32_t* r = (float32_t*)sab_u.buf_y;
+        if ( bi < 3 )        _rs_map2(_rs_bi[bi], r, (float32_t*)y_y, r, len, mod);
+        else if ( 11 == un ) _rs_map_r(_rs_tan, r, r, len, mod);
+        else                 _rs_map(_rs_un[un], r, r, len);
+      } break;
+
+      case 6: {
+        float64_t* r = (float64_t*)sab_u.buf_y;
+        if ( bi < 3 )        _rd_map2(_rd_bi[bi], r, (float64_t*)y_y, r, len, mod);
+        else                 _rd_map(_rd_un[un], r, r, len);
+      } break;
+
+      case 7: {
+        float128_t* r = (float128_t*)sab_u.buf_y;
+        if ( bi < 3 )        _rq_map2(_rq_bi[bi], r, (float128_t*)y_y, r, len, mod);
+        else if ( 11 == un ) _rq_map_r(_rq_tan, r, r, len, mod);
+        else                 _rq_map(_rq_un[un], r, r, len);
+      } break;
+    }
+    softfloat_roundingMode = old;
+
+    if ( y_y ) u3a_free(y_y);
+    return u3i_slab_mint(&sab_u);
+  }
+
+/* Ray sincos: [sin cos] data atoms for ray data [x], off one reduction per
+** lane (@rh: two table loads).  Same contract as u3qi_math_ray.
+*/
+  u3_noun
+  u3qi_math_ray_sincos(c3_y bloq, c3_d len, u3_atom x)
+  {
+    if ( (bloq < 4) || (bloq > 7) ) {
+      return u3_none;
+    }
+
+    c3_d     syz = len << (bloq - 3);
+    u3i_slab sin_u, cos_u;
+    u3i_slab_bare(&sin_u, 3, syz + 1);
+    u3i_slab_bare(&cos_u, 3, syz + 1);
+    sin_u.buf_w[sin_u.len_w - 1] = 0;
+    cos_u.buf_w[cos_u.len_w - 1] = 0;
+    sin_u.buf_y[syz] = 0x1;
+    cos_u.buf_y[syz] = 0x1;
+    u3r_bytes(0, syz, sin_u.buf_y, x);
+
+    int old = _math_push(softfloat_round_near_even);
+    switch ( bloq ) {
+      case 4: {
+        float16_t* s = (float16_t*)sin_u.buf_y;
+        _rh_map_t(_rh_t_cos, s, (float16_t*)cos_u.buf_y, len);
+        _rh_map_t(_rh_t_sin, s, s, len);
+      } break;
+
+      case 5: _rs_map_sc((float32_t*)sin_u.buf_y, (float32_t*)sin_u.buf_y,
+                         (float32_t*)cos_u.buf_y, len); break;
+      case 6: _rd_map_sc((float64_t*)sin_u.buf_y, (float64_t*)sin_u.buf_y,
+                         (float64_t*)cos_u.buf_y, len); break;
+      case 7: _rq_map_sc((float128_t*)sin_u.buf_y, (float128_t*)sin_u.buf_y,
+                         (float128_t*)cos_u.buf_y, len); break;
+    }
+    softfloat_roundingMode = old;
+
+    return u3nc(u3i_slab_mint(&sin_u), u3i_slab_mint(&cos_u));
+  }
 
 #endif
@@ -23,11 +23,16 @@
 #include "jets/q.h"
 #include "jets/w.h"
 #include "noun.h"
+#include "jets/i/jstat.h"  // per-jet statistics (U3_JET_STATS)
 #include "softunum.h"
 
 //  bloq from the pp door sample: gate axis 7 = door, door axis 6 = =bloq.
 #define _UNUM_BLOQ_AXIS 30
 
+//  a jet's product under the per-jet counters; posit64/128 show as punts.
+#define _UNUM_JST(arm, bloq, pro)                                            \
+  U3QI_JST("unum", arm, c3__unum, (c3_y)(bloq), pro)
+
 //  Read bloq (the door sample) from a gate core; c3n if absent/not-atom.
 static inline c3_t
 _unum_bloq(u3_noun cor, c3_d* out)
@@ -57,7 +62,7 @@ _unum_bloq(u3_noun cor, c3_d* out)
     if ( c3n == u3r_mean(cor, u3x_sam_2, &a, u3x_sam_3, &b, 0) ||            \
          c3n == u3ud(a) || c3n == u3ud(b) ) return u3m_bail(c3__exit);       \
     if ( c3n == _unum_bloq(cor, &bloq) ) return u3_none;                     \
-    return u3qi_unum_##nam(bloq, a, b);                                      \
+    return _UNUM_JST(#nam, bloq, u3qi_unum_##nam(bloq, a, b));               \
   }
 
 //  binary posit -> loobean comparison; returns & (c3y) / | (c3n).
@@ -77,7 +82,7 @@ _unum_bloq(u3_noun cor, c3_d* out)
     if ( c3n == u3r_mean(cor, u3x_sam_2, &a, u3x_sam_3, &b, 0) ||            \
          c3n == u3ud(a) || c3n == u3ud(b) ) return u3m_bail(c3__exit);       \
     if ( c3n == _unum_bloq(cor, &bloq) ) return u3_none;                     \
-    return u3qi_unum_##nam(bloq, a, b);                                      \
+    return _UNUM_JST(#nam, bloq, u3qi_unum_##nam(bloq, a, b));               \
   }
 
 //  unary posit -> posit op (neg/abs/sgn/sqt), bloq-dispatched.
@@ -96,7 +101,7 @@ _unum_bloq(u3_noun cor, c3_d* out)
     u3_noun a = u3r_at(u3x_sam, cor);  c3_d bloq;                            \
     if ( u3_none == a || c3n == u3ud(a) ) return u3m_bail(c3__exit);         \
     if ( c3n == _unum_bloq(cor, &bloq) ) return u3_none;                     \
-    return u3qi_unum_##nam(bloq, a);                                         \
+    return _UNUM_JST(#nam, bloq, u3qi_unum_##nam(bloq, a));                  \
   }
 
 _UNUM_BINOP(add, p8_add, p16_add, p32_add)
@@ -141,7 +146,7 @@ _UNUM_UNOP(sqt, p8_sqrt, p16_sqrt, p32_sqrt)
       return u3m_bail(c3__exit);
     }
     if ( c3n == _unum_bloq(cor, &bloq) ) return u3_none;
-    return u3qi_unum_fma(bloq, a, b, c);
+    return _UNUM_JST("fma", bloq, u3qi_unum_fma(bloq, a, b, c));
   }
 
 //  Elementary / transcendental functions.  Unary ones (incl. log-2/log-10,
@@ -185,7 +190,7 @@ _UNUM_BINOP(pow, p8_pow, p16_pow, p32_pow)
     if ( c3n == u3r_mean(cor, u3x_sam_2, &x, u3x_sam_3, &p, 0) ||
          c3n == u3ud(x) || c3n == u3ud(p) ) return u3m_bail(c3__exit);
     if ( c3n == _unum_bloq(cor, &bloq) ) return u3_none;
-    return u3qi_unum_pow_n(bloq, x, p);
+    return _UNUM_JST("pow_n", bloq, u3qi_unum_pow_n(bloq, x, p));
   }
 
 //  Rounding to integral value.  The Hoon rnd/flr/cel are eta-expanded into
@@ -215,7 +220,7 @@ _UNUM_UNOP(cel, p8_ceil, p16_ceil, p32_ceil)
     u3_noun v = u3r_at(u3x_sam, cor);  c3_d bloq;
     if ( u3_none == v || c3n == u3ud(v) ) return u3m_bail(c3__exit);
     if ( c3n == _unum_bloq(cor, &bloq) ) return u3_none;
-    return u3qi_unum_sun(bloq, v);
+    return _UNUM_JST("sun", bloq, u3qi_unum_sun(bloq, v));
   }
 
 /* ++san:pp -- @s -> posit.  Decode the Hoon signed atom (even 2m -> +m,
@@ -241,7 +246,7 @@ _UNUM_UNOP(cel, p8_ceil, p16_ceil, p32_ceil)
     u3_noun v = u3r_at(u3x_sam, cor);  c3_d bloq;
     if ( u3_none == v || c3n == u3ud(v) ) return u3m_bail(c3__exit);
     if ( c3n == _unum_bloq(cor, &bloq) ) return u3_none;
-    return u3qi_unum_san(bloq, v);
+    return _UNUM_JST("san", bloq, u3qi_unum_san(bloq, v));
   }
 
 /* ++toi:pp -- posit -> (unit @s).  NaR -> ~ (none); else [~ @s] with the
@@ -268,7 +273,7 @@ _UNUM_UNOP(cel, p8_ceil, p16_ceil, p32_ceil)
     u3_noun p = u3r_at(u3x_sam, cor);  c3_d bloq;
     if ( u3_none == p || c3n == u3ud(p) ) return u3m_bail(c3__exit);
     if ( c3n == _unum_bloq(cor, &bloq) ) return u3_none;
-    return u3qi_unum_toi(bloq, p);
+    return _UNUM_JST("toi", bloq, u3qi_unum_toi(bloq, p));
   }
 
 /* ++is-close:pp -- |a - b| <= tol, a loobean.  Ternary sample [a b tol].
@@ -294,7 +299,7 @@ _UNUM_UNOP(cel, p8_ceil, p16_ceil, p32_ceil)
       return u3m_bail(c3__exit);
     }
     if ( c3n == _unum_bloq(cor, &bloq) ) return u3_none;
-    return u3qi_unum_is_close(bloq, a, b, tol);
+    return _UNUM_JST("is_close", bloq, u3qi_unum_is_close(bloq, a, b, tol));
   }
 
 //  IEEE-754 conversion (value-based).  The posit width is bloq; the float width
@@ -315,7 +320,7 @@ _UNUM_UNOP(cel, p8_ceil, p16_ceil, p32_ceil)
     u3_noun p = u3r_at(u3x_sam, cor);  c3_d bloq;                            \
     if ( u3_none == p || c3n == u3ud(p) ) return u3m_bail(c3__exit);         \
     if ( c3n == _unum_bloq(cor, &bloq) ) return u3_none;                     \
-    return u3qi_unum_##nam(bloq, p);                                         \
+    return _UNUM_JST(#nam, bloq, u3qi_unum_##nam(bloq, p));                  \
   }
 
 #define _UNUM_FROM(nam, f8, f16, f32)                                        \
@@ -333,7 +338,7 @@ _UNUM_UNOP(cel, p8_ceil, p16_ceil, p32_ceil)
     u3_noun r = u3r_at(u3x_sam, cor);  c3_d bloq;                            \
     if ( u3_none == r || c3n == u3ud(r) ) return u3m_bail(c3__exit);         \
     if ( c3n == _unum_bloq(cor, &bloq) ) return u3_none;                     \
-    return u3qi_unum_##nam(bloq, r);                                         \
+    return _UNUM_JST(#nam, bloq, u3qi_unum_##nam(bloq, r));                  \
   }
 
 _UNUM_TO(to_rh, p8_to_rh, p16_to_rh, p32_to_rh)
@@ -363,7 +368,7 @@ _UNUM_FROM(from_rd, p8_from_rd, p16_from_rd, p32_from_rd)
     u3_noun p = u3r_at(u3x_sam, cor);  c3_d bloq;
     if ( u3_none == p || c3n == u3ud(p) ) return u3m_bail(c3__exit);
     if ( c3n == _unum_bloq(cor, &bloq) ) return u3_none;
-    return u3qi_unum_to_rq(bloq, p);
+    return _UNUM_JST("to_rq", bloq, u3qi_unum_to_rq(bloq, p));
   }
 
 /* ++from-rq:pp -- binary128 (2-chub input) -> posit.
@@ -388,7 +393,7 @@ _UNUM_FROM(from_rd, p8_from_rd, p16_from_rd, p32_from_rd)
     u3_noun r = u3r_at(u3x_sam, cor);  c3_d bloq;
     if ( u3_none == r || c3n == u3ud(r) ) return u3m_bail(c3__exit);
     if ( c3n == _unum_bloq(cor, &bloq) ) return u3_none;
-    return u3qi_unum_from_rq(bloq, r);
+    return _UNUM_JST("from_rq", bloq, u3qi_unum_from_rq(bloq, r));
   }
 
 //  Quire: a 16n-bit exact accumulator, marshalled to/from SoftUnum's uint64
@@ -420,7 +425,7 @@ _UNUM_FROM(from_rd, p8_from_rd, p16_from_rd, p32_from_rd)
     u3_noun p = u3r_at(u3x_sam, cor);  c3_d bloq;
     if ( u3_none == p || c3n == u3ud(p) ) return u3m_bail(c3__exit);
     if ( c3n == _unum_bloq(cor, &bloq) ) return u3_none;
-    return u3qi_unum_p_to_q(bloq, p);
+    return _UNUM_JST("p_to_q", bloq, u3qi_unum_p_to_q(bloq, p));
   }
 
   u3_noun
@@ -442,7 +447,7 @@ _UNUM_FROM(from_rd, p8_from_rd, p16_from_rd, p32_from_rd)
     u3_noun q = u3r_at(u3x_sam, cor);  c3_d bloq;
     if ( u3_none == q || c3n == u3ud(q) ) return u3m_bail(c3__exit);
     if ( c3n == _unum_bloq(cor, &bloq) ) return u3_none;
-    return u3qi_unum_q_to_p(bloq, q);
+    return _UNUM_JST("q_to_p", bloq, u3qi_unum_q_to_p(bloq, q));
   }
 
   u3_noun
@@ -464,7 +469,7 @@ _UNUM_FROM(from_rd, p8_from_rd, p16_from_rd, p32_from_rd)
     u3_noun q = u3r_at(u3x_sam, cor);  c3_d bloq;
     if ( u3_none == q || c3n == u3ud(q) ) return u3m_bail(c3__exit);
     if ( c3n == _unum_bloq(cor, &bloq) ) return u3_none;
-    return u3qi_unum_q_negate(bloq, q);
+    return _UNUM_JST("q_negate", bloq, u3qi_unum_q_negate(bloq, q));
   }
 
 //  q-mul-add / q-mul-sub: (quire, posit, posit) -> quire.
@@ -487,7 +492,7 @@ _UNUM_FROM(from_rd, p8_from_rd, p16_from_rd, p32_from_rd)
          c3n == u3ud(q) || c3n == u3ud(a) || c3n == u3ud(b) )               \
       return u3m_bail(c3__exit);                                             \
     if ( c3n == _unum_bloq(cor, &bloq) ) return u3_none;                     \
-    return u3qi_unum_##nam(bloq, q, a, b);                                   \
+    return _UNUM_JST(#nam, bloq, u3qi_unum_##nam(bloq, q, a, b));            \
   }
 
 _UNUM_QMA(q_mul_add, p8_q_mul_add, p16_q_mul_add, p32_q_mul_add)
@@ -511,7 +516,7 @@ _UNUM_QMA(q_mul_sub, p8_q_mul_sub, p16_q_mul_sub, p32_q_mul_sub)
     if ( c3n == u3r_mean(cor, u3x_sam_2, &q, u3x_sam_3, &p, 0) ||            \
          c3n == u3ud(q) || c3n == u3ud(p) ) return u3m_bail(c3__exit);       \
     if ( c3n == _unum_bloq(cor, &bloq) ) return u3_none;                     \
-    return u3qi_unum_##nam(bloq, q, p);                                      \
+    return _UNUM_JST(#nam, bloq, u3qi_unum_##nam(bloq, q, p));               \
   }
 
 _UNUM_QAP(q_add_p, p8_q_add_p, p16_q_add_p, p32_q_add_p)
@@ -535,7 +540,7 @@ _UNUM_QAP(q_sub_p, p8_q_sub_p, p16_q_sub_p, p32_q_sub_p)
     if ( c3n == u3r_mean(cor, u3x_sam_2, &x, u3x_sam_3, &y, 0) ||            \
          c3n == u3ud(x) || c3n == u3ud(y) ) return u3m_bail(c3__exit);       \
     if ( c3n == _unum_bloq(cor, &bloq) ) return u3_none;                     \
-    return u3qi_unum_##nam(bloq, x, y);                                      \
+    return _UNUM_JST(#nam, bloq, u3qi_unum_##nam(bloq, x, y));               \
   }
 
 _UNUM_QAQ(q_add_q, p8_q_add_q, p16_q_add_q, p32_q_add_q)
@@ -575,5 +580,5 @@ _UNUM_QAQ(q_sub_q, p8_q_sub_q, p16_q_sub_q, p32_q_sub_q)
       return u3m_bail(c3__exit);
     }
     if ( c3n == _unum_bloq(cor, &bloq) ) return u3_none;
-    return u3qi_unum_fdp(bloq, av, bv);
+    return _UNUM_JST("fdp", bloq, u3qi_unum_fdp(bloq, av, bv));
   }
@@ -261,34 +261,41 @@
     u3_noun u3qfp_nepo(u3_noun, u3_noun);
     u3_noun u3qfp_rake(u3_noun);
 
-    u3_noun u3qi_la_add_i754(u3_noun, u3_noun, u3_noun, u3_noun);
-    u3_noun u3qi_la_sub_i754(u3_noun, u3_noun, u3_noun, u3_noun);
-    u3_noun u3qi_la_mul_i754(u3_noun, u3_noun, u3_noun, u3_noun);
-    u3_noun u3qi_la_div_i754(u3_noun, u3_noun, u3_noun, u3_noun);
-    u3_noun u3qi_la_mod_i754(u3_noun, u3_noun, u3_noun, u3_noun);
-    u3_noun u3qi_la_adds_i754(u3_noun, u3_noun, u3_noun, u3_noun);
-    u3_noun u3qi_la_subs_i754(u3_noun, u3_noun, u3_noun, u3_noun);
-    u3_noun u3qi_la_muls_i754(u3_noun, u3_noun, u3_noun, u3_noun);
-    u3_noun u3qi_la_divs_i754(u3_noun, u3_noun, u3_noun, u3_noun);
-    u3_noun u3qi_la_mods_i754(u3_noun, u3_noun, u3_noun, u3_noun);
-    u3_noun u3qi_la_dot_i754(u3_noun, u3_noun, u3_noun, u3_noun);
+    u3_noun u3qi_la_add_i754(u3_noun, u3_noun, u3_noun, u3_noun, c3_y);
+    u3_noun u3qi_la_sub_i754(u3_noun, u3_noun, u3_noun, u3_noun, c3_y);
+    u3_noun u3qi_la_mul_i754(u3_noun, u3_noun, u3_noun, u3_noun, c3_y);
+    u3_noun u3qi_la_div_i754(u3_noun, u3_noun, u3_noun, u3_noun, c3_y);
+    u3_noun u3qi_la_mod_i754(u3_noun, u3_noun, u3_noun, u3_noun, c3_y);
+    u3_noun u3qi_la_adds_i754(u3_noun, u3_noun, u3_noun, u3_noun, c3_y);
+    u3_noun u3qi_la_subs_i754(u3_noun, u3_noun, u3_noun, u3_noun, c3_y);
+    u3_noun u3qi_la_muls_i754(u3_noun, u3_noun, u3_noun, u3_noun, c3_y);
+    u3_noun u3qi_la_divs_i754(u3_noun, u3_noun, u3_noun, u3_noun, c3_y);
+    u3_noun u3qi_la_mods_i754(u3_noun, u3_noun, u3_noun, u3_noun, c3_y);
+    u3_noun u3qi_la_dot_i754(u3_noun, u3_noun, u3_noun, u3_noun, c3_y);
+    u3_noun u3qi_la_dot_cplx(u3_noun, u3_noun, u3_noun, u3_noun, c3_y);
+    u3_noun u3qi_la_dotc_cplx(u3_noun, u3_noun, u3_noun, u3_noun, c3_y);
+    u3_noun u3qi_la_dot_unum(u3_noun, u3_noun, u3_noun, u3_noun);
     u3_noun u3qi_la_diag(u3_noun, u3_noun, u3_noun);
     u3_noun u3qi_la_transpose(u3_noun, u3_noun, u3_noun);
-    u3_noun u3qi_la_cumsum_i754(u3_noun, u3_noun, u3_noun);
+    u3_noun u3qi_la_permute(u3_noun, u3_noun, u3_noun, u3_noun, u3_noun, u3_noun);
+    u3_noun u3qi_la_cumsum_i754(u3_noun, u3_noun, u3_noun, c3_y);
     u3_noun u3qi_la_argmin_i754(u3_noun, u3_noun, u3_noun);
     u3_noun u3qi_la_argmax_i754(u3_noun, u3_noun, u3_noun);
     u3_noun u3qi_la_ravel_i754(u3_noun, u3_noun, u3_noun);
     u3_noun u3qi_la_min_i754(u3_noun, u3_noun, u3_noun);
     u3_noun u3qi_la_max_i754(u3_noun, u3_noun, u3_noun);
-    u3_noun u3qi_la_linspace_i754(u3_noun, u3_noun, u3_noun, u3_noun);
-    u3_noun u3qi_la_range_i754(u3_noun, u3_noun, u3_noun, u3_noun);
+    u3_noun u3qi_la_linspace_i754(u3_noun, u3_noun, u3_noun, u3_noun, c3_y);
+    u3_noun u3qi_la_range_i754(u3_noun, u3_noun, u3_noun, u3_noun, c3_y);
     u3_noun u3qi_la_abs_i754(u3_noun, u3_noun, u3_noun);
     u3_noun u3qi_la_gth_i754(u3_noun, u3_noun, u3_noun, u3_noun);
     u3_noun u3qi_la_gte_i754(u3_noun, u3_noun, u3_noun, u3_noun);
     u3_noun u3qi_la_lth_i754(u3_noun, u3_noun, u3_noun, u3_noun);
     u3_noun u3qi_la_lte_i754(u3_noun, u3_noun, u3_noun, u3_noun);
-    u3_noun u3qi_la_trace_i754(u3_noun, u3_noun, u3_noun);
-    u3_noun u3qi_la_mmul_i754(u3_noun, u3_noun, u3_noun, u3_noun, u3_noun);
+    u3_noun u3qi_la_trace_i754(u3_noun, u3_noun, u3_noun, c3_y);
+    u3_noun u3qi_la_mmul_i754(u3_noun, u3_noun, u3_noun, u3_noun, u3_noun, c3_y);
+    u3_noun u3qi_la_mmul_cplx(u3_noun, u3_noun, u3_noun, u3_noun, u3_noun, c3_y);
+    u3_noun u3qi_la_mmul_unum(u3_noun, u3_noun, u3_noun, u3_noun, u3_noun);
+    u3_noun u3qi_la_mmul_fixp(u3_noun, u3_noun, u3_noun, u3_noun, u3_noun, u3_noun);
 
     u3_noun u3qi_rd_exp(u3_noun);
     u3_noun u3qi_rd_log(u3_noun);
@@ -296,61 +303,68 @@
     u3_noun u3qi_rd_cos(u3_atom);
     u3_noun u3qi_rd_tan(u3_atom);
     u3_noun u3qi_rd_atan(u3_atom);
-    u3_noun u3qi_rd_atan2(u3_atom, u3_atom);
+    u3_noun u3qi_rd_atan2(u3_atom, u3_atom, c3_y);
     u3_noun u3qi_rd_asin(u3_atom);
     u3_noun u3qi_rd_acos(u3_atom);
     u3_noun u3qi_rd_sqt(u3_atom);
     u3_noun u3qi_rd_cbt(u3_atom);
-    u3_noun u3qi_rd_pow(u3_atom, u3_atom);
-    u3_noun u3qi_rd_pow_n(u3_atom, u3_atom);
+    u3_noun u3qi_rd_pow(u3_atom, u3_atom, c3_y);
+    u3_noun u3qi_rd_pow_n(u3_atom, u3_atom, c3_y);
     u3_noun u3qi_rd_log2(u3_atom);
     u3_noun u3qi_rd_log10(u3_atom);
+    u3_noun u3qi_rd_sincos(u3_atom);
     u3_noun u3qi_rs_exp(u3_atom);
     u3_noun u3qi_rs_log(u3_atom);
     u3_noun u3qi_rs_sin(u3_atom);
     u3_noun u3qi_rs_cos(u3_atom);
-    u3_noun u3qi_rs_tan(u3_atom);
+    u3_noun u3qi_rs_tan(u3_atom, c3_y);
     u3_noun u3qi_rs_atan(u3_atom);
-    u3_noun u3qi_rs_atan2(u3_atom, u3_atom);
+    u3_noun u3qi_rs_atan2(u3_atom, u3_atom, c3_y);
     u3_noun u3qi_rs_asin(u3_atom);
     u3_noun u3qi_rs_acos(u3_atom);
     u3_noun u3qi_rs_sqt(u3_atom);
     u3_noun u3qi_rs_cbt(u3_atom);
-    u3_noun u3qi_rs_pow(u3_atom, u3_atom);
-    u3_noun u3qi_rs_pow_n(u3_atom, u3_atom);
+    u3_noun u3qi_rs_pow(u3_atom, u3_atom, c3_y);
+    u3_noun u3qi_rs_pow_n(u3_atom, u3_atom, c3_y);
     u3_noun u3qi_rs_log2(u3_atom);
     u3_noun u3qi_rs_log10(u3_atom);
+    u3_noun u3qi_rs_sincos(u3_atom);
     u3_noun u3qi_rh_exp(u3_atom);
     u3_noun u3qi_rh_log(u3_atom);
     u3_noun u3qi_rh_sin(u3_atom);
     u3_noun u3qi_rh_cos(u3_atom);
-    u3_noun u3qi_rh_tan(u3_atom);
+    u3_noun u3qi_rh_tan(u3_atom, c3_y);
     u3_noun u3qi_rh_atan(u3_atom);
-    u3_noun u3qi_rh_atan2(u3_atom, u3_atom);
+    u3_noun u3qi_rh_atan2(u3_atom, u3_atom, c3_y);
     u3_noun u3qi_rh_asin(u3_atom);
     u3_noun u3qi_rh_acos(u3_atom);
     u3_noun u3qi_rh_sqt(u3_atom);
     u3_noun u3qi_rh_cbt(u3_atom);
-    u3_noun u3qi_rh_pow(u3_atom, u3_atom);
-    u3_noun u3qi_rh_pow_n(u3_atom, u3_atom);
+    u3_noun u3qi_rh_pow(u3_atom, u3_atom, c3_y);
+    u3_noun u3qi_rh_pow_n(u3_atom, u3_atom, c3_y);
     u3_noun u3qi_rh_log2(u3_atom);
     u3_noun u3qi_rh_log10(u3_atom);
+    u3_noun u3qi_rh_sincos(u3_atom);
 
     u3_noun u3qi_rq_exp(u3_atom);
     u3_noun u3qi_rq_log(u3_atom);
     u3_noun u3qi_rq_sin(u3_atom);
     u3_noun u3qi_rq_cos(u3_atom);
-    u3_noun u3qi_rq_tan(u3_atom);
+    u3_noun u3qi_rq_tan(u3_atom, c3_y);
     u3_noun u3qi_rq_atan(u3_atom);
-    u3_noun u3qi_rq_atan2(u3_atom, u3_atom);
+    u3_noun u3qi_rq_atan2(u3_atom, u3_atom, c3_y);
     u3_noun u3qi_rq_asin(u3_atom);
     u3_noun u3qi_rq_acos(u3_atom);
     u3_noun u3qi_rq_sqt(u3_atom);
     u3_noun u3qi_rq_cbt(u3_atom);
-    u3_noun u3qi_rq_pow(u3_atom, u3_atom);
-    u3_noun u3qi_rq_pow_n(u3_atom, u3_atom);
+    u3_noun u3qi_rq_pow(u3_atom, u3_atom, c3_y);
+    u3_noun u3qi_rq_pow_n(u3_atom, u3_atom, c3_y);
     u3_noun u3qi_rq_log2(u3_atom);
     u3_noun u3qi_rq_log10(u3_atom);
+    u3_noun u3qi_rq_sincos(u3_atom);
+
+    u3_noun u3qi_math_ray(const c3_c*, c3_y, c3_d, u3_atom, u3_atom, c3_y);
+    u3_noun u3qi_math_ray_sincos(c3_y, c3_d, u3_atom);
 
 #   define u3qfu_van_fan  28
 #   define u3qfu_van_rib  58
@@ -893,13 +893,22 @@ static u3j_harm _135_non__lagoon_muls_a[] = {{".2", u3wi_la_muls}, {}};
 static u3j_harm _135_non__lagoon_divs_a[] = {{".2", u3wi_la_divs}, {}};
 static u3j_harm _135_non__lagoon_mods_a[] = {{".2", u3wi_la_mods}, {}};
 static u3j_harm _135_non__lagoon_dot_a[]  = {{".2", u3wi_la_dot}, {}};
+static u3j_harm _135_non__lagoon_dotc_a[] = {{".2", u3wi_la_dotc}, {}};
 static u3j_harm _135_non__lagoon_trans_a[] ={{".2", u3wi_la_transpose}, {}};
+static u3j_harm _135_non__lagoon_permute_a[]={{".2", u3wi_la_permute}, {}};
 static u3j_harm _135_non__lagoon_cumsum_a[]={{".2", u3wi_la_cumsum}, {}};
 static u3j_harm _135_non__lagoon_argmin_a[]={{".2", u3wi_la_argmin}, {}};
 static u3j_harm _135_non__lagoon_argmax_a[]={{".2", u3wi_la_argmax}, {}};
 static u3j_harm _135_non__lagoon_ravel_a[]={{".2", u3wi_la_ravel}, {}};
 static u3j_harm _135_non__lagoon_min_a[]  = {{".2", u3wi_la_min}, {}};
 static u3j_harm _135_non__lagoon_max_a[]  = {{".2", u3wi_la_max}, {}};
+static u3j_harm _135_non__lagoon_prod_a[] = {{".2", u3wi_la_prod}, {}};
+static u3j_harm _135_non__lagoon_sum_axis_a[] = {{".2", u3wi_la_sum_axis}, {}};
+static u3j_harm _135_non__lagoon_prod_axis_a[] = {{".2", u3wi_la_prod_axis}, {}};
+static u3j_harm _135_non__lagoon_max_axis_a[] = {{".2", u3wi_la_max_axis}, {}};
+static u3j_harm _135_non__lagoon_min_axis_a[] = {{".2", u3wi_la_min_axis}, {}};
+static u3j_harm _135_non__lagoon_argmax_axis_a[] = {{".2", u3wi_la_argmax_axis}, {}};
+static u3j_harm _135_non__lagoon_argmin_axis_a[] = {{".2", u3wi_la_argmin_axis}, {}};
 static u3j_harm _135_non__lagoon_linspace_a[]={{".2", u3wi_la_linspace}, {}};
 static u3j_harm _135_non__lagoon_range_a[]= {{".2", u3wi_la_range}, {}};
 static u3j_harm _135_non__lagoon_abs_a[]  = {{".2", u3wi_la_abs}, {}};
@@ -910,6 +919,9 @@ static u3j_harm _135_non__lagoon_lte_a[]  = {{".2", u3wi_la_lte}, {}};
 static u3j_harm _135_non__lagoon_diag_a[] = {{".2", u3wi_la_diag}, {}};
 static u3j_harm _135_non__lagoon_trace_a[]= {{".2", u3wi_la_trace}, {}};
 static u3j_harm _135_non__lagoon_mmul_a[] = {{".2", u3wi_la_mmul}, {}};
+static u3j_harm _135_non__lagoon_el_wise_op_a[] = {{".2", u3wi_la_el_wise_op}, {}};
+static u3j_harm _135_non__lagoon_bin_op_a[] = {{".2", u3wi_la_bin_op}, {}};
+static u3j_harm _135_non__lagoon_ter_op_a[] = {{".2", u3wi_la_ter_op}, {}};
 static u3j_harm _135_non__mice_a[] = {{".2", u3we_mice}, {}};
 
 static u3j_core _135_non__la_core_d[] =
@@ -924,13 +936,22 @@ static u3j_core _135_non__la_core_d[] =
     { "div-scal", 7, _135_non__lagoon_divs_a, 0, no_hashes },
     { "mod-scal", 7, _135_non__lagoon_mods_a, 0, no_hashes },
     { "dot",      7, _135_non__lagoon_dot_a,  0, no_hashes },
+    { "dotc",     7, _135_non__lagoon_dotc_a, 0, no_hashes },
     { "transpose",7, _135_non__lagoon_trans_a, 0, no_hashes },
+    { "permute",  7, _135_non__lagoon_permute_a, 0, no_hashes },
     { "cumsum",   7, _135_non__lagoon_cumsum_a, 0, no_hashes },
     { "argmin",   7, _135_non__lagoon_argmin_a, 0, no_hashes },
     { "argmax",   7, _135_non__lagoon_argmax_a, 0, no_hashes },
     { "ravel",    7, _135_non__lagoon_ravel_a, 0, no_hashes },
     { "min",      7, _135_non__lagoon_min_a, 0, no_hashes },
     { "max",      7, _135_non__lagoon_max_a, 0, no_hashes },
+    { "prod",     7, _135_non__lagoon_prod_a, 0, no_hashes },
+    { "sum-axis", 7, _135_non__lagoon_sum_axis_a, 0, no_hashes },
+    { "prod-axis", 7, _135_non__lagoon_prod_axis_a, 0, no_hashes },
+    { "max-axis", 7, _135_non__lagoon_max_axis_a, 0, no_hashes },
+    { "min-axis", 7, _135_non__lagoon_min_axis_a, 0, no_hashes },
+    { "argmax-axis", 7, _135_non__lagoon_argmax_axis_a, 0, no_hashes },
+    { "argmin-axis", 7, _135_non__lagoon_argmin_axis_a, 0, no_hashes },
     { "linspace", 7, _135_non__lagoon_linspace_a, 0, no_hashes },
     { "range",    7, _135_non__lagoon_range_a, 0, no_hashes },
     { "abs",      7, _135_non__lagoon_abs_a, 0, no_hashes },
@@ -941,6 +962,9 @@ static u3j_core _135_non__la_core_d[] =
     { "diag",     7, _135_non__lagoon_diag_a, 0, no_hashes },
     { "trace",    7, _135_non__lagoon_trace_a,0, no_hashes },
     { "mmul",     7, _135_non__lagoon_mmul_a, 0, no_hashes },
+    { "el-wise-op", 7, _135_non__lagoon_el_wise_op_a, 0, no_hashes },
+    { "bin-op",   7, _135_non__lagoon_bin_op_a, 0, no_hashes },
+    { "ter-op",   7, _135_non__lagoon_ter_op_a, 0, no_hashes },
     {}
   };
 
@@ -949,6 +973,7 @@ static u3j_harm _135_non__math_rd_exp_a[] = {{".2", u3wi_rd_exp}, {}};
 static u3j_harm _135_non__math_rd_log_a[] = {{".2", u3wi_rd_log}, {}};
 static u3j_harm _135_non__math_rd_sin_a[] = {{".2", u3wi_rd_sin}, {}};
 static u3j_harm _135_non__math_rd_cos_a[] = {{".2", u3wi_rd_cos}, {}};
+static u3j_harm _135_non__math_rd_sincos_a[] = {{".2", u3wi_rd_sincos}, {}};
 static u3j_harm _135_non__math_rd_tan_a[] = {{".2", u3wi_rd_tan}, {}};
 static u3j_harm _135_non__math_rd_atan_a[] = {{".2", u3wi_rd_atan}, {}};
 static u3j_harm _135_non__math_rd_atan2_a[] = {{".2", u3wi_rd_atan2}, {}};
@@ -966,6 +991,7 @@ static u3j_core _135_non__math_rd_d[] =
     { "log", 7, _135_non__math_rd_log_a, 0, no_hashes },
     { "sin", 7, _135_non__math_rd_sin_a, 0, no_hashes },
     { "cos", 7, _135_non__math_rd_cos_a, 0, no_hashes },
+    { "sincos", 7, _135_non__math_rd_sincos_a, 0, no_hashes },
     { "tan", 7, _135_non__math_rd_tan_a, 0, no_hashes },
     { "atan", 7, _135_non__math_rd_atan_a, 0, no_hashes },
     { "atan2", 7, _135_non__math_rd_atan2_a, 0, no_hashes },
@@ -984,6 +1010,7 @@ static u3j_harm _135_non__math_rs_exp_a[] = {{".2", u3wi_rs_exp}, {}};
 static u3j_harm _135_non__math_rs_log_a[] = {{".2", u3wi_rs_log}, {}};
 static u3j_harm _135_non__math_rs_sin_a[] = {{".2", u3wi_rs_sin}, {}};
 static u3j_harm _135_non__math_rs_cos_a[] = {{".2", u3wi_rs_cos}, {}};
+static u3j_harm _135_non__math_rs_sincos_a[] = {{".2", u3wi_rs_sincos}, {}};
 static u3j_harm _135_non__math_rs_tan_a[] = {{".2", u3wi_rs_tan}, {}};
 static u3j_harm _135_non__math_rs_atan_a[] = {{".2", u3wi_rs_atan}, {}};
 static u3j_harm _135_non__math_rs_atan2_a[] = {{".2", u3wi_rs_atan2}, {}};
@@ -1001,6 +1028,7 @@ static u3j_core _135_non__math_rs_d[] =
     { "log", 7, _135_non__math_rs_log_a, 0, no_hashes },
     { "sin", 7, _135_non__math_rs_sin_a, 0, no_hashes },
     { "cos", 7, _135_non__math_rs_cos_a, 0, no_hashes },
+    { "sincos", 7, _135_non__math_rs_sincos_a, 0, no_hashes },
     { "tan", 7, _135_non__math_rs_tan_a, 0, no_hashes },
     { "atan", 7, _135_non__math_rs_atan_a, 0, no_hashes },
     { "atan2", 7, _135_non__math_rs_atan2_a, 0, no_hashes },
@@ -1019,6 +1047,7 @@ static u3j_harm _135_non__math_rh_exp_a[] = {{".2", u3wi_rh_exp}, {}};
 static u3j_harm _135_non__math_rh_log_a[] = {{".2", u3wi_rh_log}, {}};
 static u3j_harm _135_non__math_rh_sin_a[] = {{".2", u3wi_rh_sin}, {}};
 static u3j_harm _135_non__math_rh_cos_a[] = {{".2", u3wi_rh_cos}, {}};
+static u3j_harm _135_non__math_rh_sincos_a[] = {{".2", u3wi_rh_sincos}, {}};
 static u3j_harm _135_non__math_rh_tan_a[] = {{".2", u3wi_rh_tan}, {}};
 static u3j_harm _135_non__math_rh_atan_a[] = {{".2", u3wi_rh_atan}, {}};
 static u3j_harm _135_non__math_rh_atan2_a[] = {{".2", u3wi_rh_atan2}, {}};
@@ -1036,6 +1065,7 @@ static u3j_core _135_non__math_rh_d[] =
     { "log", 7, _135_non__math_rh_log_a, 0, no_hashes },
     { "sin", 7, _135_non__math_rh_sin_a, 0, no_hashes },
     { "cos", 7, _135_non__math_rh_cos_a, 0, no_hashes },
+    { "sincos", 7, _135_non__math_rh_sincos_a, 0, no_hashes },
     { "tan", 7, _135_non__math_rh_tan_a, 0, no_hashes },
     { "atan", 7, _135_non__math_rh_atan_a, 0, no_hashes },
     { "atan2", 7, _135_non__math_rh_atan2_a, 0, no_hashes },
@@ -1053,6 +1083,7 @@ static u3j_harm _135_non__math_rq_exp_a[] = {{".2", u3wi_rq_exp}, {}};
 static u3j_harm _135_non__math_rq_log_a[] = {{".2", u3wi_rq_log}, {}};
 static u3j_harm _135_non__math_rq_sin_a[] = {{".2", u3wi_rq_sin}, {}};
 static u3j_harm _135_non__math_rq_cos_a[] = {{".2", u3wi_rq_cos}, {}};
+static u3j_harm _135_non__math_rq_sincos_a[] = {{".2", u3wi_rq_sincos}, {}};
 static u3j_harm _135_non__math_rq_tan_a[] = {{".2", u3wi_rq_tan}, {}};
 static u3j_harm _135_non__math_rq_atan_a[] = {{".2", u3wi_rq_atan}, {}};
 static u3j_harm _135_non__math_rq_atan2_a[] = {{".2", u3wi_rq_atan2}, {}};
@@ -1070,6 +1101,7 @@ static u3j_core _135_non__math_rq_d[] =
     { "log", 7, _135_non__math_rq_log_a, 0, no_hashes },
     { "sin", 7, _135_non__math_rq_sin_a, 0, no_hashes },
     { "cos", 7, _135_non__math_rq_cos_a, 0, no_hashes },
+    { "sincos", 7, _135_non__math_rq_sincos_a, 0, no_hashes },
     { "tan", 7, _135_non__math_rq_tan_a, 0, no_hashes },
     { "atan", 7, _135_non__math_rq_atan_a, 0, no_hashes },
     { "atan2", 7, _135_non__math_rq_atan2_a, 0, no_hashes },
@@ -1098,6 +1130,44 @@ static u3j_core _135_non_d[] =
     {}
   };
 
+//  numerics saloon.hoon ray transcendentals, eig and eig-par: saloon -> sa-core -> <fn>
+static u3j_harm _135_saloon_sa_exp_a[] = {{".2", u3wi_sa_exp}, {}};
+static u3j_harm _135_saloon_sa_sin_a[] = {{".2", u3wi_sa_sin}, {}};
+static u3j_harm _135_saloon_sa_cos_a[] = {{".2", u3wi_sa_cos}, {}};
+static u3j_harm _135_saloon_sa_tan_a[] = {{".2", u3wi_sa_tan}, {}};
+static u3j_harm _135_saloon_sa_log_a[] = {{".2", u3wi_sa_log}, {}};
+static u3j_harm _135_saloon_sa_log10_a[] = {{".2", u3wi_sa_log10}, {}};
+static u3j_harm _135_saloon_sa_log2_a[] = {{".2", u3wi_sa_log2}, {}};
+static u3j_harm _135_saloon_sa_sqrt_a[] = {{".2", u3wi_sa_sqrt}, {}};
+static u3j_harm _135_saloon_sa_cbrt_a[] = {{".2", u3wi_sa_cbrt}, {}};
+static u3j_harm _135_saloon_sa_pow_n_a[] = {{".2", u3wi_sa_pow_n}, {}};
+static u3j_harm _135_saloon_sa_pow_a[] = {{".2", u3wi_sa_pow}, {}};
+static u3j_harm _135_saloon_sa_sincos_a[] = {{".2", u3wi_sa_sincos}, {}};
+static u3j_harm _135_saloon_sa_eig_a[] = {{".2", u3wi_sa_eig}, {}};
+static u3j_harm _135_saloon_sa_eig_par_a[] = {{".2", u3wi_sa_eig_par}, {}};
+static u3j_core _135_saloon_sa_d[] =
+  {
+    { "exp", 7, _135_saloon_sa_exp_a, 0, no_hashes },
+    { "sin", 7, _135_saloon_sa_sin_a, 0, no_hashes },
+    { "cos", 7, _135_saloon_sa_cos_a, 0, no_hashes },
+    { "tan", 7, _135_saloon_sa_tan_a, 0, no_hashes },
+    { "log", 7, _135_saloon_sa_log_a, 0, no_hashes },
+    { "log-10", 7, _135_saloon_sa_log10_a, 0, no_hashes },
+    { "log-2", 7, _135_saloon_sa_log2_a, 0, no_hashes },
+    { "sqrt", 7, _135_saloon_sa_sqrt_a, 0, no_hashes },
+    { "cbrt", 7, _135_saloon_sa_cbrt_a, 0, no_hashes },
+    { "pow-n", 7, _135_saloon_sa_pow_n_a, 0, no_hashes },
+    { "pow", 7, _135_saloon_sa_pow_a, 0, no_hashes },
+    { "sincos", 7, _135_saloon_sa_sincos_a, 0, no_hashes },
+    { "eig", 7, _135_saloon_sa_eig_a, 0, no_hashes },
+    { "eig-par", 7, _135_saloon_sa_eig_par_a, 0, no_hashes },
+    {}
+  };
+static u3j_core _135_saloon_d[] =
+  { { "sa-core", 7, 0, _135_saloon_sa_d, no_hashes },
+    {}
+  };
+
 
 static u3j_harm _135_hex_lia_run_v1_a[] = {{".2", u3we_lia_run_v1, c3y}, {}};
 
@@ -1151,6 +1221,7 @@ static u3j_core _135_hex_wasm_sur_d[] = {
 
 static u3j_core _135_hex_d[] =
   { { "non", 7, 0, _135_non_d, no_hashes },
+    { "saloon", 7, 0, _135_saloon_d, no_hashes },
 
     { "lull",   3, 0, _135_lull_d, no_hashes },
 
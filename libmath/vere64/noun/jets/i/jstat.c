@@ -0,0 +1,201 @@
+/// @file
+///
+/// Per-jet hot-path statistics for the numerics jets; see jets/i/jstat.h.
+///
+/// The table is a fixed open-addressed hash keyed by the addresses of the
+/// module and arm literals plus kind and bloq, so noting a call is a hash,
+/// a probe or two and four adds; nothing is allocated.  The jets run on the
+/// serf's main thread, so the counters are plain words.  Keys past the
+/// table's capacity are lumped into one overflow row rather than dropped.
+///
+/// MASTER COPY lives in urbit/numerics libmath/vere/noun/jets/i/jstat.c;
+/// applied by hand to the vere runtime.
+
+#include "noun.h"
+#include "jets/i/jstat.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define _JST_SIZE 1024      //  slots; a power of two
+
+typedef struct {
+  const c3_c* mod_c;        //  module ("la", "rd", "unum", ...); 0 if free
+  const c3_c* arm_c;        //  arm, as in the Hoon
+  c3_m        kind_m;       //  element kind mote, 0 if none
+  c3_y        bloq_y;
+  c3_d        cal_d;        //  calls
+  c3_d        pun_d;        //  calls that punted to the Hoon
+  c3_d        tot_d;        //  ns, total
+  c3_d        mar_d;        //  ns, marshalling
+} _jst_row;
+
+static _jst_row _jst_tab[_JST_SIZE];
+static _jst_row _jst_ovf = { "*", "(overflow)", 0, 0, 0, 0, 0, 0 };
+static c3_w     _jst_len_w;
+
+c3_o u3qi_jst_on_o = c3n;
+c3_d u3qi_jst_mar_d;
+
+static const c3_c* _jst_out_c;    //  U3_JET_STATS, if a file
+
+c3_d
+u3qi_jst_now(void)
+{
+  struct timespec tim_u;
+  clock_gettime(CLOCK_MONOTONIC, &tim_u);
+  return (c3_d)tim_u.tv_sec * 1000000000ULL + (c3_d)tim_u.tv_nsec;
+}
+
+void
+u3qi_jst_note(const c3_c* mod_c,
+              const c3_c* arm_c,
+              c3_m        kind_m,
+              c3_y        bloq_y,
+              c3_o        pun_o,
+              c3_d        tot_d,
+              c3_d        mar_d)
+{
+  c3_d has_d = ((c3_d)(uintptr_t)arm_c * 0x9e3779b97f4a7c15ULL)
+             ^ ((c3_d)(uintptr_t)mod_c >> 3)
+             ^ ((c3_d)kind_m << 8) ^ bloq_y;
+  c3_w idx_w = (c3_w)(has_d >> 40) & (_JST_SIZE - 1);
+  _jst_row* row_u = 0;
+
+  for ( c3_w i_w = 0; i_w < _JST_SIZE; i_w++ ) {
+    _jst_row* try_u = &_jst_tab[(idx_w + i_w) & (_JST_SIZE - 1)];
+
+    if ( 0 == try_u->mod_c ) {
+      if ( _jst_len_w < (_JST_SIZE / 4) * 3 ) {
+        try_u->mod_c  = mod_c;
+        try_u->arm_c  = arm_c;
+        try_u->kind_m = kind_m;
+        try_u->bloq_y = bloq_y;
+        _jst_len_w++;
+        row_u = try_u;
+      }
+      break;
+    }
+    if ( (arm_c == try_u->arm_c) && (mod_c == try_u->mod_c) &&
+         (kind_m == try_u->kind_m) && (bloq_y == try_u->bloq_y) )
+    {
+      row_u = try_u;
+      break;
+    }
+  }
+  if ( !row_u ) {
+    row_u = &_jst_ovf;
+  }
+
+  row_u->cal_d++;
+  row_u->pun_d += ( c3y == pun_o );
+  row_u->tot_d += tot_d;
+  row_u->mar_d += mar_d;
+}
+
+static int
+_jst_cmp(const void* a_v, const void* b_v)
+{
+  const _jst_row* a_u = *(const _jst_row* const*)a_v;
+  const _jst_row* b_u = *(const _jst_row* const*)b_v;
+
+  return ( a_u->tot_d < b_u->tot_d ) - ( a_u->tot_d > b_u->tot_d );
+}
+
+/* _jst_kind(): a kind mote as text, into [buf_c] (5 bytes).
+*/
+static const c3_c*
+_jst_kind(c3_m kind_m, c3_c* buf_c)
+{
+  if ( 0 == kind_m ) {
+    return "-";
+  }
+  for ( c3_w i_w = 0; i_w < 4; i_w++ ) {
+    buf_c[i_w] = (c3_c)((kind_m >> (8 * i_w)) & 0xff);
+  }
+  buf_c[4] = 0;
+  return buf_c;
+}
+
+void
+u3qi_jst_dump(FILE* fil_u)
+{
+  _jst_row* row_u[_JST_SIZE + 1];
+  c3_w      len_w = 0;
+  c3_d      cal_d = 0, pun_d = 0, tot_d = 0, mar_d = 0;
+
+  for ( c3_w i_w = 0; i_w < _JST_SIZE; i_w++ ) {
+    if ( _jst_tab[i_w].mod_c ) {
+      row_u[len_w++] = &_jst_tab[i_w];
+    }
+  }
+  if ( _jst_ovf.cal_d ) {
+    row_u[len_w++] = &_jst_ovf;
+  }
+  qsort(row_u, len_w, sizeof(_jst_row*), _jst_cmp);
+
+  for ( c3_w i_w = 0; i_w < len_w; i_w++ ) {
+    cal_d += row_u[i_w]->cal_d;
+    pun_d += row_u[i_w]->pun_d;
+    tot_d += row_u[i_w]->tot_d;
+    mar_d += row_u[i_w]->mar_d;
+  }
+  fprintf(fil_u, "jet stats: %u keys, %llu calls, %llu punts, "
+                 "%.3f ms (%.3f ms marshalling)\r\n",
+          (unsigned)len_w, (unsigned long long)cal_d, (unsigned long long)pun_d,
+          tot_d / 1e6, mar_d / 1e6);
+  fprintf(fil_u, "  %-5s %-12s %-4s %4s %12s %12s %12s %12s %6s\r\n",
+          "mod", "arm", "kind", "bloq", "calls", "punts",
+          "total-us", "marshal-us", "ns/call");
+
+  for ( c3_w i_w = 0; i_w < len_w; i_w++ ) {
+    _jst_row* r_u = row_u[i_w];
+    c3_c      kin_c[5];
+
+    fprintf(fil_u, "  %-5s %-12s %-4s %4u %12llu %12llu %12.1f %12.1f %6.0f\r\n",
+            r_u->mod_c, r_u->arm_c, _jst_kind(r_u->kind_m, kin_c),
+            r_u->bloq_y,
+            (unsigned long long)r_u->cal_d, (unsigned long long)r_u->pun_d,
+            r_u->tot_d / 1e3, r_u->mar_d / 1e3,
+            r_u->cal_d ? (double)r_u->tot_d / r_u->cal_d : 0.0);
+  }
+  fflush(fil_u);
+}
+
+void
+u3qi_jst_wipe(void)
+{
+  memset(_jst_tab, 0, sizeof(_jst_tab));
+  _jst_ovf.cal_d = _jst_ovf.pun_d = _jst_ovf.tot_d = _jst_ovf.mar_d = 0;
+  _jst_len_w = 0;
+  u3qi_jst_mar_d = 0;
+}
+
+static void
+_jst_exit(void)
+{
+  FILE* fil_u = _jst_out_c ? fopen(_jst_out_c, "a") : stderr;
+
+  if ( fil_u ) {
+    u3qi_jst_dump(fil_u);
+    if ( stderr != fil_u ) {
+      fclose(fil_u);
+    }
+  }
+}
+
+/* _jst_boot(): read U3_JET_STATS before the first jet can run.
+*/
+__attribute__((constructor)) static void
+_jst_boot(void)
+{
+  const c3_c* env_c = getenv("U3_JET_STATS");
+
+  if ( (0 == env_c) || (0 == *env_c) || (0 == strcmp(env_c, "0")) ) {
+    return;
+  }
+  u3qi_jst_on_o = c3y;
+  _jst_out_c = strcmp(env_c, "1") ? env_c : 0;
+  atexit(_jst_exit);
+}
@@ -0,0 +1,107 @@
+/// @file
+///
+/// Per-jet hot-path statistics for the numerics jets (Lagoon, libmath, unum):
+/// how often each jet fires, how often it punts (returns u3_none, so the Hoon
+/// arm runs instead), and where its wall time goes: marshalling (u3r_bytes,
+/// u3i_bytes, u3i_slab_mint) versus compute.  Keyed by module, arm, kind and
+/// bloq, so a kind or bloq that never reaches its typed kernel shows up as a
+/// punt count rather than as a slow ship.
+///
+/// Compiled in and OFF by default: with U3_JET_STATS unset, a jet pays one
+/// predictable branch.  U3_JET_STATS=1 turns the counters on and prints the
+/// table to stderr at exit; any other value is a file the table is appended
+/// to at exit.  u3qi_jst_dump() prints it on demand (the `|mass` report and
+/// the `%jstat` hint call it; see README-jstat.md).
+///
+/// Times are inclusive: a jet whose gate slams another jet (+el-wise-op over
+/// a math gate) counts the inner jet's time as its own compute too.
+///
+/// REQUIRES noun.h (c3 types) to be included before this header.
+
+#ifndef _NOUN_JETS_I_JSTAT_H
+#define _NOUN_JETS_I_JSTAT_H
+
+#include <stdio.h>
+
+  /* u3qi_jst_on_o: c3y when U3_JET_STATS is set.
+  */
+    extern c3_o u3qi_jst_on_o;
+
+  /* u3qi_jst_mar_d: ns spent in marshalling so far, all jets.
+  */
+    extern c3_d u3qi_jst_mar_d;
+
+  /* u3qi_jst_now(): monotonic ns.
+  */
+    c3_d
+    u3qi_jst_now(void);
+
+  /* u3qi_jst_note(): count one call of [mod_c]/[arm_c] at [kind_m]/[bloq_y]
+  ** that took [tot_d] ns, [mar_d] of them marshalling; [pun_o] if it punted.
+  ** [mod_c] and [arm_c] must be string literals (they key by address).
+  */
+    void
+    u3qi_jst_note(const c3_c* mod_c,
+                  const c3_c* arm_c,
+                  c3_m        kind_m,
+                  c3_y        bloq_y,
+                  c3_o        pun_o,
+                  c3_d        tot_d,
+                  c3_d        mar_d);
+
+  /* u3qi_jst_dump(): print the table to [fil_u], busiest first.
+  */
+    void
+    u3qi_jst_dump(FILE* fil_u);
+
+  /* u3qi_jst_wipe(): zero the table.
+  */
+    void
+    u3qi_jst_wipe(void);
+
+/* U3QI_JST: a jet's product [pro], evaluated under the counters.
+*/
+#define U3QI_JST(mod_c, arm_c, kind_m, bloq_y, pro)                            \
+  ({ u3_noun _jst_pro;                                                         \
+     if ( c3n == u3qi_jst_on_o ) {                                             \
+       _jst_pro = (pro);                                                       \
+     }                                                                         \
+     else {                                                                    \
+       c3_d _jst_mar = u3qi_jst_mar_d;                                         \
+       c3_d _jst_now = u3qi_jst_now();                                         \
+       _jst_pro = (pro);                                                       \
+       u3qi_jst_note(mod_c, arm_c, kind_m, bloq_y,                             \
+                     __(u3_none == _jst_pro),                                  \
+                     u3qi_jst_now() - _jst_now,                                \
+                     u3qi_jst_mar_d - _jst_mar);                               \
+     }                                                                         \
+     _jst_pro; })
+
+/* U3QI_JST_MAR: a marshalling call [e] of type [typ], clocked when on;
+** U3QI_JST_MAR_V for a void one.
+*/
+#define U3QI_JST_MAR(typ, e)                                                   \
+  ({ typ _jst_r;                                                               \
+     if ( c3n == u3qi_jst_on_o ) {                                             \
+       _jst_r = (e);                                                           \
+     }                                                                         \
+     else {                                                                    \
+       c3_d _jst_now = u3qi_jst_now();                                         \
+       _jst_r = (e);                                                           \
+       u3qi_jst_mar_d += u3qi_jst_now() - _jst_now;                            \
+     }                                                                         \
+     _jst_r; })
+
+#define U3QI_JST_MAR_V(e)                                                      \
+  do {                                                                         \
+    if ( c3n == u3qi_jst_on_o ) {                                              \
+      (e);                                                                     \
+    }                                                                          \
+    else {                                                                     \
+      c3_d _jst_now = u3qi_jst_now();                                          \
+      (e);                                                                     \
+      u3qi_jst_mar_d += u3qi_jst_now() - _jst_now;                             \
+    }                                                                          \
+  } while (0)
+
+#endif  //  _NOUN_JETS_I_JSTAT_H
@@ -410,14 +410,23 @@
     u3_noun u3wi_la_divs(u3_noun);
     u3_noun u3wi_la_mods(u3_noun);
     u3_noun u3wi_la_dot(u3_noun);
+    u3_noun u3wi_la_dotc(u3_noun);
     u3_noun u3wi_la_diag(u3_noun);
     u3_noun u3wi_la_transpose(u3_noun);
+    u3_noun u3wi_la_permute(u3_noun);
     u3_noun u3wi_la_cumsum(u3_noun);
     u3_noun u3wi_la_argmin(u3_noun);
     u3_noun u3wi_la_argmax(u3_noun);
     u3_noun u3wi_la_ravel(u3_noun);
     u3_noun u3wi_la_min(u3_noun);
     u3_noun u3wi_la_max(u3_noun);
+    u3_noun u3wi_la_prod(u3_noun);
+    u3_noun u3wi_la_sum_axis(u3_noun);
+    u3_noun u3wi_la_prod_axis(u3_noun);
+    u3_noun u3wi_la_max_axis(u3_noun);
+    u3_noun u3wi_la_min_axis(u3_noun);
+    u3_noun u3wi_la_argmax_axis(u3_noun);
+    u3_noun u3wi_la_argmin_axis(u3_noun);
     u3_noun u3wi_la_linspace(u3_noun);
     u3_noun u3wi_la_range(u3_noun);
     u3_noun u3wi_la_abs(u3_noun);
@@ -428,6 +437,9 @@
 
     u3_noun u3wi_la_trace(u3_noun);
     u3_noun u3wi_la_mmul(u3_noun);
+    u3_noun u3wi_la_el_wise_op(u3_noun);
+    u3_noun u3wi_la_bin_op(u3_noun);
+    u3_noun u3wi_la_ter_op(u3_noun);
 
     u3_noun u3wi_rd_exp(u3_noun);
     u3_noun u3wi_rd_log(u3_noun);
@@ -444,6 +456,7 @@
     u3_noun u3wi_rd_pow_n(u3_noun);
     u3_noun u3wi_rd_log2(u3_noun);
     u3_noun u3wi_rd_log10(u3_noun);
+    u3_noun u3wi_rd_sincos(u3_noun);
     u3_noun u3wi_rs_exp(u3_noun);
     u3_noun u3wi_rs_log(u3_noun);
     u3_noun u3wi_rs_sin(u3_noun);
@@ -459,6 +472,7 @@
     u3_noun u3wi_rs_pow_n(u3_noun);
     u3_noun u3wi_rs_log2(u3_noun);
     u3_noun u3wi_rs_log10(u3_noun);
+    u3_noun u3wi_rs_sincos(u3_noun);
     u3_noun u3wi_rh_exp(u3_noun);
     u3_noun u3wi_rh_log(u3_noun);
     u3_noun u3wi_rh_sin(u3_noun);
@@ -474,6 +488,7 @@
     u3_noun u3wi_rh_pow_n(u3_noun);
     u3_noun u3wi_rh_log2(u3_noun);
     u3_noun u3wi_rh_log10(u3_noun);
+    u3_noun u3wi_rh_sincos(u3_noun);
 
     u3_noun u3wi_rq_exp(u3_noun);
     u3_noun u3wi_rq_log(u3_noun);
@@ -490,6 +505,22 @@
     u3_noun u3wi_rq_pow_n(u3_noun);
     u3_noun u3wi_rq_log2(u3_noun);
     u3_noun u3wi_rq_log10(u3_noun);
+    u3_noun u3wi_rq_sincos(u3_noun);
+
+    u3_noun u3wi_sa_exp(u3_noun);
+    u3_noun u3wi_sa_sin(u3_noun);
+    u3_noun u3wi_sa_cos(u3_noun);
+    u3_noun u3wi_sa_tan(u3_noun);
+    u3_noun u3wi_sa_log(u3_noun);
+    u3_noun u3wi_sa_log10(u3_noun);
+    u3_noun u3wi_sa_log2(u3_noun);
+    u3_noun u3wi_sa_sqrt(u3_noun);
+    u3_noun u3wi_sa_cbrt(u3_noun);
+    u3_noun u3wi_sa_pow_n(u3_noun);
+    u3_noun u3wi_sa_pow(u3_noun);
+    u3_noun u3wi_sa_sincos(u3_noun);
+    u3_noun u3wi_sa_eig(u3_noun);
+    u3_noun u3wi_sa_eig_par(u3_noun);
 
 #endif /* ifndef U3_JETS_W_H */
 
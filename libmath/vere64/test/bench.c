@@ -0,0 +1,194 @@
+// bench.c -- native microbenchmark for the libmath C kernels.
+//
+// Includes the MASTER jet algorithms (noun/jets/i/math.c) with
+// -DMATH_JET_HARNESS, like rd_check.c, and times every `_r{h,s,d,q}_*` kernel
+// directly: no ship, no jet dispatch, no noun marshalling.  Inputs follow
+// benchmark/desk/lib/bench-domains.hoon (same interval, sample span and
+// second operand per arm, @rh overrides included), built once per cell
+// outside the timed loop as bench-cells.hoon does.  A %base cell times the
+// bare loop and fold so bench_summarize.py can subtract it.
+//
+// Output is the benchmark/ bench-timing.csv schema
+//   word_size,impl,door,arm,n,set,elapsed_us,status
+// with impl `native`, so tools/bench_summarize.py and tools/bench_plots.py
+// read it unchanged.  Set 0 is the warm-up, as there.  A per-cell
+// mean +- stddev ns/call (base subtracted, set 0 dropped) goes to stderr.
+//
+// Build/run: ./bench.sh [out.csv [n [sets [door]]]]
+
+#define MATH_JET_HARNESS
+#include "../noun/jets/i/math.c"
+
+#include <stdio.h>
+#include <time.h>
+
+typedef struct {
+  const char* arm;
+  c3_ds lo, hi;                 //  interval [lo/den, hi/den]
+  c3_d  den, span;
+  char  kind;                   //  '1' one arg, '2' atan2, 'p' pow, 'n' pow-n
+} dom;
+
+//  bench-domains.hoon ++get, %cheb column; arm order as bench-grid
+static const dom DOM[] = {
+  {"base",   -20,    20,   1, 40000, '1'},
+  {"exp",    -20,    20,   1, 40000, '1'},
+  {"log",      1,  2000,  10, 20000, '1'},
+  {"sin",   -100,   100,   1, 40000, '1'},
+  {"cos",   -100,   100,   1, 40000, '1'},
+  {"tan",     -3,     3,   2,  6000, '1'},
+  {"atan",   -50,    50,   1, 40000, '1'},
+  {"atan2",  -10,    10,   1, 20000, '2'},
+  {"asin",    -1,     1,   1,  4000, '1'},
+  {"acos",    -1,     1,   1,  4000, '1'},
+  {"sqt",      1, 20000, 100, 20000, '1'},
+  {"cbt", -20000, 20000, 100, 40000, '1'},
+  {"pow",      1,    10,   1, 10000, 'p'},
+  {"pow-n",    1,    10,   1, 10000, 'n'},
+  {"log-2",    1,  2000,  10, 20000, '1'},
+  {"log-10",   1,  2000,  10, 20000, '1'},
+};
+#define NDOM ( sizeof DOM / sizeof DOM[0] )
+
+//  @rh overrides (f16 range)
+static const dom DOM_RH[] = {
+  {"exp",     -8,     8,   1,  8000, '1'},
+  {"sin",    -12,    12,   1, 24000, '1'},
+  {"cos",    -12,    12,   1, 24000, '1'},
+  {"atan",   -16,    16,   1, 32000, '1'},
+  {"pow-n",    1,     3,   1,  3000, 'n'},
+  {"log",      1,   400,  10, 20000, '1'},
+  {"log-2",    1,   400,  10, 20000, '1'},
+  {"log-10",   1,   400,  10, 20000, '1'},
+};
+
+static dom dom_of(const char* door, unsigned a) {
+  if ( !strcmp(door, "rh") ) {
+    for ( unsigned i = 0; i < sizeof DOM_RH / sizeof DOM_RH[0]; i++ )
+      if ( !strcmp(DOM_RH[i].arm, DOM[a].arm) ) return DOM_RH[i];
+  }
+  return DOM[a];
+}
+
+//  index of [arm] in _math_un_c / _math_bi_c, or -1
+static int un_of(const char* arm) {
+  for ( int i = 0; i < 12; i++ ) if ( !strcmp(arm, _math_un_c[i]) ) return i;
+  return -1;
+}
+static int bi_of(const char* arm) {
+  for ( int i = 0; i < 3; i++ ) if ( !strcmp(arm, _math_bi_c[i]) ) return i;
+  return -1;
+}
+
+static double now_ns(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return (double)t.tv_sec * 1e9 + (double)t.tv_nsec;
+}
+
+//  the fold: results are summed as bits into a sink so nothing is elided
+static volatile c3_d sink;
+
+//  one width: input generation (inp k = lof + ((k mod span)/span)*wid, in the
+//  width's own arithmetic) and the timed loop over its kernel tables
+#define BENCH_W(w, T, I2F, DIV, ADD, SUB, MUL, BITS, UN, TAN, BI, TWO_5)          \
+  static void w##_inputs(dom d, c3_d n, T* x, T* y) {                          \
+    T den = I2F(d.den), lof = DIV(I2F(d.lo), den);                              \
+    T wid = SUB(DIV(I2F(d.hi), den), lof), spn = I2F(d.span);                   \
+    for ( c3_d k = 0; k <= n; k++ )                                            \
+      x[k] = ADD(lof, MUL(DIV(I2F(k % d.span), spn), wid));                     \
+    for ( c3_d k = 0; k < n; k++ )                                             \
+      y[k] = ( 'p' == d.kind ) ? TWO_5 :                                       \
+             ( 'n' == d.kind ) ? I2F(2 + k % 7) :                              \
+             ( '2' == d.kind ) ? x[k + 1] : x[k];                              \
+  }                                                                            \
+  static double w##_set(const char* arm, c3_d n, const T* x, const T* y) {     \
+    int un = un_of(arm), bi = bi_of(arm), rnd = softfloat_round_near_even;     \
+    c3_d acc = 0;                                                              \
+    double t0 = now_ns();                                                      \
+    if ( bi >= 0 )         for ( c3_d k = 0; k < n; k++ )                      \
+                             acc += BITS(BI[bi](x[k], y[k], rnd));             \
+    else if ( 11 == un )   for ( c3_d k = 0; k < n; k++ )                      \
+                             acc += BITS(TAN(x[k]));                           \
+    else if ( un >= 0 )    for ( c3_d k = 0; k < n; k++ )                      \
+                             acc += BITS(UN[un](x[k]));                        \
+    else                   for ( c3_d k = 0; k < n; k++ )                      \
+                             acc += BITS(x[k]);                                \
+    double t1 = now_ns();                                                      \
+    sink += acc;                                                               \
+    return t1 - t0;                                                            \
+  }
+
+static inline float16_t h_i2f(c3_ds i) { return i64_to_f16(i); }
+static inline float32_t s_i2f(c3_ds i) { return i64_to_f32(i); }
+static inline float64_t d_i2f(c3_ds i) { return i64_to_f64(i); }
+static inline c3_d h_bits(float16_t a) { return a.v; }
+static inline c3_d s_bits(float32_t a) { return a.v; }
+static inline c3_d d_bits(float64_t a) { return a.v; }
+static inline c3_d q_bits(float128_t a) { union quad u; u.q = a; return u.w[0] ^ u.w[1]; }
+static inline float16_t rh_tan(float16_t x) { return _rh_tan(x, softfloat_round_near_even); }
+static inline float32_t rs_tan(float32_t x) { return _rs_tan(x, softfloat_round_near_even); }
+static inline float128_t rq_tan(float128_t x) { return _rq_tan(x, softfloat_round_near_even); }
+
+BENCH_W(rh, float16_t, h_i2f, f16_div, f16_add, f16_sub, f16_mul, h_bits,
+        _rh_t_fun, rh_tan, _rh_bi, _rh_bits(0x4100).h)
+BENCH_W(rs, float32_t, s_i2f, f32_div, f32_add, f32_sub, f32_mul, s_bits,
+        _rs_un, rs_tan, _rs_bi, _rs_bits(0x40200000).s)
+BENCH_W(rd, float64_t, d_i2f, f64_div, f64_add, f64_sub, f64_mul, d_bits,
+        _rd_un, _rd_tan, _rd_bi, _rd_bits(0x4004000000000000ULL).d)
+BENCH_W(rq, float128_t, _rqi64, _rqd, _rqa, _rqs, _rqm, q_bits,
+        _rq_un, rq_tan, _rq_bi, _rq_bits(0x4000400000000000ULL, 0))
+
+static double stat(const double* v, unsigned m, double* sd) {
+  double mu = 0, s2 = 0;
+  for ( unsigned i = 0; i < m; i++ ) mu += v[i];
+  mu /= m;
+  for ( unsigned i = 0; i < m; i++ ) s2 += (v[i] - mu) * (v[i] - mu);
+  *sd = ( m > 1 ) ? sqrt(s2 / m) : 0;
+  return mu;
+}
+
+int main(int argc, char** argv) {
+  const char* out_c = ( argc > 1 ) ? argv[1] : "bench-timing.csv";
+  c3_d     n    = ( argc > 2 ) ? strtoull(argv[2], 0, 10) : 100000;
+  unsigned sets = ( argc > 3 ) ? (unsigned)atoi(argv[3]) : 5;
+  const char* only = ( argc > 4 ) ? argv[4] : 0;
+  static const char* const DOORS[] = { "rd", "rs", "rh", "rq" };
+  FILE* f = fopen(out_c, "w");
+  if ( !f || !n || sets < 2 ) {
+    fprintf(stderr, "usage: bench [out.csv [n [sets>=2 [door]]]]\n");
+    return 1;
+  }
+  softfloat_roundingMode = softfloat_round_near_even;
+  fprintf(f, "word_size,impl,door,arm,n,set,elapsed_us,status\n");
+
+  void* x = malloc((n + 1) * sizeof(float128_t));
+  void* y = malloc(n * sizeof(float128_t));
+  double* ns = malloc(sets * sizeof(double));
+  for ( unsigned d = 0; d < 4; d++ ) {
+    const char* door = DOORS[d];
+    if ( only && strcmp(only, door) ) continue;
+    double base = 0;
+    for ( unsigned a = 0; a < NDOM; a++ ) {
+      dom dm = dom_of(door, a);
+      for ( unsigned s = 0; s < sets; s++ ) {
+        double t = 0;
+        switch ( d ) {
+          case 0: if ( !s ) rd_inputs(dm, n, x, y); t = rd_set(dm.arm, n, x, y); break;
+          case 1: if ( !s ) rs_inputs(dm, n, x, y); t = rs_set(dm.arm, n, x, y); break;
+          case 2: if ( !s ) rh_inputs(dm, n, x, y); t = rh_set(dm.arm, n, x, y); break;
+          case 3: if ( !s ) rq_inputs(dm, n, x, y); t = rq_set(dm.arm, n, x, y); break;
+        }
+        ns[s] = t / (double)n;
+        fprintf(f, "%u,native,%s,%s,%llu,%u,%llu,ok\n", (unsigned)(8 * sizeof(void*)),
+                door, dm.arm, (unsigned long long)n, s, (unsigned long long)(t / 1e3 + 0.5));
+      }
+      double sd, mu = stat(ns + 1, sets - 1, &sd);
+      if ( !a ) base = mu;
+      else fprintf(stderr, "%-3s %-7s %10.1f +- %6.1f ns/call\n", door, dm.arm, mu - base, sd);
+    }
+  }
+  fclose(f);
+  free(x); free(y); free(ns);
+  return 0;
+}
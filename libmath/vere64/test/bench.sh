@@ -0,0 +1,22 @@
+#!/bin/sh
+# Build + run the native kernel microbenchmark (bench.c) against the SAME
+# Berkeley SoftFloat the vere jets use; see build.sh for the re-archive step.
+#
+#   ./bench.sh [out.csv [n [sets [door]]]]
+#   ./bench.sh results.csv 100000 5 rq     # @rq only
+#
+# The CSV is in benchmark/'s bench-timing.csv schema (impl `native`), so
+#   benchmark/tools/bench_summarize.py out.csv
+# aggregates it like a ship run.  Set CFLAGS to time another build, e.g.
+# CFLAGS='-DMATH_RD_NATIVE' or CFLAGS='-DMATH_NO_NATIVE'.
+set -e
+
+SFINC="$(dirname "$(find "$HOME/urbit" -name softfloat.h 2>/dev/null | grep -i softfloat/source/include | head -1)")"
+SFLIB="$(find "$HOME/urbit/vere-ml64" -name libsoftfloat.a 2>/dev/null | head -1)"
+[ -n "$SFINC" ] && [ -n "$SFLIB" ] || { echo "softfloat not found (build vere-ml64 first)"; exit 1; }
+
+WORK="$(mktemp -d)"
+( cd "$WORK" && ar x "$SFLIB" && chmod u+rw ./*.o && libtool -static -o ./libsoftfloat.a ./*.o )
+cc -O2 -ffp-contract=off ${CFLAGS:-} -I"$SFINC" "$(dirname "$0")/bench.c" "$WORK/libsoftfloat.a" -lm -o "$WORK/bench"
+"$WORK/bench" "${1:-bench-timing.csv}" ${2:-} ${3:-} ${4:-}
+rm -rf "$WORK"
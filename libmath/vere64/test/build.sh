@@ -12,6 +12,10 @@ WORK="$(mktemp -d)"
 ( cd "$WORK" && ar x "$SFLIB" && chmod u+rw ./*.o && libtool -static -o ./libsoftfloat.a ./*.o )
 cc -O2 -I"$SFINC" "$(dirname "$0")/rd_check.c" "$WORK/libsoftfloat.a" -o "$WORK/rd_check"
 "$WORK/rd_check"
+# Same harness on the native-double @rd base ops: re-runs the vectors above and
+# then sweeps every core native-vs-SoftFloat (must report 0 diffs).
+cc -O2 -ffp-contract=off -DMATH_RD_NATIVE -I"$SFINC" "$(dirname "$0")/rd_check.c" "$WORK/libsoftfloat.a" -o "$WORK/rd_check_native"
+"$WORK/rd_check_native" | grep '^sweep'
 rm -rf "$WORK"
 
 cat <<'EOF'
@@ -7,6 +7,10 @@
 // expression).  The shared `_rd_*` cores are word-size-agnostic, so this 64-bit
 // copy and the 32-bit libmath/vere/ copy produce identical results.
 //
+// Built with -DMATH_RD_NATIVE (build.sh does a second build), it also sweeps
+// random inputs through every @rd core twice, once on the native base ops and
+// once forced onto SoftFloat (_rd_soft), and reports any bit that differs.
+//
 // Build/run: ./build.sh   (re-archives the zig softfloat .a for Apple ld).
 
 #define MATH_JET_HARNESS
@@ -14,6 +18,10 @@
 
 #include <stdio.h>
 
+// door rounding r handed to the composite arms (tan/atan2/pow/pow-n); the
+// vectors below were taken at the door bunt %z.
+static int door_r = softfloat_round_minMag;
+
 static void emit(const char* nm, double x, float64_t (*fun)(float64_t)) {
   union { double f; uint64_t b; } u; u.f = x;
   union doub in, out;
@@ -25,11 +33,11 @@ static void emit(const char* nm, double x, float64_t (*fun)(float64_t)) {
 
 // two-arg: prints `<nm> 0x<a> 0x<b> 0x<out>` (the verifier reads cols 2,3,4)
 static void emit2(const char* nm, double a, double b,
-                  float64_t (*fun)(float64_t, float64_t)) {
+                  float64_t (*fun)(float64_t, float64_t, int)) {
   union { double f; uint64_t b; } ua, ub; ua.f = a; ub.f = b;
   union doub xa, xb, out;
   xa.c = ua.b; xb.c = ub.b;
-  out.d = fun(xa.d, xb.d);
+  out.d = fun(xa.d, xb.d, door_r);
   printf("%-6s 0x%016llx 0x%016llx 0x%016llx  (%g,%g)\n",
          nm, (unsigned long long)xa.c, (unsigned long long)xb.c,
          (unsigned long long)out.c, a, b);
@@ -43,6 +51,8 @@ static void emits(const char* nm, unsigned in, float32_t (*fun)(float32_t)) {
   printf("%-6s 0x%08x 0x%08x\n", nm, (unsigned)x.c, (unsigned)out.c);
 }
 
+static float32_t rs_tan_r(float32_t x) { return _rs_tan(x, door_r); }
+
 // narrow spike: f32 -> f16 via SoftFloat in each rounding mode; tag is the
 // mode letter so the Hoon (~(narrow-sh rh [<mode> ..]) <f32>) can be compared.
 static void emit_narrow(unsigned f32bits) {
@@ -59,6 +69,92 @@ static void emit_narrow(unsigned f32bits) {
   softfloat_roundingMode = softfloat_round_near_even;
 }
 
+#ifdef MATH_RD_NATIVE
+// --- native-vs-SoftFloat sweep ------------------------------------------
+static uint64_t sw_rng = 0x9e3779b97f4a7c15ULL;
+static uint64_t sw_next(void) {
+  sw_rng ^= sw_rng << 13; sw_rng ^= sw_rng >> 7; sw_rng ^= sw_rng << 17;
+  return sw_rng;
+}
+// random input by class: raw bits, |x| < 2^k for k in [-30,30], subnormal,
+// near a multiple of pi/2 (trig reduction), [-1,1] (asin/acos domain)
+static uint64_t sw_draw(void) {
+  uint64_t r = sw_next(), m = sw_next() & 0x800fffffffffffffULL;
+  union { double f; uint64_t b; } u;
+  switch ( r % 5 ) {
+    default: return sw_next();
+    case 1:  return m | ((uint64_t)(1023 - 30 + (r >> 8) % 61) << 52);
+    case 2:  return m;
+    case 3:  u.f = (double)((int64_t)((r >> 8) % 2001) - 1000) * 1.5707963267948966;
+             return u.b ^ (sw_next() & 0xff);
+    case 4:  return m | ((uint64_t)(1023 - 1 - (r >> 8) % 20) << 52);
+  }
+}
+// exponent for pow/pow-n: pow-n loops n times, so keep n small; [frac]
+// also draws non-integer n in (-24,24) for the exp(n*log x) path
+static uint64_t sw_expo(int frac) {
+  uint64_t r = sw_next();
+  union { double f; uint64_t b; } u;
+  u.f = ( frac && (r & 1) ) ? ((double)(int64_t)((r >> 8) % 48000) - 24000.0) / 1000.0
+                            : (double)(1 + (r >> 8) % 64);
+  return u.b;
+}
+static uint64_t sw_expo_f(void) { return sw_expo(1); }
+static uint64_t sw_expo_i(void) { return sw_expo(0); }
+static int sw_bad = 0;
+static void sweep1(const char* nm, float64_t (*fun)(float64_t), unsigned n) {
+  unsigned bad = 0;
+  for ( unsigned i = 0; i < n; i++ ) {
+    union doub in, want, got;
+    in.c = sw_draw();
+    _rd_soft = 1; want.d = fun(in.d);
+    _rd_soft = 0; got.d  = fun(in.d);
+    if ( want.c != got.c && bad++ < 4 )
+      printf("sweep %-6s 0x%016llx  native 0x%016llx  soft 0x%016llx\n", nm,
+             (unsigned long long)in.c, (unsigned long long)got.c,
+             (unsigned long long)want.c);
+  }
+  printf("sweep %-6s %u inputs, %u diffs\n", nm, n, bad);
+  sw_bad += bad;
+}
+static void sweep2(const char* nm, float64_t (*fun)(float64_t, float64_t, int),
+                   uint64_t (*draw_b)(void), unsigned n) {
+  unsigned bad = 0;
+  for ( unsigned i = 0; i < n; i++ ) {
+    union doub a, b, want, got;
+    a.c = sw_draw(); b.c = draw_b();
+    _rd_soft = 1; want.d = fun(a.d, b.d, door_r);
+    _rd_soft = 0; got.d  = fun(a.d, b.d, door_r);
+    if ( want.c != got.c && bad++ < 4 )
+      printf("sweep %-6s 0x%016llx 0x%016llx  native 0x%016llx  soft 0x%016llx\n",
+             nm, (unsigned long long)a.c, (unsigned long long)b.c,
+             (unsigned long long)got.c, (unsigned long long)want.c);
+  }
+  printf("sweep %-6s %u inputs, %u diffs\n", nm, n, bad);
+  sw_bad += bad;
+}
+static int sweep_all(unsigned n) {
+  //  door r = %n (composite ops native too), then %z (they stay SoftFloat)
+  static const int rs[2] = { softfloat_round_near_even, softfloat_round_minMag };
+  for ( int k = 0; k < 2; k++ ) {
+    door_r = rs[k];
+    softfloat_roundingMode = softfloat_round_near_even;
+    printf("sweep door r = %s\n", k ? "%z" : "%n");
+    sweep1("exp", _rd_exp, n);      sweep1("log", _rd_log, n);
+    sweep1("log-2", _rd_log2, n);   sweep1("log-10", _rd_log10, n);
+    sweep1("sin", _rd_sin, n);      sweep1("cos", _rd_cos, n);
+    sweep1("tan", _rd_tan, n);      sweep1("atan", _rd_atan, n);
+    sweep1("asin", _rd_asin, n);    sweep1("acos", _rd_acos, n);
+    sweep1("sqt", _rd_sqt, n);      sweep1("cbt", _rd_cbt, n);
+    sweep2("atan2", _rd_atan2, sw_draw, n);
+    sweep2("pow", _rd_pow, sw_expo_f, n);
+    sweep2("pow-n", _rd_pow_n, sw_expo_i, n / 16);
+  }
+  printf("\nsweep %s (%d diffs)\n", sw_bad ? "FAILED" : "ALL PASS", sw_bad);
+  return sw_bad ? 1 : 0;
+}
+#endif
+
 int main(void) {
   softfloat_roundingMode = softfloat_round_near_even;
   // --- @rq exp probe: print hi.lo of _rq_exp(hi,lo) ---
@@ -92,7 +188,7 @@ int main(void) {
     0x40490fdb, 0x42652ee0 };
   for (unsigned i = 0; i < sizeof rstr/sizeof rstr[0]; i++) emits("sin-s", rstr[i], _rs_sin);
   for (unsigned i = 0; i < sizeof rstr/sizeof rstr[0]; i++) emits("cos-s", rstr[i], _rs_cos);
-  for (unsigned i = 0; i < sizeof rstr/sizeof rstr[0]; i++) emits("tan-s", rstr[i], _rs_tan);
+  for (unsigned i = 0; i < sizeof rstr/sizeof rstr[0]; i++) emits("tan-s", rstr[i], rs_tan_r);
   // atan / asin / acos / log / log-2 / log-10 / sqt / cbt (expected: math-*.hoon)
   static const unsigned at_s[] = { 0x3f000000, 0x3f800000, 0xbf800000, 0x40000000,
     0x41200000, 0x7f800000, 0x7fc00000, 0xff800000, 0x0, 0x40490fdb, 0x3dcccccd };
@@ -177,5 +273,32 @@ int main(void) {
   for (unsigned i = 0; i < sizeof pn/sizeof pn[0]; i++)
     emit2("pow-n", pn[i][0], pn[i][1], _rd_pow_n);
 
+  // sincos shares one range reduction; each half must be bit-identical to
+  // sin and cos (random bit patterns, so NaN/inf/zero/huge all turn up).
+  unsigned sc_bad = 0;
+  { uint64_t r = 0x243f6a8885a308d3ULL;
+    for (unsigned i = 0; i < 1000000; i++) {
+      r ^= r << 13; r ^= r >> 7; r ^= r << 17;
+      float64_t xd = { r }, sd, cd;
+      _rd_sincos(xd, &sd, &cd);
+      if ( sd.v != _rd_sin(xd).v || cd.v != _rd_cos(xd).v ) sc_bad++;
+      float32_t xs = { (uint32_t)r }, ss, cs;
+      _rs_sincos(xs, &ss, &cs);
+      if ( ss.v != _rs_sin(xs).v || cs.v != _rs_cos(xs).v ) sc_bad++;
+      if ( i % 64 ) continue;                           // @rq is slow; thin it
+      union quad q, qs, qc, ws, wc;
+      q.w[1] = r; q.w[0] = r * 0x9e3779b97f4a7c15ULL;
+      _rq_sincos(q.q, &qs.q, &qc.q);
+      ws.q = _rq_sin(q.q); wc.q = _rq_cos(q.q);
+      if ( qs.w[0] != ws.w[0] || qs.w[1] != ws.w[1] ||
+           qc.w[0] != wc.w[0] || qc.w[1] != wc.w[1] ) sc_bad++;
+    } }
+  printf("sincos %u diffs\n", sc_bad);
+  if ( sc_bad ) return 1;
+
+#ifdef MATH_RD_NATIVE
+  return sweep_all(1000000);
+#else
   return 0;
+#endif
 }
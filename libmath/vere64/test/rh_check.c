@@ -1,7 +1,7 @@
 // rh_check.c -- verify the native f16 @rh cores against the math-rh.hoon test
 // vectors.  Includes the master math.c with -DMATH_JET_HARNESS so the C tested
-// is byte-for-byte the C the runtime compiles.  Door r=%n in the tests, so we
-// set _math_rnd = near_even before every call.
+// is byte-for-byte the C the runtime compiles.  Door r=%n in the tests, so the
+// composites are handed near_even.
 #define MATH_JET_HARNESS
 #include "../noun/jets/i/math.c"
 
@@ -10,19 +10,21 @@
 static int fails = 0;
 // Model the real jet wrapper: pre-dirty the global rounding mode to %z (as a
 // prior door op would leave it on-ship), then set near-even exactly as the
-// fixed _rh_jet/u3qi wrappers do.  This catches the "wrapper set _math_rnd but
-// not softfloat_roundingMode" regression.
+// _rh_run wrappers do.  This catches a wrapper that forgets to reset
+// softfloat_roundingMode for the kernels.
 static uint16_t b1(uint16_t in, float16_t (*fn)(float16_t)) {
   softfloat_roundingMode = softfloat_round_minMag;     // simulate stale %z
   softfloat_roundingMode = softfloat_round_near_even;  // wrapper resets it
-  _math_rnd = softfloat_round_near_even;
   union half u; u.h = fn(_rh_bits(in).h); return u.c;
 }
-static uint16_t b2(uint16_t a, uint16_t b, float16_t (*fn)(float16_t, float16_t)) {
+static uint16_t b2(uint16_t a, uint16_t b, float16_t (*fn)(float16_t, float16_t, int)) {
   softfloat_roundingMode = softfloat_round_minMag;
   softfloat_roundingMode = softfloat_round_near_even;
-  _math_rnd = softfloat_round_near_even;
-  union half u; u.h = fn(_rh_bits(a).h, _rh_bits(b).h); return u.c;
+  union half u; u.h = fn(_rh_bits(a).h, _rh_bits(b).h, softfloat_round_near_even);
+  return u.c;
+}
+static float16_t rh_tan_n(float16_t x) {
+  return _rh_tan(x, softfloat_round_near_even);
 }
 static void chk(const char* nm, uint16_t got, uint16_t want) {
   int ok = (got == want);
@@ -40,7 +42,7 @@ int main(void) {
   chk("sin-1",     b1(0x3c00, _rh_sin),  0x3abb);
   chk("sin-pi",    b1(0x4248, _rh_sin),  0x13ed);
   chk("cos-1",     b1(0x3c00, _rh_cos),  0x3853);
-  chk("tan-1",     b1(0x3c00, _rh_tan),  0x3e3a);
+  chk("tan-1",     b1(0x3c00, rh_tan_n), 0x3e3a);
   chk("atan-1",    b1(0x3c00, _rh_atan), 0x3a48);
   chk("atan-2",    b1(0x4000, _rh_atan), 0x3c6e);
   chk("asin-half", b1(0x3800, _rh_asin), 0x3830);
@@ -51,6 +53,53 @@ int main(void) {
   chk("log2-8",    b1(0x4800, _rh_log2), 0x4200);
   chk("log10-1k",  b1(0x6400, _rh_log10),0x4205);
   chk("pow-2-h",   b2(0x4000, 0x3800, _rh_pow), 0x3da8);
+#ifndef MATH_NO_RH_TABLES
+  // Every lookup table must equal its kernel over the whole 2^16 domain,
+  // and building one must hand back the caller's rounding mode.
+  for ( int t = 0; t < _rh_t_max; t++ ) {
+    softfloat_roundingMode = softfloat_round_min;
+    const uint16_t* tab = _rh_table((_rh_t)t);
+    unsigned bad = ( softfloat_roundingMode != softfloat_round_min );
+    softfloat_roundingMode = softfloat_round_near_even;
+    for ( uint32_t b = 0; tab && b < 0x10000; b++ ) {
+      union half u; u.h = _rh_t_fun[t](_rh_bits((uint16_t)b).h);
+      if ( u.c != tab[b] ) bad++;
+    }
+    if ( !tab || bad ) fails++;
+    printf("table %-2d %s\n", t, ( tab && !bad ) ? "OK" : "*** FAIL");
+  }
+#endif
+  // The batch driver (Saloon's ray path) must match the scalar kernel lane
+  // for lane, in place, table or no table.
+  {
+    static float16_t buf[0x10000];
+    unsigned bad = 0;
+    for ( int t = 0; t < _rh_t_max; t++ ) {
+      for ( uint32_t b = 0; b < 0x10000; b++ ) buf[b] = _rh_bits((uint16_t)b).h;
+      _rh_map_t((_rh_t)t, buf, buf, 0x10000);
+      for ( uint32_t b = 0; b < 0x10000; b++ ) {
+        union half u, v;
+        u.h = _rh_t_fun[t](_rh_bits((uint16_t)b).h); v.h = buf[b];
+        if ( u.c != v.c ) bad++;
+      }
+    }
+    if ( bad ) fails++;
+    printf("batch    %s\n", bad ? "*** FAIL" : "OK");
+  }
+  // sincos shares one reduction; both halves must match sin and cos exactly.
+  {
+    unsigned bad = 0;
+    for ( uint32_t b = 0; b < 0x10000; b++ ) {
+      float16_t s, c;
+      union half u, v, w, z;
+      _rh_sincos(_rh_bits((uint16_t)b).h, &s, &c);
+      u.h = s; v.h = _rh_sin(_rh_bits((uint16_t)b).h);
+      w.h = c; z.h = _rh_cos(_rh_bits((uint16_t)b).h);
+      if ( u.c != v.c || w.c != z.c ) bad++;
+    }
+    if ( bad ) fails++;
+    printf("sincos   %s\n", bad ? "*** FAIL" : "OK");
+  }
   printf("\n%s (%d failures)\n", fails ? "FAILED" : "ALL PASS", fails);
   return fails ? 1 : 0;
 }
@@ -1,4 +1,6 @@
-// rq_cores.c -- verify the native f128 @rq cores against math-rq.hoon vectors.
+// rq_cores.c -- verify the native f128 @rq cores against math-rq.hoon vectors,
+// and (where __int128 is available) the value-passing base ops and every unary
+// core against SoftFloat.
 #define MATH_JET_HARNESS
 #include "../noun/jets/i/math.c"
 #include <stdio.h>
@@ -13,7 +15,8 @@ static void chk(const char* nm, float128_t got, c3_d ehi, c3_d elo){
          (unsigned long long)ehi,(unsigned long long)elo, ok?"OK":"*** FAIL");
 }
 int main(void){
-  softfloat_roundingMode = softfloat_round_near_even; _math_rnd = softfloat_round_near_even;
+  softfloat_roundingMode = softfloat_round_near_even;
+  int rnd = softfloat_round_near_even;
   float128_t ONE=Q(0x3fff000000000000ULL,0), TWO=Q(0x4000000000000000ULL,0),
              HALF=Q(0x3ffe000000000000ULL,0), EIGHT=Q(0x4002000000000000ULL,0);
   chk("log-2",  _rq_log(TWO),   0x3ffe62e42fefa39eULL,0xf35793c7673007e6ULL);
@@ -26,8 +29,60 @@ int main(void){
   chk("acos-h", _rq_acos(HALF), 0x3fff0c152382d736ULL,0x58465bb32e0f567bULL);
   chk("sqt-2",  _rq_sqt(TWO),   0x3fff6a09e667f3bcULL,0xc908b2fb1366ea95ULL);
   chk("cbt-8",  _rq_cbt(EIGHT), 0x3fffffffffffffffULL,0xffffffffffffffffULL);
-  chk("pow-2-h",_rq_pow(TWO,HALF),0x3fff6a09e667f3bcULL,0xc908b2fb1366ea96ULL);
-  chk("tan-1",  _rq_tan(ONE),   0x3fff8eb245cbee3aULL,0x5b8acc7d41323140ULL); // tan(1)=div(sin,cos) under %n
+  chk("pow-2-h",_rq_pow(TWO,HALF,rnd),0x3fff6a09e667f3bcULL,0xc908b2fb1366ea96ULL);
+  chk("tan-1",  _rq_tan(ONE,rnd),0x3fff8eb245cbee3aULL,0x5b8acc7d41323140ULL); // tan(1)=div(sin,cos) under %n
+#ifdef _RQ_NATIVE
+  //  the __int128 base ops against SoftFloat: random patterns, weighted
+  //  toward near-cancellation, subnormal and overflowing results, and +-0
+  //  against subnormal or normal operands
+  { uint64_t z = 0x9e3779b97f4a7c15ULL; unsigned bad = 0;
+    #define NX() ( z ^= z << 13, z ^= z >> 7, z ^= z << 17 )
+    for ( unsigned i = 0; i < 4000000; i++ ) {
+      union quad a, b, n, f;
+      a.w[1] = NX(); a.w[0] = NX(); b.w[1] = NX(); b.w[0] = NX();
+      switch ( i & 7 ) {
+        case 1: b.w[1] = (b.w[1] & 0x8000000000000fffULL) | (a.w[1] & 0x7ffffffffffff000ULL); break;
+        case 2: a.w[1] &= 0x800fffffffffffffULL; break;               // small exponents
+        case 3: a.w[1] &= 0x800fffffffffffffULL; b.w[1] &= 0x800fffffffffffffULL; break;
+        case 4: a.w[1] = (a.w[1] & 0x8000ffffffffffffULL) | ((0x3fffULL + (NX() % 64) - 32) << 48);
+                b.w[1] = (b.w[1] & 0x8000ffffffffffffULL) | ((0x3fffULL + (NX() % 64) - 32) << 48); break;
+        case 5: b.w[1] = a.w[1] ^ 0x8000000000000000ULL; b.w[0] = a.w[0] ^ (NX() & 7); break;
+        case 6: a.w[1] &= 0x8000ffffffffffffULL; b.w[1] &= 0x8000ffffffffffffULL; break;   // subnormals
+        case 7: if ( NX() & 1 ) { a.w[1] &= 0x8000000000000000ULL; a.w[0] = 0; }     // a zero and
+                else            { b.w[1] &= 0x8000000000000000ULL; b.w[0] = 0; }     // a subnormal
+                if ( NX() & 1 ) { a.w[1] &= 0x8000ffffffffffffULL; b.w[1] &= 0x8000ffffffffffffULL; } break;
+      }
+      float128_t (*op[4])(float128_t, float128_t) = { _rqa, _rqs, _rqm, _rqd };
+      for ( int o = 0; o < 4; o++ ) {
+        _rq_soft = 0; n.q = op[o](a.q, b.q);
+        _rq_soft = 1; f.q = op[o](a.q, b.q);
+        if ( (n.w[0] != f.w[0]) || (n.w[1] != f.w[1]) ) {
+          int nan = ((f.w[1] >> 48) & 0x7fff) == 0x7fff && ((f.w[1] << 16) | f.w[0]);
+          if ( !nan && bad++ < 8 )
+            printf("op%d 0x%016llx.%016llx 0x%016llx.%016llx: 0x%016llx.%016llx != 0x%016llx.%016llx\n", o,
+                   (unsigned long long)a.w[1], (unsigned long long)a.w[0],
+                   (unsigned long long)b.w[1], (unsigned long long)b.w[0],
+                   (unsigned long long)n.w[1], (unsigned long long)n.w[0],
+                   (unsigned long long)f.w[1], (unsigned long long)f.w[0]);
+        }
+      }
+    }
+    //  and every unary core end to end, on moderate arguments
+    for ( int c = 0; c < 11; c++ ) {
+      for ( unsigned i = 0; i < 20000; i++ ) {
+        union quad a, n, f;
+        a.w[0] = NX();
+        a.w[1] = (NX() & 0x8000ffffffffffffULL) | ((0x3fffULL + (NX() % 40) - 30) << 48);
+        _rq_soft = 0; n.q = _rq_un[c](a.q);
+        _rq_soft = 1; f.q = _rq_un[c](a.q);
+        if ( (n.w[0] != f.w[0]) || (n.w[1] != f.w[1]) ) bad++;
+      }
+    }
+    _rq_soft = 0;
+    if ( bad ) fails++;
+    printf("int128 ops %u diffs\n", bad);
+  }
+#endif
   printf("\n%s (%d failures)\n", fails?"FAILED":"ALL PASS", fails);
   return fails?1:0;
 }
@@ -10,6 +10,13 @@ whose cases check, per matrix:
 
 All values are emitted as f64 (@rd, bloq 6) Hoon float literals.
 
+With --bits it instead prints /tests/lib/saloon-eig-bits.hoon: +eig's exact
+output bits (vals and vecs) for small matrices at every %i754 width and
+rounding mode, from an exact-arithmetic model of the Hoon loop.  The jet
+(saloon.c) must match these bit for bit, and so must the Hoon with the jet
+off, which pins the two to each other.  --bits --par does the same for
++eig-par (round-robin order), printing /tests/lib/saloon-eig-par.hoon.
+
 Catalogue (the four standard sources):
   closed-form  : 1-D Laplacian tridiag(2,-1) -- analytic spectrum 2-2cos(k.pi/(n+1))
   torture      : Rosser 8x8, Wilkinson W7+, Pascal 4, Hilbert 4
@@ -18,6 +25,8 @@ Catalogue (the four standard sources):
 """
 
 import math
+import sys
+from fractions import Fraction as Q
 
 import numpy as np
 
@@ -184,5 +193,350 @@ def emit_hoon():
     print("--")
 
 
+# ---------------------------------------------------------------------------
+# bit-exact model of +eig (for --bits)
+# ---------------------------------------------------------------------------
+#
+# IEEE binary16/32/64/128 arithmetic on bit patterns, each op exact in
+# Fractions and rounded once per the door's mode, so it reproduces SoftFloat
+# (and so Saloon's Hoon and its C jet) bit for bit on finite data.  +eig is
+# transcribed op for op from saloon.hoon: cyclic p<q order, +fsqt's Newton
+# with +feps and the 50-step cap, +fsign, +fabs as (0 - x), +off-norm /
+# +frob in row-major order, the 60-sweep cap.
+
+FMT = {4: (5, 10), 5: (8, 23), 6: (11, 52), 7: (15, 112)}   # bloq: (ebits, mbits)
+
+
+def _dec(b, x):
+    """Bits -> (negative?, value): an exact Fraction, "inf", or "nan"."""
+    e, m = FMT[b]
+    sgn = bool(x >> (e + m))
+    exp = (x >> m) & ((1 << e) - 1)
+    man = x & ((1 << m) - 1)
+    bias = (1 << (e - 1)) - 1
+    if exp == (1 << e) - 1:
+        return sgn, ("nan" if man else "inf")
+    if exp == 0:
+        v = Q(man, 1 << m) * Q(2) ** (1 - bias)
+    else:
+        v = (1 + Q(man, 1 << m)) * Q(2) ** (exp - bias)
+    return sgn, (-v if sgn else v)
+
+
+def _enc(b, v, mode, neg=False):
+    """Round exact [v] to bloq [b] per [mode]; [neg] is the sign of a zero."""
+    e, m = FMT[b]
+    bias = (1 << (e - 1)) - 1
+    if v == 0:
+        return int(neg) << (e + m)
+    s = v < 0
+    a = -v if s else v
+    ex = a.numerator.bit_length() - a.denominator.bit_length()
+    if Q(2) ** ex > a:
+        ex -= 1
+    ex = max(ex, 1 - bias)
+    sc = a / Q(2) ** (ex - m)
+    q, r = divmod(sc.numerator, sc.denominator)
+    r = Q(r, sc.denominator)
+    up = {"n": r > Q(1, 2) or (r == Q(1, 2) and q & 1),
+          "z": False,
+          "u": r > 0 and not s,
+          "d": r > 0 and s}[mode]
+    q += up
+    if q == 1 << (m + 1):
+        q >>= 1
+        ex += 1
+    if ex > bias:
+        big = {"n": True, "z": False, "u": not s, "d": s}[mode]
+        body = ((1 << e) - 1) << m if big else (((1 << e) - 2) << m) | ((1 << m) - 1)
+        return (int(s) << (e + m)) | body
+    if q < 1 << m:                       # subnormal (or rounded to zero)
+        return (int(s) << (e + m)) | q
+    return (int(s) << (e + m)) | ((ex + bias) << m) | (q - (1 << m))
+
+
+class Fl:
+    """One width and rounding mode: the +fadd .. +flte of saloon.hoon.
+
+    NaNs follow SoftFloat's 8086-SSE specialization (the first NaN operand,
+    quieted; else the default NaN, sign set).  Only a -0 pivot (+sweep-once
+    skips +0 alone) or an overflow reaches them."""
+
+    def __init__(self, b, mode):
+        self.b, self.mode = b, mode
+        e, m = FMT[b]
+        self.neg_bit = e + m
+        self.quiet = 1 << (m - 1)
+        self.inf = ((1 << e) - 1) << m
+        self.dnan = (1 << (e + m)) | self.inf | self.quiet
+        k = {4: (Q(1, 100), Q(1, 100)), 5: (Q(1, 10**6), Q(1, 10**4)),
+             6: (Q(1, 10**13), Q(1, 10**9)), 7: (Q(1, 10**30), Q(1, 10**18))}[b]
+        self.f0, self.f1, self.f2 = 0, _enc(b, Q(1), "n"), _enc(b, Q(2), "n")
+        self.feps, self.stol = _enc(b, k[0], "n"), _enc(b, k[1], "n")
+
+    def _nan(self, x, y, vx, vy):
+        if vx == "nan":
+            return x | self.quiet
+        if vy == "nan":
+            return y | self.quiet
+        return None
+
+    def _inf(self, neg):
+        return (int(neg) << self.neg_bit) | self.inf
+
+    def add(self, x, y):
+        (sx, vx), (sy, vy) = _dec(self.b, x), _dec(self.b, y)
+        nan = self._nan(x, y, vx, vy)
+        if nan is not None:
+            return nan
+        if vx == "inf" or vy == "inf":
+            if vx == "inf" and vy == "inf" and sx != sy:
+                return self.dnan
+            return self._inf(sx if vx == "inf" else sy)
+        # an exact zero sum keeps the sign two like-signed zeros share;
+        # otherwise it is +0, or -0 under %d
+        if vx == 0 and vy == 0 and sx == sy:
+            return _enc(self.b, vx + vy, self.mode, sx)
+        return _enc(self.b, vx + vy, self.mode, self.mode == "d")
+
+    def sub(self, x, y):
+        (sy, vy) = _dec(self.b, y)
+        if vy == "nan":
+            (sx, vx) = _dec(self.b, x)
+            return self._nan(x, y, vx, vy)
+        return self.add(x, y ^ (1 << self.neg_bit))
+
+    def mul(self, x, y):
+        (sx, vx), (sy, vy) = _dec(self.b, x), _dec(self.b, y)
+        nan = self._nan(x, y, vx, vy)
+        if nan is not None:
+            return nan
+        if vx == "inf" or vy == "inf":
+            if vx == 0 or vy == 0:
+                return self.dnan
+            return self._inf(sx != sy)
+        return _enc(self.b, vx * vy, self.mode, sx != sy)
+
+    def div(self, x, y):
+        (sx, vx), (sy, vy) = _dec(self.b, x), _dec(self.b, y)
+        nan = self._nan(x, y, vx, vy)
+        if nan is not None:
+            return nan
+        if vx == "inf":
+            return self.dnan if vy == "inf" else self._inf(sx != sy)
+        if vy == "inf":
+            return int(sx != sy) << self.neg_bit
+        if vy == 0:
+            return self.dnan if vx == 0 else self._inf(sx != sy)
+        return _enc(self.b, vx / vy, self.mode, sx != sy)
+
+    def le(self, x, y):
+        (sx, vx), (sy, vy) = _dec(self.b, x), _dec(self.b, y)
+        if "nan" in (vx, vy):
+            return False
+        def key(s, v):
+            return (1 if not s else -1, 0) if v == "inf" else (0, v)
+        return key(sx, vx) <= key(sy, vy)
+
+    def lt(self, x, y):
+        return self.le(x, y) and not self.le(y, x)
+
+    def sqrt(self, x):
+        """The stdlib +sqt: correctly rounded, unlike +fsqt below."""
+        (sx, vx) = _dec(self.b, x)
+        if vx == "nan":
+            return x | self.quiet
+        if vx == 0:
+            return x
+        if sx:
+            return self.dnan
+        if vx == "inf":
+            return x
+        # y = floor(sqrt(vx) * 2^k) with m + 8 bits; a sticky half bit if
+        # inexact, so one rounding of y (or y + 1/2) / 2^k is exact
+        m = FMT[self.b][1]
+        ex = vx.numerator.bit_length() - vx.denominator.bit_length()
+        k = m + 8 - ex // 2
+        sc = vx * Q(4) ** k
+        y = math.isqrt(sc.numerator // sc.denominator)
+        if y * y == sc:
+            return _enc(self.b, Q(y) / Q(2) ** k, self.mode)
+        return _enc(self.b, Q(2 * y + 1) / Q(2) ** (k + 1), self.mode)
+
+    def abs(self, x):
+        return self.sub(self.f0, x) if x >> self.neg_bit else x
+
+    def sqt(self, x):
+        if self.le(x, self.f0):
+            return self.f0
+        g = x
+        for _ in range(50):
+            ng = self.mul(self.div(self.f1, self.f2), self.add(g, self.div(x, g)))
+            if self.le(self.abs(self.sub(g, ng)), self.mul(self.feps, g)):
+                return ng
+            g = ng
+        return g
+
+    def near(self, x, y):
+        tol = self.add(self.stol, self.mul(self.stol, self.add(self.abs(x), self.abs(y))))
+        return self.le(self.abs(self.sub(x, y)), tol)
+
+
+def rr_pairs(n, r):
+    """Round [r] of +rr-pairs: (slot, p, q) for each non-dummy pair."""
+    w = n if n % 2 else n - 1
+    out = []
+    for k in range((w + 1) // 2):
+        x, y = (r, w) if k == 0 else ((r + k) % w, (r - k) % w)
+        p, q = min(x, y), max(x, y)
+        if q != n:
+            out.append((k, p, q))
+    return out
+
+
+def eig_bits(b, mode, rtol, a, n, par=False):
+    """+eig:(sake mode rtol) on an n x n %i754 ray of element bits [a]
+    (row-major), or +eig-par if [par].  Returns (vals, vecs, capped);
+    None if the arm would crash."""
+    f = Fl(b, mode)
+    if rtol == 1:
+        rtol = f.feps
+    if (rtol.bit_length() + 7) // 8 > (1 << (b - 3)):
+        return None
+    m = list(a)
+    if not all(f.near(m[i * n + j], m[j * n + i]) for i in range(n) for j in range(i)):
+        return None
+    v = [f.f1 if i == j else f.f0 for i in range(n) for j in range(n)]
+
+    def norm(dia):
+        acc = f.f0
+        for k in range(n * n):
+            if dia or k // n != k % n:
+                acc = f.add(acc, f.mul(m[k], m[k]))
+        return f.sqt(acc)
+
+    def jrot(p, q):
+        app, aqq, apq = m[p * n + p], m[q * n + q], m[p * n + q]
+        th = f.div(f.sub(aqq, app), f.mul(f.f2, apq))
+        sg = f.f1 if f.le(f.f0, th) else f.sub(f.f0, f.f1)
+        t = f.div(sg, f.add(f.abs(th), f.sqt(f.add(f.mul(th, th), f.f1))))
+        c = f.div(f.f1, f.sqt(f.add(f.mul(t, t), f.f1)))
+        return c, f.mul(t, c)
+
+    def rot_cols(x, p, q, c, s):
+        for i in range(n):
+            xp, xq = x[i * n + p], x[i * n + q]
+            x[i * n + p] = f.sub(f.mul(c, xp), f.mul(s, xq))
+            x[i * n + q] = f.add(f.mul(s, xp), f.mul(c, xq))
+
+    def rot_rows(x, p, q, c, s):
+        for j in range(n):
+            xp, xq = x[p * n + j], x[q * n + j]
+            x[p * n + j] = f.sub(f.mul(c, xp), f.mul(s, xq))
+            x[q * n + j] = f.add(f.mul(s, xp), f.mul(c, xq))
+
+    def sweep_once():
+        for p in range(n - 1):
+            for q in range(p + 1, n):
+                if m[p * n + q] == f.f0:
+                    continue
+                c, s = jrot(p, q)
+                rot_cols(m, p, q, c, s)
+                rot_rows(m, p, q, c, s)
+                rot_cols(v, p, q, c, s)
+
+    def sweep_par():
+        if n <= 1:
+            return
+        for r in range(n if n % 2 else n - 1):
+            rots = [(p, q) + jrot(p, q) for _, p, q in rr_pairs(n, r)
+                    if m[p * n + q] != f.f0]
+            for rot in rots:
+                rot_cols(m, *rot)
+            for rot in rots:
+                rot_rows(m, *rot)
+            for rot in rots:
+                rot_cols(v, *rot)
+
+    thresh = f.mul(rtol, norm(True))
+    for _ in range(60):
+        if f.le(norm(False), thresh):
+            return [m[i * n + i] for i in range(n)], v, False
+        sweep_par() if par else sweep_once()
+    return [m[i * n + i] for i in range(n)], v, True
+
+BITS_CASES = [
+    ("tri3", 3, [4, 1, -2, 1, 2, 0, -2, 0, 3]),
+    ("band4", 4, [2, -1, 0, Q(1, 2), -1, 2, -1, 0, 0, -1, 2, -1, Q(1, 2), 0, -1, 2]),
+    ("one1", 1, [Q(-5, 2)]),
+]
+PAR_CASES = BITS_CASES + [
+    ("odd5", 5, [4, 1, 0, Q(-1, 2), 2, 1, 3, 1, 0, 0, 0, 1, 2, 1, 0,
+                 Q(-1, 2), 0, 1, 5, -1, 2, 0, 0, -1, 1]),
+]
+BITS_RTOL = {4: Q(1, 100), 5: Q(1, 10**5), 6: Q(1, 10**12), 7: Q(1, 10**12)}
+BITS_AURA = {4: "rh", 5: "rs", 6: "rd", 7: "rq"}
+
+
+def hoon_hex(v):
+    """Dot-grouped Hoon hex atom (groups of 4 from the right)."""
+    h = f"{v:x}"
+    groups = []
+    while len(h) > 4:
+        groups.insert(0, h[-4:])
+        h = h[:-4]
+    groups.insert(0, h)
+    return "0x" + ".".join(groups)
+
+
+def ray_data(b, lanes):
+    """Lagoon %i754 data atom: lanes little-endian, 0x1 pin above the top."""
+    w = 1 << b
+    d = 1 << (w * len(lanes))
+    for i, x in enumerate(lanes):
+        d |= x << (w * i)
+    return d
+
+
+def emit_bits(par=False):
+    arm, flag = ("eig-par", "--bits --par") if par else ("eig", "--bits")
+    print(f"::  Bit-exact tests for Saloon symmetric-Jacobi +{arm}, every %i754 width")
+    print("::  and rounding mode.")
+    print("::")
+    print(f"::  GENERATED by saloon/tools/eig_check.py {flag} -- do not edit by hand.")
+    print("::  Expected bits come from an exact-arithmetic model of the Hoon loop;")
+    print("::  the saloon.c jet and the unjetted Hoon must both reproduce them.")
+    print("::  Cases that hit the sweep cap or go non-finite (a -0 pivot under %d")
+    print("::  spreads NaN, whose bits depend on the SoftFloat build) are skipped.")
+    if par:
+        print("::  The jet must match at any SALOON_THREADS; odd5 has a dummy slot.")
+    print("::")
+    print("/-  ls=lagoon")
+    print("/+  *test, *saloon")
+    print("|%")
+    print("++  mat  |=([n=@ b=@ d=@] ^-(ray:ls [[~[n n] b %i754 ~] d]))")
+    print("++  want")
+    print("  |=  [n=@ b=@ vals=@ vecs=@]")
+    print("  ^-  [vals=ray:ls vecs=ray:ls]")
+    print("  [[[~[n] b %i754 ~] vals] [[~[n n] b %i754 ~] vecs]]")
+    for name, n, a in (PAR_CASES if par else BITS_CASES):
+        for b in (4, 5, 6, 7):
+            bits = [_enc(b, Q(x), "n") for x in a]
+            rtol = _enc(b, BITS_RTOL[b], "n")
+            for mode in "nudz":
+                vals, vecs, cap = eig_bits(b, mode, rtol, bits, n, par)
+                if cap or any(_dec(b, x)[1] in ("nan", "inf") for x in vals + vecs):
+                    print(f"::  {name} @{BITS_AURA[b]} %{mode}: skipped (capped or non-finite)")
+                    continue
+                print(f"++  test-{name}-{BITS_AURA[b]}-{mode}")
+                print("  %+  expect-eq")
+                print(f"    !>  (want {n} {b} {hoon_hex(ray_data(b, vals))} {hoon_hex(ray_data(b, vecs))})")
+                print(f"  !>  ({arm}:(sake %{mode} `@r`{hoon_hex(rtol)}) (mat {n} {b} {hoon_hex(ray_data(b, bits))}))")
+    print("--")
+
+
 if __name__ == "__main__":
-    emit_hoon()
+    if "--bits" in sys.argv[1:]:
+        emit_bits("--par" in sys.argv[1:])
+    else:
+        emit_hoon()
@@ -10,12 +10,22 @@ complexN_t slot, real component in the low half, imag in the high half (little
 -endian) -- matching /lib/complex.  @cs = 2x@rs (64-bit, bloq 6); @cd = 2x@rd
 (128-bit, bloq 7).  Eigenvalues are real, emitted as the matching real width
 (@rs for cs, @rd for cd).
+
+With --bits it instead prints /tests/lib/saloon-eigh-bits.hoon: +eig-herm's
+exact output bits for small Hermitian matrices at every %cplx width and
+rounding mode, from an exact model of the Hoon loop (over eig_check.py's
+IEEE model), which the saloon.c jet and the unjetted Hoon must both match.
 """
 
 import struct
+import sys
+from fractions import Fraction as Q
 
 import numpy as np
 
+from eig_check import Fl, _dec, _enc, ray_data
+from eig_check import hoon_hex as hoon_hex_bits
+
 
 def f32_bits(x):
     return struct.unpack("<I", struct.pack("<f", float(x)))[0]
@@ -142,5 +152,171 @@ def emit():
     print("--")
 
 
+# ---------------------------------------------------------------------------
+# bit-exact model of +eig-herm (for --bits)
+# ---------------------------------------------------------------------------
+#
+# /lib/complex over the Fl component model, op for op: +mul as (ac - bd,
+# ad + bc), +div by Smith, +abs by hypot with the stdlib (correctly rounded)
+# +sqt, +conj and the complex +fabs as 0 - x where x < 0.  A %cplx element
+# is a (re, im) pair of component bits.
+
+def eigh_bits(cb, mode, rtol, a, n):
+    """+eig:(sake mode rtol) on an n x n %cplx ray of (re, im) bits [a]
+    (row-major).  Returns (vals, vecs, capped); None if +eig-herm would
+    crash.  vals are component bits, vecs (re, im) pairs."""
+    f = Fl(cb - 1, mode)
+    if rtol == 1:
+        rtol = f.feps
+    if (rtol.bit_length() + 7) // 8 > (1 << (cb - 4)):
+        return None
+
+    def fab(x):
+        return f.sub(f.f0, x) if f.lt(x, f.f0) else x
+
+    def cadd(p, q):
+        return (f.add(p[0], q[0]), f.add(p[1], q[1]))
+
+    def csub(p, q):
+        return (f.sub(p[0], q[0]), f.sub(p[1], q[1]))
+
+    def cmul(p, q):
+        return (f.sub(f.mul(p[0], q[0]), f.mul(p[1], q[1])),
+                f.add(f.mul(p[0], q[1]), f.mul(p[1], q[0])))
+
+    def conj(p):
+        return (p[0], f.sub(f.f0, p[1]))
+
+    def cdiv(p, q):
+        (ar, ai), (br, bi) = p, q
+        if f.le(fab(bi), fab(br)):
+            r = f.div(bi, br)
+            dn = f.add(br, f.mul(bi, r))
+            return (f.div(f.add(ar, f.mul(ai, r)), dn),
+                    f.div(f.sub(ai, f.mul(ar, r)), dn))
+        r = f.div(br, bi)
+        dn = f.add(f.mul(br, r), bi)
+        return (f.div(f.add(f.mul(ar, r), ai), dn),
+                f.div(f.sub(f.mul(ai, r), ar), dn))
+
+    def cabs(p):
+        xr, xi = fab(p[0]), fab(p[1])
+        if xr == f.f0 and xi == f.f0:
+            return f.f0
+        if f.le(xi, xr):
+            t = f.div(xi, xr)
+            return f.mul(xr, f.sqrt(f.add(f.f1, f.mul(t, t))))
+        t = f.div(xr, xi)
+        return f.mul(xi, f.sqrt(f.add(f.f1, f.mul(t, t))))
+
+    def cnear(x, y):
+        tol = f.add(f.stol, f.mul(f.stol, f.add(cabs(x), cabs(y))))
+        return f.le(cabs(csub(x, conj(y))), tol)
+
+    m = list(a)
+    if not all(cnear(m[i * n + j], m[j * n + i])
+               for i in range(n) for j in range(i + 1)):
+        return None
+    z = (f.f0, f.f0)
+    v = [(f.f1, f.f0) if i == j else z for i in range(n) for j in range(n)]
+
+    def norm(dia):
+        acc = f.f0
+        for k in range(n * n):
+            if dia or k // n != k % n:
+                mag = cabs(m[k])
+                acc = f.add(acc, f.mul(mag, mag))
+        return f.sqt(acc)
+
+    def rot_cols(x, p, q, cc, b):
+        for i in range(n):
+            xp, xq = x[i * n + p], x[i * n + q]
+            x[i * n + p] = csub(cmul(cc, xp), cmul(conj(b), xq))
+            x[i * n + q] = cadd(cmul(b, xp), cmul(cc, xq))
+
+    thresh = f.mul(rtol, norm(True))
+    for _ in range(60):
+        if f.le(norm(False), thresh):
+            return [m[i * n + i][0] for i in range(n)], v, False
+        for p in range(n - 1):
+            for q in range(p + 1, n):
+                apq = m[p * n + q]
+                mag = cabs(apq)
+                if mag == f.f0:
+                    continue
+                app, aqq = m[p * n + p][0], m[q * n + q][0]
+                tau = f.div(f.sub(aqq, app), f.mul(f.f2, mag))
+                sg = f.f1 if f.le(f.f0, tau) else f.sub(f.f0, f.f1)
+                t = f.div(sg, f.add(f.abs(tau), f.sqt(f.add(f.mul(tau, tau), f.f1))))
+                c = f.div(f.f1, f.sqt(f.add(f.mul(t, t), f.f1)))
+                s = f.mul(t, c)
+                b = cmul((s, f.f0), cdiv(apq, (mag, f.f0)))
+                cc = (c, f.f0)
+                rot_cols(m, p, q, cc, b)
+                for j in range(n):
+                    xp, xq = m[p * n + j], m[q * n + j]
+                    m[p * n + j] = csub(cmul(cc, xp), cmul(b, xq))
+                    m[q * n + j] = cadd(cmul(conj(b), xp), cmul(cc, xq))
+                rot_cols(v, p, q, cc, b)
+    return [m[i * n + i][0] for i in range(n)], v, True
+
+
+BITS_CASES = [
+    ("h2", 2, [2, 1 + 1j, 1 - 1j, 3]),
+    ("h3", 3, [4, 1j, 0.5 - 0.5j, -1j, 2, 1, 0.5 + 0.5j, 1, 3]),
+    ("one1", 1, [-2.5]),
+]
+BITS_RTOL = {5: Q(1, 100), 6: Q(1, 10**5), 7: Q(1, 10**12), 8: Q(1, 10**12)}
+BITS_AURA = {5: "ch", 6: "cs", 7: "cd", 8: "cq"}
+
+
+def emit_bits():
+    print("::  Bit-exact tests for Saloon Hermitian-Jacobi +eig (+eig-herm), every")
+    print("::  %cplx width and rounding mode.")
+    print("::")
+    print("::  GENERATED by saloon/tools/eigh_check.py --bits -- do not edit by hand.")
+    print("::  Expected bits come from an exact-arithmetic model of the Hoon loop;")
+    print("::  the saloon.c jet and the unjetted Hoon must both reproduce them.")
+    print("::  Cases that hit the sweep cap or go non-finite are skipped, as is")
+    print("::  every %d case: there +cnear's a - conj(conj a) is -0 + 0i, whose")
+    print("::  /lib/complex +abs is NaN (+0/-0), so +hermitian rejects any input.")
+    print("::")
+    print("/-  ls=lagoon")
+    print("/+  *test, *saloon")
+    print("|%")
+    print("++  mat  |=([n=@ b=@ d=@] ^-(ray:ls [[~[n n] b %cplx ~] d]))")
+    print("++  want")
+    print("  |=  [n=@ b=@ vals=@ vecs=@]")
+    print("  ^-  [vals=ray:ls vecs=ray:ls]")
+    print("  [[[~[n] (dec b) %i754 ~] vals] [[~[n n] b %cplx ~] vecs]]")
+    for name, n, a in BITS_CASES:
+        for cb in (5, 6, 7, 8):
+            rb, w = cb - 1, 1 << (cb - 1)
+            bits = [(_enc(rb, Q(complex(x).real), "n"), _enc(rb, Q(complex(x).imag), "n"))
+                    for x in a]
+            rtol = _enc(rb, BITS_RTOL[cb], "n")
+            for mode in "nudz":
+                res = eigh_bits(cb, mode, rtol, bits, n)
+                if res is None:
+                    print(f"::  {name} @{BITS_AURA[cb]} %{mode}: skipped (+hermitian fails)")
+                    continue
+                vals, vecs, cap = res
+                comps = vals + [x for p in vecs for x in p]
+                if cap or any(_dec(rb, x)[1] in ("nan", "inf") for x in comps):
+                    print(f"::  {name} @{BITS_AURA[cb]} %{mode}: skipped (capped or non-finite)")
+                    continue
+                lanes = lambda ps: [r | (i << w) for r, i in ps]
+                print(f"++  test-{name}-{BITS_AURA[cb]}-{mode}")
+                print("  %+  expect-eq")
+                print(f"    !>  (want {n} {cb} {hoon_hex_bits(ray_data(rb, vals))} "
+                      f"{hoon_hex_bits(ray_data(cb, lanes(vecs)))})")
+                print(f"  !>  (eig:(sake %{mode} `@r`{hoon_hex_bits(rtol)}) "
+                      f"(mat {n} {cb} {hoon_hex_bits(ray_data(cb, lanes(bits)))}))")
+    print("--")
+
+
 if __name__ == "__main__":
-    emit()
+    if "--bits" in sys.argv[1:]:
+        emit_bits()
+    else:
+        emit()
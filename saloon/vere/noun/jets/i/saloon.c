@@ -0,0 +1,942 @@
+/// @file
+///
+/// Jets for Saloon's ray transcendentals (`++sa` in saloon.hoon, registered
+/// as `saloon/sa-core/<arm>`).  Each arm is an `el-wise-op`/`bin-op` over a
+/// libmath scalar gate, which in Hoon costs a gate slam and a fresh atom per
+/// element.  For `%i754` rays the jet hands the whole data atom to libmath's
+/// `u3qi_math_ray`, which runs the same kernel over every lane in one pass,
+/// so each lane is bit-exact to the scalar jet.  Other kinds (`%unum`,
+/// `%cplx`) and malformed rays punt to the Hoon.
+///
+/// `eig` runs the whole symmetric or Hermitian Jacobi loop over unpacked lanes,
+/// op for op as the Hoon does it, so its eigenpairs are the Hoon's bits.
+
+#include "jets/q.h"
+#include "jets/w.h"
+
+#include "noun.h"
+#include "softfloat.h"
+
+#include <pthread.h>  // eig-par workers
+#include <stdlib.h>   // getenv(), strtoull()
+#include <string.h>   // memcpy
+#include <unistd.h>   // sysconf()
+
+/* unpack a [kin] ray of bloq [lo] to [hi]: [met] its meta, [dat] its data,
+** [blq] its bloq, [len] its element count.  c3n unless the data fits its
+** shape.
+*/
+  static c3_o
+  _sa_ray(u3_noun ray, c3_m kin, c3_y lo, c3_y hi,
+          u3_noun* met, u3_atom* dat, c3_y* blq, c3_d* len)
+  {
+    u3_noun shp, bloq, kind, tal;
+
+    if ( c3n == u3r_cell(ray, met, dat) ||
+         c3n == u3ud(*dat) ||
+         c3n == u3r_qual(*met, &shp, &bloq, &kind, &tal) ||
+         kin != kind ||
+         c3n == u3a_is_cat(bloq) ||
+         bloq < lo || bloq > hi )
+    {
+      return c3n;
+    }
+
+    c3_d len_d = 1;
+    while ( u3_nul != shp ) {
+      if ( c3n == u3a_is_cat(u3h(shp)) ) return c3n;
+      len_d *= u3h(shp);
+      shp = u3t(shp);
+    }
+    if ( len_d + 1 != u3r_met((c3_y)bloq, *dat) ) return c3n;
+
+    *blq = (c3_y)bloq;
+    *len = len_d;
+    return c3y;
+  }
+
+/* unpack an %i754 ray, as _sa_ray().
+*/
+  static inline c3_o
+  _sa_i754(u3_noun ray, u3_noun* met, u3_atom* dat, c3_y* blq, c3_d* len)
+  {
+    return _sa_ray(ray, c3__i754, 4, 7, met, dat, blq, len);
+  }
+
+/* one-ray arms: sample is the ray; the door's rnd is axis 60, as for the
+** math doors.
+*/
+  static u3_noun
+  _sa_ray1(u3_noun cor, const c3_c* fun_c)
+  {
+    u3_noun met;
+    u3_atom dat;
+    c3_y    blq;
+    c3_d    len;
+
+    if ( c3n == _sa_i754(u3r_at(u3x_sam, cor), &met, &dat, &blq, &len) ) {
+      return u3_none;
+    }
+
+    u3_noun r_data = u3qi_math_ray(fun_c, blq, len, dat, u3_none,
+                                   (c3_y)u3r_at(60, cor));
+    if ( u3_none == r_data ) return u3_none;
+    return u3nc(u3k(met), r_data);
+  }
+
+/* two-ray arms: sample is [a b]; bin-op wants matching metas.
+*/
+  static u3_noun
+  _sa_ray2(u3_noun cor, const c3_c* fun_c)
+  {
+    u3_noun a, b, met, bet;
+    u3_atom dat, bat;
+    c3_y    blq;
+    c3_d    len;
+
+    if ( c3n == u3r_mean(cor, u3x_sam_2, &a, u3x_sam_3, &b, 0) ||
+         c3n == _sa_i754(a, &met, &dat, &blq, &len) ||
+         c3n == _sa_i754(b, &bet, &bat, &blq, &len) ||
+         c3n == u3r_sing(met, bet) )
+    {
+      return u3_none;
+    }
+
+    u3_noun r_data = u3qi_math_ray(fun_c, blq, len, dat, bat,
+                                   (c3_y)u3r_at(60, cor));
+    if ( u3_none == r_data ) return u3_none;
+    return u3nc(u3k(met), r_data);
+  }
+
+/* sincos: both rays from one reduction per lane; [(sin a) (cos a)].
+*/
+  u3_noun
+  u3wi_sa_sincos(u3_noun cor)
+  {
+    u3_noun met, sin, cos;
+    u3_atom dat;
+    c3_y    blq;
+    c3_d    len;
+
+    if ( c3n == _sa_i754(u3r_at(u3x_sam, cor), &met, &dat, &blq, &len) ) {
+      return u3_none;
+    }
+
+    u3_noun r_data = u3qi_math_ray_sincos(blq, len, dat);
+    if ( u3_none == r_data ) return u3_none;
+    u3x_cell(r_data, &sin, &cos);
+    u3_noun pro = u3nc(u3nc(u3k(met), u3k(sin)), u3nc(u3k(met), u3k(cos)));
+    u3z(r_data);
+    return pro;
+  }
+
+  u3_noun u3wi_sa_exp(u3_noun cor)     { return _sa_ray1(cor, "exp"); }
+  u3_noun u3wi_sa_sin(u3_noun cor)     { return _sa_ray1(cor, "sin"); }
+  u3_noun u3wi_sa_cos(u3_noun cor)     { return _sa_ray1(cor, "cos"); }
+  u3_noun u3wi_sa_tan(u3_noun cor)     { return _sa_ray1(cor, "tan"); }
+  u3_noun u3wi_sa_log(u3_noun cor)     { return _sa_ray1(cor, "log"); }
+  u3_noun u3wi_sa_log10(u3_noun cor)   { return _sa_ray1(cor, "log-10"); }
+  u3_noun u3wi_sa_log2(u3_noun cor)    { return _sa_ray1(cor, "log-2"); }
+  u3_noun u3wi_sa_sqrt(u3_noun cor)    { return _sa_ray1(cor, "sqt"); }
+  u3_noun u3wi_sa_cbrt(u3_noun cor)    { return _sa_ray1(cor, "cbt"); }
+  u3_noun u3wi_sa_pow_n(u3_noun cor)   { return _sa_ray2(cor, "pow-n"); }
+  u3_noun u3wi_sa_pow(u3_noun cor)     { return _sa_ray2(cor, "pow"); }
+
+/* eig: Jacobi, saloon.hoon ++eig (symmetric %i754) and ++eig-herm
+** (Hermitian %cplx).
+**
+** A transcription of the Hoon, op for op: the same cyclic p<q order, the
+** same +fsqt Newton (feps, 50-step cap), +fsign, +fabs (0 - x, not a sign
+** flip), +off-norm/+frob accumulation order and 60-sweep cap, each op
+** rounded per the door's rnd.  So the jet returns the Hoon's bits, not just
+** a close answer.  A non-square, asymmetric or non-Hermitian matrix, or a
+** bad rtol, punts; the Hoon crashes with its own message.
+*/
+  static inline c3_y
+  _sa_sf_mode(c3_y rnd)
+  {
+    switch ( rnd ) {
+      default:     return softfloat_round_minMag;
+      case c3__n:  return softfloat_round_near_even;
+      case c3__u:  return softfloat_round_max;
+      case c3__d:  return softfloat_round_min;
+    }
+  }
+
+  //  @rq ops by value, so the f128 Jacobi reads like the others.
+  static inline float128_t
+  _sa_q_add(float128_t a, float128_t b) { float128_t c; f128M_add(&a, &b, &c); return c; }
+  static inline float128_t
+  _sa_q_sub(float128_t a, float128_t b) { float128_t c; f128M_sub(&a, &b, &c); return c; }
+  static inline float128_t
+  _sa_q_mul(float128_t a, float128_t b) { float128_t c; f128M_mul(&a, &b, &c); return c; }
+  static inline float128_t
+  _sa_q_div(float128_t a, float128_t b) { float128_t c; f128M_div(&a, &b, &c); return c; }
+  static inline bool
+  _sa_q_le(float128_t a, float128_t b)  { return f128M_le(&a, &b); }
+  static inline bool
+  _sa_q_lt(float128_t a, float128_t b)  { return f128M_lt(&a, &b); }
+  static inline float128_t
+  _sa_q_sqrt(float128_t a)              { float128_t c; f128M_sqrt(&a, &c); return c; }
+
+  #define _sa_h_nul(x)  ( 0 == (x).v )
+  #define _sa_s_nul(x)  ( 0 == (x).v )
+  #define _sa_d_nul(x)  ( 0 == (x).v )
+  #define _sa_q_nul(x)  ( 0 == ((x).v[0] | (x).v[1]) )
+  #define _sa_h_neg(x)  ( (x).v >> 15 )
+  #define _sa_s_neg(x)  ( (x).v >> 31 )
+  #define _sa_d_neg(x)  ( (x).v >> 63 )
+  #define _sa_q_neg(x)  ( (x).v[1] >> 63 )
+
+  //  +f0 +f1 +f2 +feps +stol, per width.
+  static const float16_t  _sa_h_k[5] = { {0}, {0x3c00}, {0x4000},
+                                         {0x211f}, {0x211f} };
+  static const float32_t  _sa_s_k[5] = { {0}, {0x3f800000}, {0x40000000},
+                                         {0x358637bd}, {0x38d1b717} };
+  static const float64_t  _sa_d_k[5] = { {0}, {0x3ff0000000000000ULL},
+                                         {0x4000000000000000ULL},
+                                         {0x3d3c25c268497682ULL},
+                                         {0x3e112e0be826d695ULL} };
+  static const float128_t _sa_q_k[5] = {
+    {{0, 0}},
+    {{0, 0x3fff000000000000ULL}},
+    {{0, 0x4000000000000000ULL}},
+    {{0xf863424b06f3529aULL, 0x3f9b4484bfeebc29ULL}},
+    {{0xba0e75fe645cc487ULL, 0x3fc32725dd1d243aULL}},
+  };
+
+/* _SA_JACOBI: the Jacobi arms for one width [w], element type [T], ops
+** [add sub mul div le] in the current SoftFloat mode.
+*/
+#define _SA_JACOBI(w, T, add, sub, mul, div, le)                             \
+  static inline T                                                            \
+  _sa_##w##_abs(T x)                                                         \
+  {                                                                          \
+    return _sa_##w##_neg(x) ? sub(_sa_##w##_k[0], x) : x;                    \
+  }                                                                          \
+                                                                             \
+  /* +fsqt */                                                                \
+  static T                                                                   \
+  _sa_##w##_sqt(T x)                                                         \
+  {                                                                          \
+    const T* k = _sa_##w##_k;                                                \
+    if ( le(x, k[0]) ) return k[0];                                          \
+    T g = x;                                                                 \
+    for ( c3_w i = 0; i < 50; i++ ) {                                        \
+      T ng = mul(div(k[1], k[2]), add(g, div(x, g)));                        \
+      if ( le(_sa_##w##_abs(sub(g, ng)), mul(k[3], g)) ) return ng;          \
+      g = ng;                                                                \
+    }                                                                        \
+    return g;                                                                \
+  }                                                                          \
+                                                                             \
+  /* +symmetric, by +near */                                                 \
+  static c3_o                                                                \
+  _sa_##w##_sym(c3_d n, const T* m)                                          \
+  {                                                                          \
+    const T* k = _sa_##w##_k;                                                \
+    for ( c3_d i = 1; i < n; i++ ) {                                         \
+      for ( c3_d j = 0; j < i; j++ ) {                                       \
+        T x = m[i*n + j], y = m[j*n + i];                                    \
+        T tol = add(k[4], mul(k[4], add(_sa_##w##_abs(x),                    \
+                                        _sa_##w##_abs(y))));                 \
+        if ( !le(_sa_##w##_abs(sub(x, y)), tol) ) return c3n;                \
+      }                                                                      \
+    }                                                                        \
+    return c3y;                                                              \
+  }                                                                          \
+                                                                             \
+  /* +off-norm ([dia] c3n) and +frob ([dia] c3y), row-major */               \
+  static T                                                                   \
+  _sa_##w##_norm(c3_d n, const T* m, c3_o dia)                               \
+  {                                                                          \
+    T acc = _sa_##w##_k[0];                                                  \
+    for ( c3_d i = 0; i < n; i++ ) {                                         \
+      for ( c3_d j = 0; j < n; j++ ) {                                       \
+        if ( (i == j) && (c3n == dia) ) continue;                            \
+        acc = add(acc, mul(m[i*n + j], m[i*n + j]));                         \
+      }                                                                      \
+    }                                                                        \
+    return _sa_##w##_sqt(acc);                                               \
+  }                                                                          \
+                                                                             \
+  /* +jrot: the (c, s) that zeros a nonzero a_pq */                          \
+  static void                                                                \
+  _sa_##w##_jrot(T app, T aqq, T apq, T* c, T* s)                            \
+  {                                                                          \
+    const T* k = _sa_##w##_k;                                                \
+    T the = div(sub(aqq, app), mul(k[2], apq));                              \
+    T sig = le(k[0], the) ? k[1] : sub(k[0], k[1]);                          \
+    T t   = div(sig, add(_sa_##w##_abs(the),                                 \
+                         _sa_##w##_sqt(add(mul(the, the), k[1]))));          \
+    *c = div(k[1], _sa_##w##_sqt(add(mul(t, t), k[1])));                     \
+    *s = mul(t, *c);                                                         \
+  }                                                                          \
+                                                                             \
+  /* +rot-cols: x <- x*J */                                                  \
+  static void                                                                \
+  _sa_##w##_rcol(c3_d n, T* x, c3_d p, c3_d q, T c, T s)                     \
+  {                                                                          \
+    for ( c3_d i = 0; i < n; i++ ) {                                         \
+      T xip = x[i*n + p], xiq = x[i*n + q];                                  \
+      x[i*n + p] = sub(mul(c, xip), mul(s, xiq));                            \
+      x[i*n + q] = add(mul(s, xip), mul(c, xiq));                            \
+    }                                                                        \
+  }                                                                          \
+                                                                             \
+  /* +rot-rows: x <- J^T*x */                                                \
+  static void                                                                \
+  _sa_##w##_rrow(c3_d n, T* x, c3_d p, c3_d q, T c, T s)                     \
+  {                                                                          \
+    for ( c3_d j = 0; j < n; j++ ) {                                         \
+      T xpj = x[p*n + j], xqj = x[q*n + j];                                  \
+      x[p*n + j] = sub(mul(c, xpj), mul(s, xqj));                            \
+      x[q*n + j] = add(mul(s, xpj), mul(c, xqj));                            \
+    }                                                                        \
+  }                                                                          \
+                                                                             \
+  /* +sweep-once: m <- J^T*m*J (+rot-cols, then +rot-rows), v <- v*J */      \
+  static void                                                                \
+  _sa_##w##_sweep(c3_d n, T* m, T* v)                                        \
+  {                                                                          \
+    for ( c3_d p = 0; p + 1 < n; p++ ) {                                     \
+      for ( c3_d q = p + 1; q < n; q++ ) {                                   \
+        T apq = m[p*n + q], c, s;                                            \
+        if ( _sa_##w##_nul(apq) ) continue;                                  \
+        _sa_##w##_jrot(m[p*n + p], m[q*n + q], apq, &c, &s);                 \
+        _sa_##w##_rcol(n, m, p, q, c, s);                                    \
+        _sa_##w##_rrow(n, m, p, q, c, s);                                    \
+        _sa_##w##_rcol(n, v, p, q, c, s);                                    \
+      }                                                                      \
+    }                                                                        \
+  }                                                                          \
+                                                                             \
+  /* the +eig loop over [n]x[n] [m] (in place; its diagonal becomes the   */ \
+  /* eigenvalues) and [v] (eye on entry).  [tol] is rtol's bits; c3n if   */ \
+  /* asymmetric, else [*cap] is c3y if the 60-sweep cap was hit.          */ \
+  static c3_o                                                                \
+  _sa_##w##_eig(c3_d n, T* m, T* v, const c3_y* tol, c3_o* cap)              \
+  {                                                                          \
+    T rtol;                                                                  \
+    memcpy(&rtol, tol, sizeof(T));                                           \
+    if ( c3n == _sa_##w##_sym(n, m) ) return c3n;                            \
+    for ( c3_d i = 0; i < n; i++ ) {                                         \
+      v[i*n + i] = _sa_##w##_k[1];                                           \
+    }                                                                        \
+    T thresh = mul(rtol, _sa_##w##_norm(n, m, c3y));                         \
+    *cap = c3y;                                                              \
+    for ( c3_w sweep = 0; sweep < 60; sweep++ ) {                            \
+      if ( le(_sa_##w##_norm(n, m, c3n), thresh) ) {                         \
+        *cap = c3n;                                                          \
+        break;                                                               \
+      }                                                                      \
+      if ( n > 1 ) _sa_##w##_sweep(n, m, v);                                 \
+    }                                                                        \
+    return c3y;                                                              \
+  }
+
+  _SA_JACOBI(h, float16_t,  f16_add, f16_sub, f16_mul, f16_div, f16_le)
+  _SA_JACOBI(s, float32_t,  f32_add, f32_sub, f32_mul, f32_div, f32_le)
+  _SA_JACOBI(d, float64_t,  f64_add, f64_sub, f64_mul, f64_div, f64_le)
+  _SA_JACOBI(q, float128_t, _sa_q_add, _sa_q_sub, _sa_q_mul, _sa_q_div,
+                            _sa_q_le)
+
+/* _SA_HERM: the Hermitian Jacobi arms for width [w] over the real arms of
+** _SA_JACOBI, plus [lt] and [sqt].  An element is an unpacked [re im] pair,
+** as a %cplx lane lies in memory (real low).  The complex ops are
+** /lib/complex's, op for op: +mul as (ac - bd, ad + bc), +div by Smith,
+** +abs by hypot, +conj and its +fabs as 0 - x where x < 0 (so -0 stays -0,
+** unlike +fabs above).
+*/
+#define _SA_HERM(w, T, add, sub, mul, div, le, lt, sqt)                      \
+  typedef struct { T r; T i; } _sa_##w##c;                                   \
+                                                                             \
+  static inline T                                                            \
+  _sa_##w##_cfab(T x)                                                        \
+  {                                                                          \
+    return lt(x, _sa_##w##_k[0]) ? sub(_sa_##w##_k[0], x) : x;               \
+  }                                                                          \
+                                                                             \
+  static inline _sa_##w##c                                                   \
+  _sa_##w##_cadd(_sa_##w##c p, _sa_##w##c q)                                 \
+  {                                                                          \
+    return (_sa_##w##c){ add(p.r, q.r), add(p.i, q.i) };                     \
+  }                                                                          \
+                                                                             \
+  static inline _sa_##w##c                                                   \
+  _sa_##w##_csub(_sa_##w##c p, _sa_##w##c q)                                 \
+  {                                                                          \
+    return (_sa_##w##c){ sub(p.r, q.r), sub(p.i, q.i) };                     \
+  }                                                                          \
+                                                                             \
+  static inline _sa_##w##c                                                   \
+  _sa_##w##_cmul(_sa_##w##c p, _sa_##w##c q)                                 \
+  {                                                                          \
+    return (_sa_##w##c){ sub(mul(p.r, q.r), mul(p.i, q.i)),                  \
+                         add(mul(p.r, q.i), mul(p.i, q.r)) };                \
+  }                                                                          \
+                                                                             \
+  static inline _sa_##w##c                                                   \
+  _sa_##w##_conj(_sa_##w##c p)                                               \
+  {                                                                          \
+    return (_sa_##w##c){ p.r, sub(_sa_##w##_k[0], p.i) };                    \
+  }                                                                          \
+                                                                             \
+  static _sa_##w##c                                                          \
+  _sa_##w##_cdiv(_sa_##w##c p, _sa_##w##c q)                                 \
+  {                                                                          \
+    T r, dn;                                                                 \
+    if ( le(_sa_##w##_cfab(q.i), _sa_##w##_cfab(q.r)) ) {                    \
+      r  = div(q.i, q.r);                                                    \
+      dn = add(q.r, mul(q.i, r));                                            \
+      return (_sa_##w##c){ div(add(p.r, mul(p.i, r)), dn),                   \
+                           div(sub(p.i, mul(p.r, r)), dn) };                 \
+    }                                                                        \
+    r  = div(q.r, q.i);                                                      \
+    dn = add(mul(q.r, r), q.i);                                              \
+    return (_sa_##w##c){ div(add(mul(p.r, r), p.i), dn),                     \
+                         div(sub(mul(p.i, r), p.r), dn) };                   \
+  }                                                                          \
+                                                                             \
+  /* +cabs-re */                                                             \
+  static T                                                                   \
+  _sa_##w##_cabs(_sa_##w##c p)                                               \
+  {                                                                          \
+    const T* k = _sa_##w##_k;                                                \
+    T xr = _sa_##w##_cfab(p.r), xi = _sa_##w##_cfab(p.i), t;                 \
+    if ( _sa_##w##_nul(xr) && _sa_##w##_nul(xi) ) return k[0];               \
+    if ( le(xi, xr) ) {                                                      \
+      t = div(xi, xr);                                                       \
+      return mul(xr, sqt(add(k[1], mul(t, t))));                             \
+    }                                                                        \
+    t = div(xr, xi);                                                         \
+    return mul(xi, sqt(add(k[1], mul(t, t))));                               \
+  }                                                                          \
+                                                                             \
+  /* +hermitian, by +cnear (the diagonal too) */                             \
+  static c3_o                                                                \
+  _sa_##w##_her(c3_d n, const _sa_##w##c* m)                                 \
+  {                                                                          \
+    const T* k = _sa_##w##_k;                                                \
+    for ( c3_d i = 0; i < n; i++ ) {                                         \
+      for ( c3_d j = 0; j <= i; j++ ) {                                      \
+        _sa_##w##c x = m[i*n + j], y = m[j*n + i];                           \
+        T tol = add(k[4], mul(k[4], add(_sa_##w##_cabs(x),                   \
+                                        _sa_##w##_cabs(y))));                \
+        T dif = _sa_##w##_cabs(_sa_##w##_csub(x, _sa_##w##_conj(y)));        \
+        if ( !le(dif, tol) ) return c3n;                                     \
+      }                                                                      \
+    }                                                                        \
+    return c3y;                                                              \
+  }                                                                          \
+                                                                             \
+  /* +off-norm-h ([dia] c3n) and +frob-h ([dia] c3y), row-major */           \
+  static T                                                                   \
+  _sa_##w##_hnorm(c3_d n, const _sa_##w##c* m, c3_o dia)                     \
+  {                                                                          \
+    T acc = _sa_##w##_k[0];                                                  \
+    for ( c3_d i = 0; i < n; i++ ) {                                         \
+      for ( c3_d j = 0; j < n; j++ ) {                                       \
+        if ( (i == j) && (c3n == dia) ) continue;                            \
+        T mag = _sa_##w##_cabs(m[i*n + j]);                                  \
+        acc = add(acc, mul(mag, mag));                                       \
+      }                                                                      \
+    }                                                                        \
+    return _sa_##w##_sqt(acc);                                               \
+  }                                                                          \
+                                                                             \
+  /* +rot-cols-h: x <- x*J, J[p,q] = b, J[q,p] = -conj(b) */                 \
+  static void                                                                \
+  _sa_##w##_hcols(c3_d n, _sa_##w##c* x, c3_d p, c3_d q,                     \
+                  _sa_##w##c cc, _sa_##w##c b, _sa_##w##c bh)                \
+  {                                                                          \
+    for ( c3_d i = 0; i < n; i++ ) {                                         \
+      _sa_##w##c xp = x[i*n + p], xq = x[i*n + q];                           \
+      x[i*n + p] = _sa_##w##_csub(_sa_##w##_cmul(cc, xp),                    \
+                                  _sa_##w##_cmul(bh, xq));                   \
+      x[i*n + q] = _sa_##w##_cadd(_sa_##w##_cmul(b, xp),                     \
+                                  _sa_##w##_cmul(cc, xq));                   \
+    }                                                                        \
+  }                                                                          \
+                                                                             \
+  /* +sweep-herm: m <- J^H*m*J (+rot-cols-h, then +rot-rows-h), v <- v*J */  \
+  static void                                                                \
+  _sa_##w##_hsweep(c3_d n, _sa_##w##c* m, _sa_##w##c* v)                     \
+  {                                                                          \
+    const T* k = _sa_##w##_k;                                                \
+    for ( c3_d p = 0; p + 1 < n; p++ ) {                                     \
+      for ( c3_d q = p + 1; q < n; q++ ) {                                   \
+        _sa_##w##c apq = m[p*n + q];                                         \
+        T mag = _sa_##w##_cabs(apq);                                         \
+        if ( _sa_##w##_nul(mag) ) continue;                                  \
+        T app = m[p*n + p].r, aqq = m[q*n + q].r;                            \
+        T tau = div(sub(aqq, app), mul(k[2], mag));                          \
+        T sig = le(k[0], tau) ? k[1] : sub(k[0], k[1]);                      \
+        T t   = div(sig, add(_sa_##w##_abs(tau),                             \
+                             _sa_##w##_sqt(add(mul(tau, tau), k[1]))));      \
+        T c   = div(k[1], _sa_##w##_sqt(add(mul(t, t), k[1])));              \
+        T s   = mul(t, c);                                                   \
+        _sa_##w##c pha = _sa_##w##_cdiv(apq, (_sa_##w##c){ mag, k[0] });     \
+        _sa_##w##c b   = _sa_##w##_cmul((_sa_##w##c){ s, k[0] }, pha);       \
+        _sa_##w##c bh  = _sa_##w##_conj(b);                                  \
+        _sa_##w##c cc  = { c, k[0] };                                        \
+        _sa_##w##_hcols(n, m, p, q, cc, b, bh);                              \
+        for ( c3_d j = 0; j < n; j++ ) {                                     \
+          _sa_##w##c mp = m[p*n + j], mq = m[q*n + j];                       \
+          m[p*n + j] = _sa_##w##_csub(_sa_##w##_cmul(cc, mp),                \
+                                      _sa_##w##_cmul(b, mq));                \
+          m[q*n + j] = _sa_##w##_cadd(_sa_##w##_cmul(bh, mp),                \
+                                      _sa_##w##_cmul(cc, mq));               \
+        }                                                                    \
+        _sa_##w##_hcols(n, v, p, q, cc, b, bh);                              \
+      }                                                                      \
+    }                                                                        \
+  }                                                                          \
+                                                                             \
+  /* the +eig-herm loop, as _sa_##w##_eig() over [re im] pairs.           */ \
+  static c3_o                                                                \
+  _sa_##w##_herm(c3_d n, T* m_t, T* v_t, const c3_y* tol, c3_o* cap)         \
+  {                                                                          \
+    _sa_##w##c* m = (_sa_##w##c*)m_t;                                        \
+    _sa_##w##c* v = (_sa_##w##c*)v_t;                                        \
+    T rtol;                                                                  \
+    memcpy(&rtol, tol, sizeof(T));                                           \
+    if ( c3n == _sa_##w##_her(n, m) ) return c3n;                            \
+    for ( c3_d i = 0; i < n; i++ ) {                                         \
+      v[i*n + i].r = _sa_##w##_k[1];                                         \
+    }                                                                        \
+    T thresh = mul(rtol, _sa_##w##_hnorm(n, m, c3y));                        \
+    *cap = c3y;                                                              \
+    for ( c3_w sweep = 0; sweep < 60; sweep++ ) {                            \
+      if ( le(_sa_##w##_hnorm(n, m, c3n), thresh) ) {                        \
+        *cap = c3n;                                                          \
+        break;                                                               \
+      }                                                                      \
+      if ( n > 1 ) _sa_##w##_hsweep(n, m, v);                                \
+    }                                                                        \
+    return c3y;                                                              \
+  }
+
+  _SA_HERM(h, float16_t,  f16_add, f16_sub, f16_mul, f16_div, f16_le,
+                          f16_lt, f16_sqrt)
+  _SA_HERM(s, float32_t,  f32_add, f32_sub, f32_mul, f32_div, f32_le,
+                          f32_lt, f32_sqrt)
+  _SA_HERM(d, float64_t,  f64_add, f64_sub, f64_mul, f64_div, f64_le,
+                          f64_lt, f64_sqrt)
+  _SA_HERM(q, float128_t, _sa_q_add, _sa_q_sub, _sa_q_mul, _sa_q_div,
+                          _sa_q_le, _sa_q_lt, _sa_q_sqrt)
+
+/* eig-par: saloon.hoon ++eig-par, symmetric Jacobi in round-robin order.
+**
+** A sweep is w rounds (w = n-1, or n for odd n) of +rr-pairs; a round
+** takes every angle from m as it stood at the round's start, then runs
+** three passes: the column rotations of m and v, then the row rotations
+** of m.  The pairs of a round are disjoint, so in each pass every lane is
+** written by one rotation from the same inputs, and the pair slots k of a
+** round can be dealt out to threads (slot k to thread k mod nth) without
+** changing a bit.  The threads meet at a barrier after each pass.
+**
+** As with parallel mmul in lagoon.c, workers touch only the C heap, never
+** the loom.  The caller enters the rounding mode before the threads start
+** and restores its own after they join; a worker stores the mode only if
+** its (per-thread, under a THREAD_LOCAL SoftFloat) copy differs, so no
+** worker writes a shared mode while the others run.
+**
+** The thread cap defaults to _SA_PAR_MAX (and the online cores); below
+** _SA_PAR_MIN rows it stays serial.  At run time SALOON_THREADS can lower
+** the cap (SALOON_THREADS=1 disables threading) and SALOON_PAR_MIN moves
+** the threshold.
+*/
+#ifndef _SA_PAR_MAX
+#define _SA_PAR_MAX  16
+#endif
+#ifndef _SA_PAR_MIN
+#define _SA_PAR_MIN  64
+#endif
+
+/* round [r], slot [k] of +rr-pairs: c3n if it pairs with the dummy index.
+*/
+  static inline c3_o
+  _sa_rr(c3_d n, c3_d r, c3_d k, c3_d* p, c3_d* q)
+  {
+    c3_d w = (n & 1) ? n : n - 1;
+    c3_d x = (0 == k) ? r : (r + k) % w;
+    c3_d y = (0 == k) ? w : (r + w - k) % w;
+
+    *p = c3_min(x, y);
+    *q = c3_max(x, y);
+    return ( n == *q ) ? c3n : c3y;
+  }
+
+/* a reusable barrier (pthread_barrier_t is missing on macOS).  [nth_w] is
+** the party count; it is set while [mut_u] is held, before anyone waits.
+*/
+  typedef struct {
+    pthread_mutex_t mut_u;
+    pthread_cond_t  con_u;
+    c3_w            nth_w;
+    c3_w            cnt_w;
+    c3_w            gen_w;
+  } _sa_bar;
+
+  static void
+  _sa_bar_wait(_sa_bar* bar_u)
+  {
+    pthread_mutex_lock(&bar_u->mut_u);
+    c3_w gen_w = bar_u->gen_w;
+    if ( ++bar_u->cnt_w == bar_u->nth_w ) {
+      bar_u->cnt_w = 0;
+      bar_u->gen_w++;
+      pthread_cond_broadcast(&bar_u->con_u);
+    }
+    else {
+      while ( gen_w == bar_u->gen_w ) {
+        pthread_cond_wait(&bar_u->con_u, &bar_u->mut_u);
+      }
+    }
+    pthread_mutex_unlock(&bar_u->mut_u);
+  }
+
+  typedef struct {
+    void*  par_v;             //  the width's shared state
+    c3_w   tid_w;             //  worker index, 0 on this thread
+  } _sa_wok;
+
+  static c3_d
+  _sa_par_env(const c3_c* nam_c, c3_d def)
+  {
+    const c3_c* val_c = getenv(nam_c);
+    if ( (0 == val_c) || (0 == *val_c) ) {
+      return def;
+    }
+    return (c3_d)strtoull(val_c, 0, 10);
+  }
+
+/* _sa_par_threads - workers for an n x n eig-par, at most one per slot
+*/
+  static c3_w
+  _sa_par_threads(c3_d n)
+  {
+    c3_d max = _sa_par_env("SALOON_THREADS", _SA_PAR_MAX);
+    c3_d min = _sa_par_env("SALOON_PAR_MIN", _SA_PAR_MIN);
+    c3_ds cor = sysconf(_SC_NPROCESSORS_ONLN);
+
+    if ( (max <= 1) || (n < min) || (n < 4) ) {
+      return 1;
+    }
+    if ( (cor > 0) && ((c3_d)cor < max) ) {
+      max = cor;
+    }
+    //  _sa_par_run sizes its per-worker arrays on the stack by this
+    max = c3_min(max, _SA_PAR_MAX);
+    return (c3_w)c3_min(max, (n + 1) / 2);
+  }
+
+/* _sa_par_run - run [fun] on up to [tot] workers sharing [par_v]; a worker
+** whose thread can't start is dropped, and the rest deal out its slots.
+*/
+  static void
+  _sa_par_run(void* (*fun)(void*), void* par_v, _sa_bar* bar_u, c3_w tot)
+  {
+    _sa_wok   wok_u[tot];       //  tot <= _SA_PAR_MAX
+    pthread_t tid_u[tot];
+    c3_w      liv_w = 1;
+
+    pthread_mutex_init(&bar_u->mut_u, 0);
+    pthread_cond_init(&bar_u->con_u, 0);
+    bar_u->cnt_w = bar_u->gen_w = 0;
+
+    //  workers first wait at the barrier, so [nth_w] is final before it runs
+    pthread_mutex_lock(&bar_u->mut_u);
+    wok_u[0] = (_sa_wok){ par_v, 0 };
+    for ( c3_w t = 1; t < tot; t++ ) {
+      wok_u[liv_w] = (_sa_wok){ par_v, liv_w };
+      if ( 0 == pthread_create(&tid_u[liv_w], 0, fun, &wok_u[liv_w]) ) {
+        liv_w++;
+      }
+    }
+    bar_u->nth_w = liv_w;
+    pthread_mutex_unlock(&bar_u->mut_u);
+
+    fun(&wok_u[0]);
+    for ( c3_w t = 1; t < liv_w; t++ ) {
+      pthread_join(tid_u[t], 0);
+    }
+    pthread_cond_destroy(&bar_u->con_u);
+    pthread_mutex_destroy(&bar_u->mut_u);
+  }
+
+/* _SA_PAR: the eig-par arms for width [w] over the _SA_JACOBI arms.
+*/
+#define _SA_PAR(w, T, mul, le)                                               \
+  typedef struct {                                                           \
+    c3_d    n;                                                               \
+    T*      m;                                                               \
+    T*      v;                                                               \
+    T*      c;                  /* per slot of the round */                  \
+    T*      s;                                                               \
+    c3_o*   on;                 /* c3n: no rotation (dummy, or a_pq +0) */   \
+    T       thresh;                                                          \
+    c3_o    don;                /* written by worker 0 only */               \
+    c3_o    cap;                                                             \
+    c3_y    rnd;                                                             \
+    _sa_bar bar;                                                             \
+  } _sa_##w##_par;                                                           \
+                                                                             \
+  static void*                                                               \
+  _sa_##w##_pwork(void* arg)                                                 \
+  {                                                                          \
+    _sa_wok*       wok_u = arg;                                              \
+    _sa_##w##_par* par_u = wok_u->par_v;                                     \
+    c3_w           tid   = wok_u->tid_w;                                     \
+    c3_d           n = par_u->n, p, q;                                       \
+    c3_d           ron = (n & 1) ? n : n - 1, slo = (ron + 1) / 2;           \
+    T*             m = par_u->m;                                             \
+                                                                             \
+    if ( softfloat_roundingMode != par_u->rnd ) {                            \
+      softfloat_roundingMode = par_u->rnd;                                   \
+    }                                                                        \
+    _sa_bar_wait(&par_u->bar);                                               \
+    c3_w nth = par_u->bar.nth_w;                                             \
+                                                                             \
+    for ( c3_w sweep = 0; sweep < 60; sweep++ ) {                            \
+      if ( (0 == tid) &&                                                     \
+           le(_sa_##w##_norm(n, m, c3n), par_u->thresh) )                    \
+      {                                                                      \
+        par_u->don = c3y;                                                    \
+        par_u->cap = c3n;                                                    \
+      }                                                                      \
+      _sa_bar_wait(&par_u->bar);                                             \
+      if ( c3y == par_u->don ) break;                                        \
+      for ( c3_d r = 0; r < ron; r++ ) {                                     \
+        for ( c3_d k = tid; k < slo; k += nth ) {                            \
+          par_u->on[k] = c3n;                                                \
+          if ( c3y == _sa_rr(n, r, k, &p, &q) &&                             \
+               !_sa_##w##_nul(m[p*n + q]) )                                  \
+          {                                                                  \
+            _sa_##w##_jrot(m[p*n + p], m[q*n + q], m[p*n + q],               \
+                           &par_u->c[k], &par_u->s[k]);                      \
+            par_u->on[k] = c3y;                                              \
+          }                                                                  \
+        }                                                                    \
+        _sa_bar_wait(&par_u->bar);                                           \
+        for ( c3_d k = tid; k < slo; k += nth ) {                            \
+          if ( c3n == par_u->on[k] ) continue;                               \
+          _sa_rr(n, r, k, &p, &q);                                           \
+          _sa_##w##_rcol(n, m, p, q, par_u->c[k], par_u->s[k]);              \
+          _sa_##w##_rcol(n, par_u->v, p, q, par_u->c[k], par_u->s[k]);       \
+        }                                                                    \
+        _sa_bar_wait(&par_u->bar);                                           \
+        for ( c3_d k = tid; k < slo; k += nth ) {                            \
+          if ( c3n == par_u->on[k] ) continue;                               \
+          _sa_rr(n, r, k, &p, &q);                                           \
+          _sa_##w##_rrow(n, m, p, q, par_u->c[k], par_u->s[k]);              \
+        }                                                                    \
+        _sa_bar_wait(&par_u->bar);                                           \
+      }                                                                      \
+    }                                                                        \
+    return 0;                                                                \
+  }                                                                          \
+                                                                             \
+  /* the +eig-sym loop with +sweep-par, as _sa_##w##_eig(); [m] and [v]   */ \
+  /* must be on the C heap.  [rnd] is the SoftFloat mode the caller has   */ \
+  /* already entered, for workers with a per-thread copy.                 */ \
+  static c3_o                                                                \
+  _sa_##w##_peig(c3_d n, T* m, T* v, const c3_y* tol, c3_y rnd, c3_o* cap)   \
+  {                                                                          \
+    _sa_##w##_par par_u;                                                     \
+    T             rtol;                                                      \
+    c3_d          slo = (n + 1) / 2;                                         \
+                                                                             \
+    memcpy(&rtol, tol, sizeof(T));                                           \
+    if ( c3n == _sa_##w##_sym(n, m) ) return c3n;                            \
+    for ( c3_d i = 0; i < n; i++ ) {                                         \
+      v[i*n + i] = _sa_##w##_k[1];                                           \
+    }                                                                        \
+    par_u.n = n;                                                             \
+    par_u.m = m;                                                             \
+    par_u.v = v;                                                             \
+    par_u.c  = c3_malloc(slo * sizeof(T));                                   \
+    par_u.s  = c3_malloc(slo * sizeof(T));                                   \
+    par_u.on = c3_malloc(slo * sizeof(c3_o));                                \
+    par_u.thresh = mul(rtol, _sa_##w##_norm(n, m, c3y));                     \
+    par_u.don = c3n;                                                         \
+    par_u.cap = c3y;                                                         \
+    par_u.rnd = rnd;                                                         \
+    _sa_par_run(_sa_##w##_pwork, &par_u, &par_u.bar, _sa_par_threads(n));    \
+    c3_free(par_u.c);                                                        \
+    c3_free(par_u.s);                                                        \
+    c3_free(par_u.on);                                                       \
+    *cap = par_u.cap;                                                        \
+    return c3y;                                                              \
+  }
+
+  _SA_PAR(h, float16_t,  f16_mul,   f16_le)
+  _SA_PAR(s, float32_t,  f32_mul,   f32_le)
+  _SA_PAR(d, float64_t,  f64_mul,   f64_le)
+  _SA_PAR(q, float128_t, _sa_q_mul, _sa_q_le)
+
+  static inline void
+  _sa_eig_free(c3_o par, c3_y* m_y)
+  {
+    if ( c3y == par ) {
+      c3_free(m_y);
+    }
+    else {
+      u3a_free(m_y);
+    }
+  }
+
+/* eig, eig-par: sample is the ray; rnd and rtol are the door's, axes 60
+** and 61.  Product [vals vecs]: vals [~[n] rb %i754 ~] with rb the
+** component bloq, vecs [~[n n] bloq kind ~] (%i754, or %cplx from
+** +eig-herm).  [par]: +eig-par, %i754 only.
+*/
+  static u3_noun
+  _sa_eig(u3_noun cor, c3_o par)
+  {
+    u3_noun a = u3r_at(u3x_sam, cor), met, shp;
+    u3_atom dat, tol = u3r_at(61, cor);
+    c3_y    blq, rb;
+    c3_d    len;
+    c3_o    her;
+
+    if ( c3y == _sa_i754(a, &met, &dat, &blq, &len) ) {
+      her = c3n;
+      rb  = blq;
+    }
+    else if ( c3n == par &&
+              c3y == _sa_ray(a, c3__cplx, 5, 8, &met, &dat, &blq, &len) )
+    {
+      her = c3y;
+      rb  = blq - 1;
+    }
+    else {
+      return u3_none;
+    }
+
+    shp = u3h(met);
+    if ( c3n == u3ud(tol) ||
+         c3n == u3du(shp) || c3n == u3du(u3t(shp)) ||
+         u3_nul != u3t(u3t(shp)) ||
+         u3h(shp) != u3h(u3t(shp)) ||
+         0 == u3h(shp) )
+    {
+      return u3_none;
+    }
+
+    //  rtol: 0x1 means +feps; one wider than the component crashes the Hoon
+    c3_d wid = (c3_d)1 << (rb - 3);
+    c3_y tol_y[16] = {0};
+    if ( 1 == tol ) {
+      switch ( rb ) {
+        case 4: memcpy(tol_y, &_sa_h_k[3], 2); break;
+        case 5: memcpy(tol_y, &_sa_s_k[3], 4); break;
+        case 6: memcpy(tol_y, &_sa_d_k[3], 8); break;
+        case 7: memcpy(tol_y, &_sa_q_k[3], 16); break;
+      }
+    }
+    else if ( u3r_met(3, tol) > wid ) {
+      return u3_none;
+    }
+    else {
+      u3r_bytes(0, wid, tol_y, tol);
+    }
+
+    c3_d     n   = u3h(shp);
+    c3_d     esz = (c3y == her) ? 2 * wid : wid;   //  bytes per element
+    c3_d     syz = len * esz;
+    u3i_slab vec_u;
+    u3i_slab_init(&vec_u, 3, syz + 1);
+    vec_u.buf_y[syz] = 0x1;
+
+    //  eig-par's workers never touch the loom, so its m and v are C heap
+    c3_y* m_y, *v_y;
+    if ( c3y == par ) {
+      m_y = c3_malloc(syz);
+      v_y = c3_malloc(syz);
+      memset(v_y, 0, syz);
+    }
+    else {
+      m_y = (c3_y*)u3a_malloc(syz);
+      v_y = vec_u.buf_y;
+    }
+    u3r_bytes(0, syz, m_y, dat);
+
+    c3_o ok, cap;
+    c3_y old = softfloat_roundingMode;
+    c3_y mod = _sa_sf_mode((c3_y)u3r_at(60, cor));
+    softfloat_roundingMode = mod;
+    if ( c3y == par ) {
+      switch ( rb ) {
+        case 4: ok = _sa_h_peig(n, (float16_t*)m_y, (float16_t*)v_y,
+                                tol_y, mod, &cap); break;
+        case 5: ok = _sa_s_peig(n, (float32_t*)m_y, (float32_t*)v_y,
+                                tol_y, mod, &cap); break;
+        case 6: ok = _sa_d_peig(n, (float64_t*)m_y, (float64_t*)v_y,
+                                tol_y, mod, &cap); break;
+        default: ok = _sa_q_peig(n, (float128_t*)m_y, (float128_t*)v_y,
+                                 tol_y, mod, &cap); break;
+      }
+    }
+    else {
+      switch ( rb ) {
+        case 4: ok = ( (c3y == her) ? _sa_h_herm : _sa_h_eig )
+                     (n, (float16_t*)m_y, (float16_t*)v_y,
+                      tol_y, &cap); break;
+        case 5: ok = ( (c3y == her) ? _sa_s_herm : _sa_s_eig )
+                     (n, (float32_t*)m_y, (float32_t*)v_y,
+                      tol_y, &cap); break;
+        case 6: ok = ( (c3y == her) ? _sa_d_herm : _sa_d_eig )
+                     (n, (float64_t*)m_y, (float64_t*)v_y,
+                      tol_y, &cap); break;
+        default: ok = ( (c3y == her) ? _sa_q_herm : _sa_q_eig )
+                      (n, (float128_t*)m_y, (float128_t*)v_y,
+                       tol_y, &cap); break;
+      }
+    }
+    softfloat_roundingMode = old;
+
+    if ( c3y == par ) {
+      memcpy(vec_u.buf_y, v_y, syz);
+      c3_free(v_y);
+    }
+    if ( c3n == ok ) {
+      _sa_eig_free(par, m_y);
+      u3i_slab_free(&vec_u);
+      return u3_none;
+    }
+
+    //  +diag / +diag-real: the (real part of the) diagonal
+    u3i_slab val_u;
+    u3i_slab_init(&val_u, 3, (n * wid) + 1);
+    val_u.buf_y[n * wid] = 0x1;
+    for ( c3_d i = 0; i < n; i++ ) {
+      memcpy(val_u.buf_y + (i * wid), m_y + (((i * n) + i) * esz), wid);
+    }
+    _sa_eig_free(par, m_y);
+
+    if ( c3y == cap ) {
+      u3t_slog(u3nc(0, u3nc(c3__leaf, u3i_tape( (c3y == her)
+        ? "\"saloon eig (hermitian): hit sweep cap (60) without converging to rtol\""
+        : "\"saloon eig: hit sweep cap (60) without converging to rtol\""))));
+    }
+
+    return u3nc(u3nc(u3nq(u3nc(n, u3_nul), rb, c3__i754, u3_nul),
+                     u3i_slab_mint(&val_u)),
+                u3nc(u3nq(u3nt(n, n, u3_nul), blq,
+                          (c3y == her) ? c3__cplx : c3__i754, u3_nul),
+                     u3i_slab_mint(&vec_u)));
+  }
+
+  u3_noun
+  u3wi_sa_eig(u3_noun cor)
+  {
+    return _sa_eig(cor, c3n);
+  }
+
+  u3_noun
+  u3wi_sa_eig_par(u3_noun cor)
+  {
+    return _sa_eig(cor, c3y);
+  }